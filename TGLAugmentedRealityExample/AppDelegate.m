@@ -24,6 +24,7 @@
 //  THE SOFTWARE.
 
 #import "AppDelegate.h"
+#import "PlaceCatalogue.h"
 
 @interface AppDelegate ()
 
@@ -34,6 +35,11 @@
 
 - (BOOL)application:(UIApplication *)application didFinishLaunchingWithOptions:(NSDictionary *)launchOptions {
     // Override point for customization after application launch.
+
+    // Start building the offline search index
+    //
+    [PlaceCatalogue sharedCatalogue];
+
     return YES;
 }
 
@@ -34,6 +34,8 @@
 
 #import <MapKit/MKGeometry.h>
 
+static const CLLocationDistance kReferenceLocationReuseDistance = 1000.0;
+
 @interface AugmentedViewController () <CLLocationManagerDelegate, TGLARViewDataSource, TGLARViewDelegate, PlaceOfInterestViewDelegate>
 
 @property (weak, nonatomic) IBOutlet TGLARView *arView;
@@ -43,6 +45,9 @@
 
 @property (nonatomic, strong) PlaceOfInterest *userLocationPOI;
 
+@property (nonatomic, strong) CLLocation *referenceLocation;
+@property (nonatomic, readonly) NSURL *stateSnapshotURL;
+
 @end
 
 @implementation AugmentedViewController
@@ -62,11 +67,19 @@
     self.locationManager = [[CLLocationManager alloc] init];
     self.locationManager.delegate = self;
 
+    // Overlay state of the previous run, needed before the first location
+    //
+    self.arView.stateSnapshot = [TGLARStateSnapshot snapshotWithContentsOfURL:self.stateSnapshotURL];
+
     self.userHeight = 1.6;
     self.userLocation = self.locationManager.location;
     
     self.northButton.enabled = self.arView.isMagenticNorthAvailable;
 
+    // Hold a lower frame rate to save battery
+    //
+    if ([NSProcessInfo processInfo].isLowPowerModeEnabled) self.arView.targetFrameTime = 1.0 / 30.0;
+
     // A single image shape in the X/Y plane at the user's location
     //
     PlaceOfInterest *userLocationPOI = [[PlaceOfInterest alloc] init];
@@ -81,6 +94,30 @@
     userLocationPOI.overlayShape = shape;
 
     self.userLocationPOI = userLocationPOI;
+
+    // A radar inset above the compass
+    //
+    TGLARRadarView *radar = [[TGLARRadarView alloc] initWithFrame:CGRectMake(0, 0, 96, 96)];
+
+    radar.translatesAutoresizingMaskIntoConstraints = NO;
+    radar.backgroundColor = [UIColor colorWithWhite:0.0 alpha:0.5];
+    radar.layer.cornerRadius = 48;
+    radar.clipsToBounds = YES;
+
+    [self.arView addSubview:radar];
+
+    UILayoutGuide *guide = self.arView.layoutMarginsGuide;
+
+    if (@available(iOS 11, *)) guide = self.arView.safeAreaLayoutGuide;
+
+    [NSLayoutConstraint activateConstraints:@[ [radar.widthAnchor constraintEqualToConstant:96],
+                                               [radar.heightAnchor constraintEqualToConstant:96],
+                                               [radar.trailingAnchor constraintEqualToAnchor:guide.trailingAnchor constant:-16],
+                                               [radar.bottomAnchor constraintEqualToAnchor:guide.bottomAnchor constant:-96] ]];
+
+    self.arView.radar = radar;
+
+    if (self.userLocation) [self updateCameraWorldPosition];
 }
 
 - (void)viewWillAppear:(BOOL)animated {
@@ -106,6 +143,17 @@
 	[self.arView stop];
     
     [self.locationManager stopUpdatingLocation];
+
+    if (self.referenceLocation) {
+
+        CLLocationCoordinate2D coordinate = self.referenceLocation.coordinate;
+        NSError *error = nil;
+
+        if (![self.arView writeStateSnapshotToURL:self.stateSnapshotURL reference:TGLARSnapshotReferenceMake(coordinate.latitude, coordinate.longitude, 0.0) error:&error]) {
+
+            NSLog(@"%s Error writing state snapshot: %@", __PRETTY_FUNCTION__, error);
+        }
+    }
 }
 
 #pragma mark - Appearance
@@ -155,7 +203,19 @@
         
         _userLocation = userLocation;
         
-        [self updatePlaceOverlayPositions];
+        // Place positions are computed once relative to
+        // the first location. Subsequent moves only change
+        // the AR view's camera position
+        //
+        if (self.referenceLocation == nil) {
+
+            self.referenceLocation = [self referenceLocationNearLocation:userLocation];
+
+            [self updatePlaceWorldPositions];
+            [self.arView reloadWorldPositions];
+        }
+
+        [self updateCameraWorldPosition];
     }
 }
 
@@ -175,6 +235,13 @@
     }
 }
 
+- (NSURL *)stateSnapshotURL {
+
+    NSURL *cachesURL = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+
+    return [cachesURL URLByAppendingPathComponent:@"ARState.snapshot"];
+}
+
 #pragma mark - Navigation
 
 - (void)prepareForSegue:(UIStoryboardSegue *)segue sender:(id)sender {
@@ -369,40 +436,97 @@
         }
     }
     
-    [self updatePlaceOverlayPositions];
+    [self updatePlaceWorldPositions];
 }
 
-- (void)updatePlaceOverlayPositions {
+- (void)updatePlaceWorldPositions {
     
-    // The overlay -targetPositions are relative to the
-    // camera position, which is located at the origin.
-    //
-    // Therefore we compute the distances in the X and Y
-    // directions and set the overlay position accordingly.
-    //
     // NOTE: Since the POI altitued are always zero we
     //       do not set the Z component here.
     //
-    MKMapPoint userPoint = MKMapPointForCoordinate(self.userLocation.coordinate);
-    
+    TGLARStateSnapshot *snapshot = self.arView.stateSnapshot;
+
+    if (![self isSnapshotReferenceLocation:snapshot]) snapshot = nil;
+
     for (PlaceOfInterest *place in self.places) {
-        
-        MKMapPoint overlayPoint = MKMapPointForCoordinate(place.coordinate);
-        
-        MKMapPoint westPoint = MKMapPointMake(overlayPoint.x, userPoint.y);
-        CLLocationDistance westDistance = MKMetersBetweenMapPoints(userPoint, westPoint);
-        
-        if (userPoint.x < overlayPoint.x) westDistance = -westDistance;
-        
-        MKMapPoint northPoint = MKMapPointMake(userPoint.x, overlayPoint.y);
-        CLLocationDistance northDistance = MKMetersBetweenMapPoints(userPoint, northPoint);
-        
-        if (userPoint.y < overlayPoint.y) northDistance = -northDistance;
-        
-        GLKVector3 overlayPosition = GLKVector3Make(northDistance, westDistance, (place == self.userLocationPOI) ? -2.0 * self.userHeight : 0.0);
-        
-        place.targetPosition = overlayPosition;
+
+        TGLARWorldPosition position;
+        NSString *identifier = place.overlayIdentifier;
+
+        if (!identifier || ![snapshot getWorldPosition:&position forIdentifier:identifier]) {
+
+            position = [self worldPositionForCoordinate:place.coordinate];
+        }
+
+        place.worldPosition = position;
+    }
+}
+
+- (CLLocation *)referenceLocationNearLocation:(CLLocation *)location {
+
+    // Keep the previous run's reference if still close,
+    // so place positions can be taken from the snapshot
+    //
+    TGLARStateSnapshot *snapshot = self.arView.stateSnapshot;
+
+    if (snapshot) {
+
+        TGLARSnapshotReference reference = snapshot.reference;
+        CLLocation *referenceLocation = [[CLLocation alloc] initWithLatitude:reference.latitude longitude:reference.longitude];
+
+        if ([referenceLocation distanceFromLocation:location] < kReferenceLocationReuseDistance) return referenceLocation;
     }
+
+    return location;
+}
+
+- (BOOL)isSnapshotReferenceLocation:(TGLARStateSnapshot *)snapshot {
+
+    if (snapshot == nil || self.referenceLocation == nil) return NO;
+
+    TGLARSnapshotReference reference = snapshot.reference;
+    CLLocationCoordinate2D coordinate = self.referenceLocation.coordinate;
+
+    return reference.latitude == coordinate.latitude && reference.longitude == coordinate.longitude;
+}
+
+- (void)updateCameraWorldPosition {
+
+    TGLARWorldPosition cameraPosition = [self worldPositionForCoordinate:self.userLocation.coordinate];
+
+    self.userLocationPOI.worldPosition = TGLARWorldPositionMake(cameraPosition.x, cameraPosition.y, cameraPosition.z - 2.0 * self.userHeight);
+
+    // The user location overlay comes after all places
+    //
+    [self.arView setWorldPosition:self.userLocationPOI.worldPosition forOverlayAtIndex:self.places.count];
+
+    self.arView.cameraWorldPosition = cameraPosition;
+}
+
+- (TGLARWorldPosition)worldPositionForCoordinate:(CLLocationCoordinate2D)coordinate {
+
+    // World positions are relative to the reference
+    // location, i.e. the first user location received.
+    //
+    // Therefore we compute the distances in the X and Y
+    // directions and set the world position accordingly.
+    //
+    if (self.referenceLocation == nil) return TGLARWorldPositionMake(0.0, 0.0, 0.0);
+
+    MKMapPoint referencePoint = MKMapPointForCoordinate(self.referenceLocation.coordinate);
+    MKMapPoint overlayPoint = MKMapPointForCoordinate(coordinate);
+    
+    MKMapPoint westPoint = MKMapPointMake(overlayPoint.x, referencePoint.y);
+    CLLocationDistance westDistance = MKMetersBetweenMapPoints(referencePoint, westPoint);
+    
+    if (referencePoint.x < overlayPoint.x) westDistance = -westDistance;
+    
+    MKMapPoint northPoint = MKMapPointMake(referencePoint.x, overlayPoint.y);
+    CLLocationDistance northDistance = MKMetersBetweenMapPoints(referencePoint, northPoint);
+    
+    if (referencePoint.y < overlayPoint.y) northDistance = -northDistance;
+    
+    return TGLARWorldPositionMake(northDistance, westDistance, 0.0);
 }
 
 - (void)destroyOverlaysForPlaces:(NSArray<PlaceOfInterest *> *)places {
@@ -0,0 +1,59 @@
+//
+//  PlaceCatalogue.h
+//  TGLAugmentedRealityExample
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <CoreLocation/CoreLocation.h>
+
+#import "PlaceOfInterest.h"
+
+/** An offline catalogue of places searchable by name and distance.
+ *
+ * The catalogue is read from a tab separated file with one place per
+ * line: latitude, longitude and name. The index is built in the
+ * background, searches issued before are answered once it is ready.
+ */
+@interface PlaceCatalogue : NSObject
+
+/// The catalogue file, @p nil for an empty catalogue.
+@property (nonatomic, readonly) NSURL *URL;
+/// The number of places in the catalogue, zero until the index is built.
+@property (readonly) NSUInteger count;
+
+/// Returns the catalogue bundled with the app as @p Places.tsv.
++ (instancetype)sharedCatalogue;
+
+/// Initializes a catalogue from a file. A @p nil URL creates an empty catalogue.
+- (instancetype)initWithContentsOfURL:(NSURL *)url;
+
+/** Finds the places closest to a location whose names match a query.
+ *
+ * @param query The search text. Up to two characters match word prefixes, longer text matches anywhere in a name.
+ * @param location The location to measure distances from.
+ * @param maxCount The maximum number of places to find.
+ * @param completion Called on the main queue with the places ordered by ascending distance.
+ */
+- (void)searchPlacesMatching:(NSString *)query nearLocation:(CLLocation *)location maxCount:(NSUInteger)maxCount completion:(void (^)(NSArray<PlaceOfInterest *> *places))completion;
+
+@end
@@ -0,0 +1,178 @@
+//
+//  PlaceCatalogue.m
+//  TGLAugmentedRealityExample
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "PlaceCatalogue.h"
+#import "PlaceSearchIndex.h"
+
+#import <MapKit/MKPlacemark.h>
+
+@interface PlaceCatalogue () {
+
+    PlaceSearchIndex _index;
+}
+
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (assign) NSUInteger count;
+
+@end
+
+@implementation PlaceCatalogue
+
++ (instancetype)sharedCatalogue {
+
+    static PlaceCatalogue *sharedCatalogue = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+
+        sharedCatalogue = [[PlaceCatalogue alloc] initWithContentsOfURL:[[NSBundle mainBundle] URLForResource:@"Places" withExtension:@"tsv"]];
+    });
+
+    return sharedCatalogue;
+}
+
+- (instancetype)initWithContentsOfURL:(NSURL *)url {
+
+    self = [super init];
+
+    if (self) {
+
+        _URL = [url copy];
+
+        PlaceSearchIndexInit(&_index, 0.01);
+
+        // The index is not reentrant, so building
+        // and searching share a serial queue
+        //
+        _queue = dispatch_queue_create("PlaceCatalogue", DISPATCH_QUEUE_SERIAL);
+
+        if (url) {
+
+            dispatch_async(_queue, ^{
+
+                [self loadContentsOfURL:url];
+            });
+        }
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    PlaceSearchIndexDestroy(&_index);
+}
+
+#pragma mark - Methods
+
+- (void)searchPlacesMatching:(NSString *)query nearLocation:(CLLocation *)location maxCount:(NSUInteger)maxCount completion:(void (^)(NSArray<PlaceOfInterest *> *))completion {
+
+    NSString *queryCopy = [query copy] ?: @"";
+    CLLocationCoordinate2D center = location.coordinate;
+
+    dispatch_async(self.queue, ^{
+
+        NSMutableData *resultData = [NSMutableData dataWithLength:MAX(maxCount, 1) * sizeof(PlaceSearchResult)];
+        PlaceSearchResult *results = resultData.mutableBytes;
+
+        size_t count = PlaceSearchIndexQuery(&self->_index, queryCopy.UTF8String, center.latitude, center.longitude, results, maxCount);
+
+        NSMutableArray<PlaceOfInterest *> *places = [NSMutableArray arrayWithCapacity:count];
+
+        for (size_t idx = 0; idx < count; idx++) {
+
+            CLLocationCoordinate2D coordinate;
+
+            PlaceSearchIndexCoordinate(&self->_index, results[idx].entry, &coordinate.latitude, &coordinate.longitude);
+
+            MKPlacemark *placemark = [[MKPlacemark alloc] initWithCoordinate:coordinate addressDictionary:nil];
+            PlaceOfInterest *poi = [PlaceOfInterest placeOfInterestWithPlacemark:placemark];
+
+            poi.title = [NSString stringWithUTF8String:PlaceSearchIndexName(&self->_index, results[idx].entry)];
+            poi.distance = results[idx].distance;
+
+            [places addObject:poi];
+        }
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+
+            completion(places);
+        });
+    });
+}
+
+#pragma mark - Helpers
+
+- (void)loadContentsOfURL:(NSURL *)url {
+
+    NSError *error = nil;
+    NSData *data = [NSData dataWithContentsOfURL:url options:NSDataReadingMappedIfSafe error:&error];
+
+    if (data == nil) {
+
+        NSLog(@"%s Catalogue could not be read: %@", __PRETTY_FUNCTION__, error.localizedDescription);
+        return;
+    }
+
+    const char *bytes = data.bytes;
+    const char *end = bytes + data.length;
+
+    char line[1024];
+
+    while (bytes < end) {
+
+        const char *lineEnd = memchr(bytes, '\n', end - bytes) ?: end;
+        size_t length = MIN((size_t)(lineEnd - bytes), sizeof(line) - 1);
+
+        memcpy(line, bytes, length);
+
+        line[length] = '\0';
+        bytes = lineEnd + 1;
+
+        if (length > 0 && line[length - 1] == '\r') line[length - 1] = '\0';
+
+        char *field = line;
+        double latitude = strtod(field, &field);
+
+        if (*field != '\t') continue;
+
+        double longitude = strtod(field + 1, &field);
+
+        if (*field != '\t' || field[1] == '\0') continue;
+
+        if (!PlaceSearchIndexAdd(&_index, field + 1, latitude, longitude)) break;
+    }
+
+    if (PlaceSearchIndexBuild(&_index)) {
+
+        self.count = _index.count;
+
+    } else {
+
+        NSLog(@"%s Catalogue index could not be built", __PRETTY_FUNCTION__);
+    }
+}
+
+@end
@@ -35,8 +35,10 @@
 
 @property (nonatomic, copy) NSString *title;
 @property (nonatomic, readonly) CLPlacemark *placemark;
+@property (nonatomic, assign) CLLocationDistance distance;
 
 @property (nonatomic, assign) GLKVector3 targetPosition;
+@property (nonatomic, assign) TGLARWorldPosition worldPosition;
 
 @property (nonatomic, strong) TGLARViewOverlay *overlayView;
 @property (nonatomic, strong) TGLARShapeOverlay *overlayShape;
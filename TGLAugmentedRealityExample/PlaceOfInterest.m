@@ -67,4 +67,16 @@
     self.overlayShape.overlay = self;
 }
 
+- (nullable NSString *)overlayIdentifier {
+
+    // Places found by search are identified by
+    // location, the user location is not saved
+    //
+    if (self.placemark == nil) return nil;
+
+    CLLocationCoordinate2D coordinate = self.coordinate;
+
+    return [NSString stringWithFormat:@"%.7f,%.7f", coordinate.latitude, coordinate.longitude];
+}
+
 @end
@@ -0,0 +1,768 @@
+//
+//  PlaceSearchIndex.c
+//  TGLAugmentedRealityExample
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "PlaceSearchIndex.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Folded names use 38 symbols, so all trigrams fit a dense table.
+// Symbol 0 marks word starts for prefix matching of short queries
+//
+#define PLACE_SYMBOLS 38
+#define PLACE_TRIGRAMS (PLACE_SYMBOLS * PLACE_SYMBOLS * PLACE_SYMBOLS)
+#define PLACE_QUERY_LENGTH 256
+
+static const double kPlaceEarthRadius = 6371008.8;
+static const double kPlaceMetersPerDegree = 6371008.8 * M_PI / 180.0;
+
+static const size_t kPlaceSpatialThreshold = 16384;
+static const uint32_t kPlaceMaxRing = 64;
+
+typedef struct {
+
+    uint64_t cell;
+    uint32_t entry;
+
+} PlaceCellItem;
+
+// Folding of the Latin-1 supplement U+00C0 to U+00FF
+//
+static const char *const kPlaceLatin1Folding[64] = {
+
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",
+    "d", "n", "o", "o", "o", "o", "o", NULL, "o", "u", "u", "u", "u", "y", "th", "ss",
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",
+    "d", "n", "o", "o", "o", "o", "o", NULL, "o", "u", "u", "u", "u", "y", "th", "y"
+};
+
+static size_t PlaceFoldText(const char *text, char *buffer, size_t capacity) {
+
+    const unsigned char *s = (const unsigned char *)text;
+    size_t length = 0;
+    int separator = 0;
+
+    if (capacity == 0) return 0;
+
+    while (*s) {
+
+        const char *folded = NULL;
+        char ascii[2] = { 0, 0 };
+
+        if ((*s >= 'a' && *s <= 'z') || (*s >= '0' && *s <= '9')) {
+
+            ascii[0] = (char)*s;
+            folded = ascii;
+            s++;
+
+        } else if (*s >= 'A' && *s <= 'Z') {
+
+            ascii[0] = (char)(*s - 'A' + 'a');
+            folded = ascii;
+            s++;
+
+        } else if (*s == 0xC3 && s[1] >= 0x80 && s[1] <= 0xBF) {
+
+            folded = kPlaceLatin1Folding[s[1] - 0x80];
+            s += 2;
+
+        } else {
+
+            // Skip other characters including
+            // the rest of multibyte sequences
+            //
+            s++;
+
+            while ((*s & 0xC0) == 0x80) s++;
+        }
+
+        if (folded == NULL) {
+
+            separator = (length > 0);
+            continue;
+        }
+
+        size_t foldedLength = strlen(folded);
+
+        if (length + separator + foldedLength >= capacity) break;
+
+        if (separator) buffer[length++] = ' ';
+
+        memcpy(buffer + length, folded, foldedLength);
+
+        length += foldedLength;
+        separator = 0;
+    }
+
+    buffer[length] = '\0';
+
+    return length;
+}
+
+static inline uint32_t PlaceSymbol(char c) {
+
+    if (c >= 'a' && c <= 'z') return 2 + (c - 'a');
+    if (c >= '0' && c <= '9') return 28 + (c - '0');
+    if (c == ' ') return 1;
+
+    return 0;
+}
+
+static inline uint32_t PlaceTrigram(uint32_t s0, uint32_t s1, uint32_t s2) {
+
+    return (s0 * PLACE_SYMBOLS + s1) * PLACE_SYMBOLS + s2;
+}
+
+// Returns the trigrams of a folded name. Keys may repeat,
+// at most 3 * length keys are written to @p keys
+//
+static size_t PlaceTextKeys(const char *text, size_t length, uint32_t *keys) {
+
+    size_t count = 0;
+
+    for (size_t idx = 0; idx + 2 < length; idx++) {
+
+        keys[count++] = PlaceTrigram(PlaceSymbol(text[idx]), PlaceSymbol(text[idx + 1]), PlaceSymbol(text[idx + 2]));
+    }
+
+    for (size_t idx = 0; idx < length; idx++) {
+
+        if (text[idx] == ' ' || (idx > 0 && text[idx - 1] != ' ')) continue;
+
+        keys[count++] = PlaceTrigram(0, 0, PlaceSymbol(text[idx]));
+
+        if (idx + 1 < length && text[idx + 1] != ' ') {
+
+            keys[count++] = PlaceTrigram(0, PlaceSymbol(text[idx]), PlaceSymbol(text[idx + 1]));
+        }
+    }
+
+    return count;
+}
+
+static int PlaceReserve(void **buffer, size_t *capacity, size_t count, size_t size) {
+
+    if (count <= *capacity) return 1;
+
+    size_t newCapacity = (*capacity > 0) ? *capacity : 1024;
+
+    while (newCapacity < count) newCapacity *= 2;
+
+    void *newBuffer = realloc(*buffer, newCapacity * size);
+
+    if (newBuffer == NULL) return 0;
+
+    *buffer = newBuffer;
+    *capacity = newCapacity;
+
+    return 1;
+}
+
+static int PlaceCellItemCompare(const void *a, const void *b) {
+
+    const PlaceCellItem *item1 = a;
+    const PlaceCellItem *item2 = b;
+
+    if (item1->cell < item2->cell) return -1;
+    if (item1->cell > item2->cell) return 1;
+
+    if (item1->entry < item2->entry) return -1;
+    if (item1->entry > item2->entry) return 1;
+
+    return 0;
+}
+
+static int PlaceResultCompare(const void *a, const void *b) {
+
+    const PlaceSearchResult *result1 = a;
+    const PlaceSearchResult *result2 = b;
+
+    if (result1->distance < result2->distance) return -1;
+    if (result1->distance > result2->distance) return 1;
+
+    if (result1->entry < result2->entry) return -1;
+    if (result1->entry > result2->entry) return 1;
+
+    return 0;
+}
+
+static void PlaceCellPosition(const PlaceSearchIndex *index, double latitude, double longitude, int64_t *row, int64_t *column) {
+
+    *row = (int64_t)floor((latitude + 90.0) / index->cellDegrees);
+    *column = (int64_t)floor((longitude + 180.0) / index->cellDegrees);
+
+    if (*row < 0) *row = 0;
+    if (*row >= index->rows) *row = index->rows - 1;
+
+    *column %= index->columns;
+
+    if (*column < 0) *column += index->columns;
+}
+
+static int PlacePostingContains(const uint32_t *postings, uint32_t count, uint32_t entry) {
+
+    uint32_t low = 0;
+    uint32_t high = count;
+
+    while (low < high) {
+
+        uint32_t mid = low + (high - low) / 2;
+
+        if (postings[mid] < entry) {
+
+            low = mid + 1;
+
+        } else {
+
+            high = mid;
+        }
+    }
+
+    return (low < count && postings[low] == entry);
+}
+
+static const uint32_t *PlaceCellEntries(const PlaceSearchIndex *index, uint64_t cell, uint32_t *count) {
+
+    size_t low = 0;
+    size_t high = index->cellCount;
+
+    while (low < high) {
+
+        size_t mid = low + (high - low) / 2;
+
+        if (index->cellKeys[mid] < cell) {
+
+            low = mid + 1;
+
+        } else {
+
+            high = mid;
+        }
+    }
+
+    if (low == index->cellCount || index->cellKeys[low] != cell) {
+
+        *count = 0;
+        return NULL;
+    }
+
+    *count = index->cellStart[low + 1] - index->cellStart[low];
+
+    return index->cellEntries + index->cellStart[low];
+}
+
+// Keeps the nearest results in a max-heap on distance
+//
+static void PlaceHeapPush(PlaceSearchResult *heap, size_t *size, size_t maxSize, uint32_t entry, double distance) {
+
+    size_t idx;
+
+    if (*size < maxSize) {
+
+        idx = (*size)++;
+
+        while (idx > 0) {
+
+            size_t parent = (idx - 1) / 2;
+
+            if (heap[parent].distance >= distance) break;
+
+            heap[idx] = heap[parent];
+            idx = parent;
+        }
+
+    } else if (distance < heap[0].distance) {
+
+        idx = 0;
+
+        for (;;) {
+
+            size_t child = 2 * idx + 1;
+
+            if (child >= *size) break;
+            if (child + 1 < *size && heap[child + 1].distance > heap[child].distance) child++;
+            if (heap[child].distance <= distance) break;
+
+            heap[idx] = heap[child];
+            idx = child;
+        }
+
+    } else {
+
+        return;
+    }
+
+    heap[idx].entry = entry;
+    heap[idx].distance = distance;
+}
+
+void PlaceSearchIndexInit(PlaceSearchIndex *index, double cellDegrees) {
+
+    memset(index, 0, sizeof(PlaceSearchIndex));
+
+    index->cellDegrees = (cellDegrees > 0.0) ? cellDegrees : 0.01;
+    index->rows = (uint32_t)ceil(180.0 / index->cellDegrees);
+    index->columns = (uint32_t)ceil(360.0 / index->cellDegrees);
+}
+
+void PlaceSearchIndexDestroy(PlaceSearchIndex *index) {
+
+    free(index->coordinates);
+    free(index->names);
+    free(index->nameOffsets);
+    free(index->texts);
+    free(index->textOffsets);
+    free(index->trigramStart);
+    free(index->trigramEntries);
+    free(index->cellKeys);
+    free(index->cellStart);
+    free(index->cellEntries);
+    free(index->candidates);
+
+    memset(index, 0, sizeof(PlaceSearchIndex));
+}
+
+int PlaceSearchIndexAdd(PlaceSearchIndex *index, const char *name, double latitude, double longitude) {
+
+    if (index->built || index->count == UINT32_MAX) return 0;
+
+    size_t nameLength = strlen(name);
+
+    // Offset arrays hold one more entry for the end offset
+    //
+    size_t capacity = index->capacity;
+
+    if (index->count + 2 > capacity) {
+
+        size_t newCapacity = (capacity > 0) ? 2 * capacity : 1024;
+
+        double *coordinates = realloc(index->coordinates, 2 * newCapacity * sizeof(double));
+
+        if (coordinates == NULL) return 0;
+
+        index->coordinates = coordinates;
+
+        size_t *nameOffsets = realloc(index->nameOffsets, newCapacity * sizeof(size_t));
+
+        if (nameOffsets == NULL) return 0;
+
+        index->nameOffsets = nameOffsets;
+
+        size_t *textOffsets = realloc(index->textOffsets, newCapacity * sizeof(size_t));
+
+        if (textOffsets == NULL) return 0;
+
+        index->textOffsets = textOffsets;
+        index->capacity = newCapacity;
+    }
+
+    // Folding never makes a name longer
+    //
+    if (!PlaceReserve((void **)&index->names, &index->namesCapacity, index->namesLength + nameLength + 1, sizeof(char))) return 0;
+    if (!PlaceReserve((void **)&index->texts, &index->textsCapacity, index->textsLength + nameLength + 1, sizeof(char))) return 0;
+
+    uint32_t entry = index->count++;
+
+    index->coordinates[2 * entry + 0] = latitude;
+    index->coordinates[2 * entry + 1] = longitude;
+
+    index->nameOffsets[entry] = index->namesLength;
+
+    memcpy(index->names + index->namesLength, name, nameLength + 1);
+
+    index->namesLength += nameLength + 1;
+
+    index->textOffsets[entry] = index->textsLength;
+    index->textsLength += PlaceFoldText(name, index->texts + index->textsLength, nameLength + 1) + 1;
+
+    index->nameOffsets[entry + 1] = index->namesLength;
+    index->textOffsets[entry + 1] = index->textsLength;
+
+    return 1;
+}
+
+int PlaceSearchIndexBuild(PlaceSearchIndex *index) {
+
+    if (index->built) return 1;
+
+    uint32_t count = index->count;
+
+    size_t maxLength = 0;
+
+    for (uint32_t entry = 0; entry < count; entry++) {
+
+        size_t length = index->textOffsets[entry + 1] - index->textOffsets[entry] - 1;
+
+        if (length > maxLength) maxLength = length;
+    }
+
+    uint32_t *keys = malloc((3 * maxLength + 1) * sizeof(uint32_t));
+    uint32_t *keyStamps = malloc(PLACE_TRIGRAMS * sizeof(uint32_t));
+    PlaceCellItem *items = malloc((count + 1) * sizeof(PlaceCellItem));
+
+    index->trigramStart = calloc(PLACE_TRIGRAMS + 1, sizeof(uint32_t));
+    index->candidates = malloc((count + 1) * sizeof(uint32_t));
+
+    if (keys == NULL || keyStamps == NULL || items == NULL || index->trigramStart == NULL || index->candidates == NULL) {
+
+        free(keys);
+        free(keyStamps);
+        free(items);
+
+        return 0;
+    }
+
+    // Count distinct trigrams per entry, then scatter entries
+    // in reverse order so posting lists end up ascending
+    //
+    memset(keyStamps, 0xFF, PLACE_TRIGRAMS * sizeof(uint32_t));
+
+    size_t total = 0;
+
+    for (uint32_t entry = 0; entry < count; entry++) {
+
+        const char *text = index->texts + index->textOffsets[entry];
+        size_t keyCount = PlaceTextKeys(text, index->textOffsets[entry + 1] - index->textOffsets[entry] - 1, keys);
+
+        for (size_t idx = 0; idx < keyCount; idx++) {
+
+            if (keyStamps[keys[idx]] == entry) continue;
+
+            keyStamps[keys[idx]] = entry;
+            index->trigramStart[keys[idx]]++;
+            total++;
+        }
+    }
+
+    if (total > UINT32_MAX || (index->trigramEntries = malloc((total + 1) * sizeof(uint32_t))) == NULL) {
+
+        free(keys);
+        free(keyStamps);
+        free(items);
+
+        return 0;
+    }
+
+    for (uint32_t key = 1; key <= PLACE_TRIGRAMS; key++) index->trigramStart[key] += index->trigramStart[key - 1];
+
+    memset(keyStamps, 0xFF, PLACE_TRIGRAMS * sizeof(uint32_t));
+
+    for (uint32_t entry = count; entry-- > 0;) {
+
+        const char *text = index->texts + index->textOffsets[entry];
+        size_t keyCount = PlaceTextKeys(text, index->textOffsets[entry + 1] - index->textOffsets[entry] - 1, keys);
+
+        for (size_t idx = 0; idx < keyCount; idx++) {
+
+            if (keyStamps[keys[idx]] == entry) continue;
+
+            keyStamps[keys[idx]] = entry;
+            index->trigramEntries[--index->trigramStart[keys[idx]]] = entry;
+        }
+    }
+
+    free(keys);
+    free(keyStamps);
+
+    // Spatial cells are kept as a sorted list of occupied cells
+    //
+    for (uint32_t entry = 0; entry < count; entry++) {
+
+        int64_t row, column;
+
+        PlaceCellPosition(index, index->coordinates[2 * entry], index->coordinates[2 * entry + 1], &row, &column);
+
+        items[entry].cell = (uint64_t)row * index->columns + (uint64_t)column;
+        items[entry].entry = entry;
+    }
+
+    qsort(items, count, sizeof(PlaceCellItem), PlaceCellItemCompare);
+
+    size_t cellCount = 0;
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        if (idx == 0 || items[idx].cell != items[idx - 1].cell) cellCount++;
+    }
+
+    index->cellKeys = malloc((cellCount + 1) * sizeof(uint64_t));
+    index->cellStart = malloc((cellCount + 1) * sizeof(uint32_t));
+    index->cellEntries = malloc((count + 1) * sizeof(uint32_t));
+
+    if (index->cellKeys == NULL || index->cellStart == NULL || index->cellEntries == NULL) {
+
+        free(items);
+
+        return 0;
+    }
+
+    index->cellCount = 0;
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        if (idx == 0 || items[idx].cell != items[idx - 1].cell) {
+
+            index->cellKeys[index->cellCount] = items[idx].cell;
+            index->cellStart[index->cellCount] = idx;
+            index->cellCount++;
+        }
+
+        index->cellEntries[idx] = items[idx].entry;
+    }
+
+    index->cellStart[index->cellCount] = count;
+
+    free(items);
+
+    index->built = 1;
+
+    return 1;
+}
+
+const char *PlaceSearchIndexName(const PlaceSearchIndex *index, uint32_t entry) {
+
+    return index->names + index->nameOffsets[entry];
+}
+
+void PlaceSearchIndexCoordinate(const PlaceSearchIndex *index, uint32_t entry, double *latitude, double *longitude) {
+
+    *latitude = index->coordinates[2 * entry + 0];
+    *longitude = index->coordinates[2 * entry + 1];
+}
+
+double PlaceSearchIndexDistance(double latitude1, double longitude1, double latitude2, double longitude2) {
+
+    double phi1 = latitude1 * M_PI / 180.0;
+    double phi2 = latitude2 * M_PI / 180.0;
+    double sinPhi = sin(0.5 * (phi2 - phi1));
+    double sinLambda = sin(0.5 * (longitude2 - longitude1) * M_PI / 180.0);
+
+    double h = sinPhi * sinPhi + cos(phi1) * cos(phi2) * sinLambda * sinLambda;
+
+    return 2.0 * kPlaceEarthRadius * asin(sqrt(fmin(h, 1.0)));
+}
+
+static inline uint32_t PlacePostingCount(const PlaceSearchIndex *index, uint32_t key) {
+
+    return index->trigramStart[key + 1] - index->trigramStart[key];
+}
+
+// Returns the trigrams of a folded query ordered by the length of
+// their posting lists, so that probes fail on the rarest ones first
+//
+static size_t PlaceQueryKeys(const PlaceSearchIndex *index, const char *query, size_t length, uint32_t *keys) {
+
+    size_t keyCount = 0;
+
+    if (length <= 2) {
+
+        keys[keyCount++] = (length == 1) ? PlaceTrigram(0, 0, PlaceSymbol(query[0])) : PlaceTrigram(0, PlaceSymbol(query[0]), PlaceSymbol(query[1]));
+
+    } else {
+
+        for (size_t idx = 0; idx + 2 < length; idx++) {
+
+            keys[keyCount++] = PlaceTrigram(PlaceSymbol(query[idx]), PlaceSymbol(query[idx + 1]), PlaceSymbol(query[idx + 2]));
+        }
+    }
+
+    for (size_t idx = 1; idx < keyCount; idx++) {
+
+        uint32_t key = keys[idx];
+        uint32_t count = PlacePostingCount(index, key);
+        size_t slot = idx;
+
+        while (slot > 0 && PlacePostingCount(index, keys[slot - 1]) > count) {
+
+            keys[slot] = keys[slot - 1];
+            slot--;
+        }
+
+        keys[slot] = key;
+    }
+
+    return keyCount;
+}
+
+static int PlaceTextMatches(const char *text, const char *query, size_t length) {
+
+    if (length == 0) return 1;
+
+    if (length > 2) return (strstr(text, query) != NULL);
+
+    // Short queries match word prefixes only
+    //
+    for (const char *word = text; word; word = strchr(word, ' ')) {
+
+        if (*word == ' ') word++;
+
+        if (strncmp(word, query, length) == 0) return 1;
+    }
+
+    return 0;
+}
+
+// Collects the entries matching a folded query into the
+// candidate buffer and returns their number
+//
+static uint32_t PlaceMatchCandidates(PlaceSearchIndex *index, const char *query, size_t length, const uint32_t *keys, size_t keyCount) {
+
+    const uint32_t *postings = index->trigramEntries + index->trigramStart[keys[0]];
+    uint32_t postingCount = PlacePostingCount(index, keys[0]);
+    uint32_t candidateCount = 0;
+
+    // Walk the shortest posting list and probe the others
+    //
+    for (uint32_t idx = 0; idx < postingCount; idx++) {
+
+        uint32_t entry = postings[idx];
+        int match = 1;
+
+        for (size_t key = 1; key < keyCount && match; key++) {
+
+            match = PlacePostingContains(index->trigramEntries + index->trigramStart[keys[key]], PlacePostingCount(index, keys[key]), entry);
+        }
+
+        // Trigrams may match out of order
+        //
+        if (match && length > 3) match = (strstr(index->texts + index->textOffsets[entry], query) != NULL);
+
+        if (match) index->candidates[candidateCount++] = entry;
+    }
+
+    return candidateCount;
+}
+
+// Visits grid cells in rings around the location until no closer
+// matching entry can be found. Returns zero if the search gave up
+//
+static int PlaceSpatialSearch(const PlaceSearchIndex *index, const char *query, size_t length, double latitude, double longitude, PlaceSearchResult *results, size_t *resultCount, size_t maxResults) {
+
+    int64_t row0, column0;
+
+    PlaceCellPosition(index, latitude, longitude, &row0, &column0);
+
+    for (int64_t ring = 0; ring <= kPlaceMaxRing; ring++) {
+
+        if (2 * ring + 1 > index->columns) return 0;
+
+        // Entries in this ring or beyond are at least ring - 1
+        // cells away in latitude or longitude. The bound uses the
+        // parallel closest to the pole, so it is conservative
+        //
+        if (*resultCount == maxResults && ring > 1) {
+
+            double poleward = fmin(fabs(latitude) + (ring + 1) * index->cellDegrees, 89.9);
+            double bound = 0.99 * (ring - 1) * index->cellDegrees * kPlaceMetersPerDegree * cos(poleward * M_PI / 180.0);
+
+            if (bound > results[0].distance) return 1;
+        }
+
+        for (int64_t dr = -ring; dr <= ring; dr++) {
+
+            int64_t row = row0 + dr;
+
+            if (row < 0 || row >= index->rows) continue;
+
+            int64_t step = (dr == -ring || dr == ring) ? 1 : 2 * ring;
+
+            for (int64_t dc = -ring; dc <= ring; dc += step) {
+
+                int64_t column = (column0 + dc) % index->columns;
+
+                if (column < 0) column += index->columns;
+
+                uint32_t count;
+                const uint32_t *entries = PlaceCellEntries(index, (uint64_t)row * index->columns + (uint64_t)column, &count);
+
+                for (uint32_t idx = 0; idx < count; idx++) {
+
+                    uint32_t entry = entries[idx];
+
+                    if (!PlaceTextMatches(index->texts + index->textOffsets[entry], query, length)) continue;
+
+                    double distance = PlaceSearchIndexDistance(latitude, longitude, index->coordinates[2 * entry], index->coordinates[2 * entry + 1]);
+
+                    PlaceHeapPush(results, resultCount, maxResults, entry, distance);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+size_t PlaceSearchIndexQuery(PlaceSearchIndex *index, const char *query, double latitude, double longitude, PlaceSearchResult *results, size_t maxResults) {
+
+    if (!index->built || index->count == 0 || maxResults == 0) return 0;
+
+    char folded[PLACE_QUERY_LENGTH];
+    size_t length = PlaceFoldText(query ? query : "", folded, sizeof(folded));
+
+    uint32_t keys[PLACE_QUERY_LENGTH];
+    size_t keyCount = (length > 0) ? PlaceQueryKeys(index, folded, length, keys) : 0;
+
+    uint32_t shortestCount = (keyCount > 0) ? PlacePostingCount(index, keys[0]) : index->count;
+    size_t resultCount = 0;
+
+    if (shortestCount == 0) return 0;
+
+    // Unselective queries are answered by walking the spatial grid
+    // and testing the names on the way, selective ones by ranking
+    // the places found in the trigram index. Filtering a posting
+    // list is cheap enough that the grid is only worth walking for
+    // long ones, where it also rarely gives up
+    //
+    int ranked = 0;
+
+    if (shortestCount > kPlaceSpatialThreshold) {
+
+        ranked = PlaceSpatialSearch(index, folded, length, latitude, longitude, results, &resultCount, maxResults);
+
+        if (!ranked) resultCount = 0;
+    }
+
+    if (!ranked) {
+
+        uint32_t candidateCount = (keyCount > 0) ? PlaceMatchCandidates(index, folded, length, keys, keyCount) : index->count;
+
+        for (uint32_t idx = 0; idx < candidateCount; idx++) {
+
+            uint32_t entry = (keyCount > 0) ? index->candidates[idx] : idx;
+            double distance = PlaceSearchIndexDistance(latitude, longitude, index->coordinates[2 * entry], index->coordinates[2 * entry + 1]);
+
+            PlaceHeapPush(results, &resultCount, maxResults, entry, distance);
+        }
+    }
+
+    qsort(results, resultCount, sizeof(PlaceSearchResult), PlaceResultCompare);
+
+    return resultCount;
+}
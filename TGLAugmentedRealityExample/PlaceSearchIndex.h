@@ -0,0 +1,132 @@
+//
+//  PlaceSearchIndex.h
+//  TGLAugmentedRealityExample
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef PlaceSearchIndex_h
+#define PlaceSearchIndex_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A place found by @p PlaceSearchIndexQuery.
+typedef struct {
+
+    uint32_t entry;
+    double distance;
+
+} PlaceSearchResult;
+
+/** An offline index answering name queries ordered by distance.
+ *
+ * Names are folded to lower case ASCII letters, digits and single
+ * spaces. Queries of one or two characters match word prefixes,
+ * longer queries match substrings of the folded name. A trigram
+ * index selects the matching places, a grid of latitude/longitude
+ * cells finds the nearest ones when there are many matches.
+ *
+ * Places are added first and the index is built once. Queries use
+ * scratch buffers of the index and must not run concurrently.
+ */
+typedef struct {
+
+    double cellDegrees;
+    uint32_t rows;
+    uint32_t columns;
+
+    uint32_t count;
+    size_t capacity;
+
+    double *coordinates;
+
+    char *names;
+    size_t namesLength;
+    size_t namesCapacity;
+    size_t *nameOffsets;
+
+    char *texts;
+    size_t textsLength;
+    size_t textsCapacity;
+    size_t *textOffsets;
+
+    uint32_t *trigramStart;
+    uint32_t *trigramEntries;
+
+    uint64_t *cellKeys;
+    uint32_t *cellStart;
+    uint32_t *cellEntries;
+    size_t cellCount;
+
+    uint32_t *candidates;
+
+    int built;
+
+} PlaceSearchIndex;
+
+/// Initializes an empty index with spatial cells of @p cellDegrees latitude and longitude. Default is @p 0.01.
+void PlaceSearchIndexInit(PlaceSearchIndex *index, double cellDegrees);
+
+/// Releases all memory held by the index.
+void PlaceSearchIndexDestroy(PlaceSearchIndex *index);
+
+/** Adds a place to an index that has not been built yet.
+ *
+ * @param name The UTF-8 encoded place name.
+ *
+ * @return Non-zero on success, zero if the index is already built or memory could not be allocated.
+ */
+int PlaceSearchIndexAdd(PlaceSearchIndex *index, const char *name, double latitude, double longitude);
+
+/// Builds the text and spatial index. Returns non-zero on success, zero if memory could not be allocated.
+int PlaceSearchIndexBuild(PlaceSearchIndex *index);
+
+/// Returns the name of a place as passed to @p PlaceSearchIndexAdd.
+const char *PlaceSearchIndexName(const PlaceSearchIndex *index, uint32_t entry);
+
+/// Returns the coordinate of a place.
+void PlaceSearchIndexCoordinate(const PlaceSearchIndex *index, uint32_t entry, double *latitude, double *longitude);
+
+/** Finds the places closest to a location whose names match a query.
+ *
+ * @param query The UTF-8 encoded query. An empty query matches all places.
+ * @param latitude The latitude of the location to measure distances from.
+ * @param longitude The longitude of the location to measure distances from.
+ * @param results Receives the matching places ordered by ascending distance in meters.
+ * @param maxResults The capacity of @p results.
+ *
+ * @return The number of places stored in @p results.
+ */
+size_t PlaceSearchIndexQuery(PlaceSearchIndex *index, const char *query, double latitude, double longitude, PlaceSearchResult *results, size_t maxResults);
+
+/// Returns the great circle distance in meters between two coordinates.
+double PlaceSearchIndexDistance(double latitude1, double longitude1, double latitude2, double longitude2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PlaceSearchIndex_h */
@@ -24,9 +24,12 @@
 //  THE SOFTWARE.
 
 #import "SearchViewController.h"
+#import "PlaceCatalogue.h"
 
 #import <MapKit/MapKit.h>
 
+static const NSUInteger kSearchMaxPlaces = 50;
+
 static inline UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCurve curve) {
 
     // See: http://stackoverflow.com/a/20188994
@@ -132,15 +135,7 @@ static inline UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCu
             view.annotation = annotation;
         }
         
-        if ([annotation isKindOfClass:PlaceOfInterest.class]) {
-            
-            UILabel *detailLabel = (UILabel *)view.detailCalloutAccessoryView;
-            PlaceOfInterest *poi = (PlaceOfInterest *)annotation;
-
-            CLLocationDistance dist = [poi.placemark.location distanceFromLocation:self.currentLocation];
-
-            detailLabel.text = [self.distanceFormatter stringFromDistance:dist];
-        }
+        [self updateDistanceOfAnnotationView:view];
 
         return view;
     }
@@ -148,6 +143,26 @@ static inline UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCu
     return nil;
 }
 
+- (void)mapView:(MKMapView *)mapView didUpdateUserLocation:(MKUserLocation *)userLocation {
+
+    // Only a shown callout needs a current distance
+    // while the user moves with the map open
+    //
+    CLLocation *location = userLocation.location;
+
+    for (id<MKAnnotation> annotation in mapView.selectedAnnotations) {
+
+        if (location == nil || ![annotation isKindOfClass:PlaceOfInterest.class]) continue;
+
+        PlaceOfInterest *poi = (PlaceOfInterest *)annotation;
+        MKAnnotationView *view = [mapView viewForAnnotation:poi];
+
+        poi.distance = [poi.placemark.location distanceFromLocation:location];
+
+        if (view) [self updateDistanceOfAnnotationView:view];
+    }
+}
+
 - (void)mapView:(MKMapView *)mapView annotationView:(MKAnnotationView *)view calloutAccessoryControlTapped:(UIControl *)control {
 
     for (PlaceOfInterest *poi in self.foundPOIs) {
@@ -168,10 +183,29 @@ static inline UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCu
 
 #pragma mark - UISearchBarDelegate protocol
 
+- (void)searchBar:(UISearchBar *)searchBar textDidChange:(NSString *)searchText {
+
+    // The offline catalogue is fast enough to search while typing
+    //
+    PlaceCatalogue *catalogue = [PlaceCatalogue sharedCatalogue];
+
+    if (catalogue.URL && searchText.length > 0) [self searchCatalogue:catalogue text:searchText];
+}
+
 - (void)searchBarSearchButtonClicked:(UISearchBar *)searchBar {
     
     [searchBar resignFirstResponder];
-    
+
+    PlaceCatalogue *catalogue = [PlaceCatalogue sharedCatalogue];
+
+    if (catalogue.URL) {
+
+        [self searchCatalogue:catalogue text:searchBar.text];
+        return;
+    }
+
+    // Without a bundled catalogue fall back to MapKit search
+    //
     MKLocalSearchRequest *request = [[MKLocalSearchRequest alloc] init];
     
     request.naturalLanguageQuery = searchBar.text;
@@ -189,17 +223,13 @@ static inline UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCu
             
             PlaceOfInterest *poi = [PlaceOfInterest placeOfInterestWithPlacemark:item.placemark];
 
-            CLLocationDistance dist = [item.placemark.location distanceFromLocation:self.currentLocation];
-
-            poi.title = [NSString stringWithFormat:@"%@ (%@)", item.name, [self.distanceFormatter stringFromDistance:dist]];
+            poi.title = item.name;
+            poi.distance = [item.placemark.location distanceFromLocation:self.currentLocation];
             
             [places addObject:poi];
         }
 
-        [self.mapView removeAnnotations:[self.mapView annotations]];
-        [self.mapView showAnnotations:places animated:YES];
-        
-        self.foundPOIs = places;
+        [self showPlaces:places];
     }];
 }
 
@@ -208,6 +238,48 @@ static inline UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCu
     [searchBar resignFirstResponder];
 }
 
+#pragma mark - Helpers
+
+- (void)updateDistanceOfAnnotationView:(MKAnnotationView *)view {
+
+    if (![view.annotation isKindOfClass:PlaceOfInterest.class]) return;
+
+    UILabel *detailLabel = (UILabel *)view.detailCalloutAccessoryView;
+    PlaceOfInterest *poi = (PlaceOfInterest *)view.annotation;
+
+    // The distance was computed by the search
+    //
+    detailLabel.text = [self.distanceFormatter stringFromDistance:poi.distance];
+}
+
+- (void)searchCatalogue:(PlaceCatalogue *)catalogue text:(NSString *)text {
+
+    CLLocationCoordinate2D center = self.mapView.region.center;
+    CLLocation *location = self.currentLocation ?: [[CLLocation alloc] initWithLatitude:center.latitude longitude:center.longitude];
+
+    [catalogue searchPlacesMatching:text nearLocation:location maxCount:kSearchMaxPlaces completion:^(NSArray<PlaceOfInterest *> *places) {
+
+        // Ignore results of outdated queries
+        //
+        if (![text isEqualToString:self.searchBar.text]) return;
+
+        [self showPlaces:places];
+    }];
+}
+
+- (void)showPlaces:(NSArray<PlaceOfInterest *> *)places {
+
+    for (PlaceOfInterest *poi in places) {
+
+        poi.title = [NSString stringWithFormat:@"%@ (%@)", poi.title, [self.distanceFormatter stringFromDistance:poi.distance]];
+    }
+
+    [self.mapView removeAnnotations:[self.mapView annotations]];
+    [self.mapView showAnnotations:places animated:YES];
+
+    self.foundPOIs = places;
+}
+
 #pragma mark - Notification handlers
 
 - (void)keyboardWillShow:(NSNotification *)notification {
@@ -0,0 +1,86 @@
+//
+//  TGLARBillboard.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARBillboard.h"
+
+#include <math.h>
+#include <string.h>
+
+static const float kTGLARBillboardEpsilon = 1.0e-6f;
+
+static float TGLARBillboardNormalize(float v[3]) {
+
+    float length = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+
+    if (length > kTGLARBillboardEpsilon) {
+
+        v[0] /= length;
+        v[1] /= length;
+        v[2] /= length;
+    }
+
+    return length;
+}
+
+void TGLARBillboardMatrix(const float position[3], const float camera[3], float matrix[16]) {
+
+    // see http://nehe.gamedev.net/article/billboarding_how_to/18011/
+    //
+    float look[3] = { camera[0] - position[0], camera[1] - position[1], camera[2] - position[2] };
+
+    if (TGLARBillboardNormalize(look) <= kTGLARBillboardEpsilon) {
+
+        look[0] = 1.0f;
+        look[1] = 0.0f;
+        look[2] = 0.0f;
+    }
+
+    // Right is up x look, any horizontal
+    // axis when looking straight up or down
+    //
+    float right[3] = { -look[1], look[0], 0.0f };
+
+    if (TGLARBillboardNormalize(right) <= kTGLARBillboardEpsilon) {
+
+        right[0] = 0.0f;
+        right[1] = 1.0f;
+        right[2] = 0.0f;
+    }
+
+    float up[3] = {
+
+        look[1] * right[2] - look[2] * right[1],
+        look[2] * right[0] - look[0] * right[2],
+        look[0] * right[1] - look[1] * right[0]
+    };
+
+    memset(matrix, 0, 16 * sizeof(float));
+
+    memcpy(matrix + 0, look, sizeof(look));
+    memcpy(matrix + 4, right, sizeof(right));
+    memcpy(matrix + 8, up, sizeof(up));
+
+    matrix[15] = 1.0f;
+}
@@ -0,0 +1,51 @@
+//
+//  TGLARBillboard.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARBillboard_h
+#define TGLARBillboard_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Computes the rotation turning a billboard at a position towards the camera.
+ *
+ * The billboard's X axis points from @p position to @p camera, its Y axis
+ * stays horizontal and its Z axis points upwards as far as possible. Both
+ * positions must be given in the same coordinate system, e.g. relative to
+ * the floating origin of a @p TGLARView.
+ *
+ * @param position The X/Y/Z position of the billboard.
+ * @param camera The X/Y/Z position of the camera.
+ * @param matrix Receives the column-major 4x4 rotation matrix. Its layout
+ *        matches @p GLKMatrix4, its translation is zero.
+ */
+void TGLARBillboardMatrix(const float position[3], const float camera[3], float matrix[16]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARBillboard_h */
@@ -25,7 +25,7 @@
 
 #import "TGLARImageShape.h"
 
-/// A @p TGLARImageShape automatically rotating towards the camera around its origin.
+/// A @p TGLARImageShape automatically rotating towards the @p -cameraPosition around its origin.
 @interface TGLARBillboardImageShape : TGLARImageShape
 
 /** Disables billboard transformation. Default is NO. */
@@ -24,34 +24,29 @@
 //  THE SOFTWARE.
 
 #import "TGLARBillboardImageShape.h"
+#import "TGLARBillboard.h"
 
 @implementation TGLARBillboardImageShape
 
-- (BOOL)draw {
+#pragma mark - Accessors
 
-    if (self.locked) return [super draw];
+- (GLKMatrix4)drawingTransform {
 
-    // Compute billboard transform and
-    // replace shape transform temporarily
-    // for drawing
-    //
-    // see http://nehe.gamedev.net/article/billboarding_how_to/18011/
-    //
-    GLKVector3 pos = self.overlay.targetPosition;
-    GLKVector3 look = GLKVector3Normalize(GLKVector3Negate(pos));
-    GLKVector3 right = GLKVector3CrossProduct(GLKVector3Make(0, 0, 1), look);
-    GLKVector3 up = GLKVector3CrossProduct(look, right);
-    
-    GLKMatrix4 billboard = GLKMatrix4Make(look.x, look.y, look.z, 0.0, right.x, right.y, right.z, 0.0, up.x, up.y, up.z, 0.0, pos.x, pos.y, pos.z, 1.0);
-    GLKMatrix4 transform = self.transform;
+    if (self.locked) return self.transform;
 
-    self.transform = GLKMatrix4Multiply(billboard, transform);
+    // Compute billboard rotation towards the camera,
+    // which is not at the origin once positions are
+    // relative to a floating origin, and apply it to
+    // the shape transform for drawing
+    //
+    GLKVector3 targetPosition = self.targetPosition;
+    GLKVector3 cameraPosition = self.cameraPosition;
 
-    BOOL ok = [super draw];
+    GLKMatrix4 billboard;
 
-    self.transform = transform;
+    TGLARBillboardMatrix(targetPosition.v, cameraPosition.v, billboard.m);
 
-    return ok;
+    return GLKMatrix4Multiply(billboard, self.transform);
 }
 
 @end
@@ -0,0 +1,61 @@
+//
+//  TGLARFloatingOrigin.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARFloatingOrigin.h"
+
+#include <math.h>
+
+double TGLARWorldPositionDistance(TGLARWorldPosition a, TGLARWorldPosition b) {
+
+    double dx = a.x - b.x;
+    double dy = a.y - b.y;
+    double dz = a.z - b.z;
+
+    return sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+int TGLARFloatingOriginShouldRebase(TGLARWorldPosition origin, TGLARWorldPosition camera, double threshold) {
+
+    return TGLARWorldPositionDistance(origin, camera) > threshold;
+}
+
+void TGLARFloatingOriginRebase(const TGLARWorldPosition *positions, size_t count, TGLARWorldPosition origin, float *targetPositions) {
+
+    // Treat the input as a flat array of doubles
+    // with no dependencies between iterations, so
+    // the compiler is free to vectorize the loop
+    //
+    const double *src = (const double *)positions;
+    const double ox = origin.x;
+    const double oy = origin.y;
+    const double oz = origin.z;
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        targetPositions[3 * idx + 0] = (float)(src[3 * idx + 0] - ox);
+        targetPositions[3 * idx + 1] = (float)(src[3 * idx + 1] - oy);
+        targetPositions[3 * idx + 2] = (float)(src[3 * idx + 2] - oz);
+    }
+}
@@ -0,0 +1,79 @@
+//
+//  TGLARFloatingOrigin.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARFloatingOrigin_h
+#define TGLARFloatingOrigin_h
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A double precision X/Y/Z position in meters.
+ *
+ * Uses the same axes as @p -[TGLAROverlay targetPosition], but
+ * relative to a fixed world reference point instead of the camera.
+ */
+typedef struct {
+
+    double x;
+    double y;
+    double z;
+
+} TGLARWorldPosition;
+
+static inline TGLARWorldPosition TGLARWorldPositionMake(double x, double y, double z) {
+
+    TGLARWorldPosition position = { x, y, z };
+
+    return position;
+}
+
+/// Returns the distance in meters between two world positions.
+double TGLARWorldPositionDistance(TGLARWorldPosition a, TGLARWorldPosition b);
+
+/// Returns non-zero if @p camera is farther than @p threshold meters away from @p origin.
+int TGLARFloatingOriginShouldRebase(TGLARWorldPosition origin, TGLARWorldPosition camera, double threshold);
+
+/** Converts world positions to single precision positions relative to an origin.
+ *
+ * The subtraction is carried out in double precision before
+ * rounding, so positions near the origin keep full precision
+ * regardless of their distance to the world reference point.
+ *
+ * @param positions An array of @p count world positions.
+ * @param count The number of positions to convert.
+ * @param origin The floating origin to subtract.
+ * @param targetPositions An array of @p 3 * @p count floats receiving the
+ *        X/Y/Z components. Its layout matches an array of @p GLKVector3.
+ */
+void TGLARFloatingOriginRebase(const TGLARWorldPosition *positions, size_t count, TGLARWorldPosition origin, float *targetPositions);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARFloatingOrigin_h */
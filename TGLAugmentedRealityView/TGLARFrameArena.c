@@ -0,0 +1,127 @@
+//
+//  TGLARFrameArena.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARFrameArena.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct TGLARFrameArenaOverflow {
+
+    struct TGLARFrameArenaOverflow *next;
+
+} TGLARFrameArenaOverflow;
+
+static size_t TGLARFrameArenaAlign(size_t offset, size_t alignment) {
+
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+void TGLARFrameArenaInit(TGLARFrameArena *arena, size_t capacity) {
+
+    arena->block = (capacity > 0) ? malloc(capacity) : NULL;
+    arena->capacity = arena->block ? capacity : 0;
+    arena->used = 0;
+    arena->peak = 0;
+    arena->overflow = NULL;
+}
+
+static void TGLARFrameArenaFreeOverflow(TGLARFrameArena *arena) {
+
+    TGLARFrameArenaOverflow *overflow = arena->overflow;
+
+    while (overflow) {
+
+        TGLARFrameArenaOverflow *next = overflow->next;
+
+        free(overflow);
+        overflow = next;
+    }
+
+    arena->overflow = NULL;
+}
+
+void TGLARFrameArenaDestroy(TGLARFrameArena *arena) {
+
+    TGLARFrameArenaFreeOverflow(arena);
+
+    free(arena->block);
+
+    arena->block = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+    arena->peak = 0;
+}
+
+void *TGLARFrameArenaAlloc(TGLARFrameArena *arena, size_t size, size_t alignment) {
+
+    if (alignment == 0) alignment = sizeof(void *);
+
+    size_t offset = TGLARFrameArenaAlign(arena->used, alignment);
+
+    // Account for the worst case alignment padding, so
+    // the grown block is sure to fit the whole frame
+    //
+    arena->peak += size + alignment - 1;
+
+    if (arena->block && offset + size <= arena->capacity) {
+
+        arena->used = offset + size;
+
+        return arena->block + offset;
+    }
+
+    size_t header = TGLARFrameArenaAlign(sizeof(TGLARFrameArenaOverflow), alignment);
+    TGLARFrameArenaOverflow *overflow = malloc(header + size);
+
+    if (overflow == NULL) return NULL;
+
+    overflow->next = arena->overflow;
+    arena->overflow = overflow;
+
+    return (unsigned char *)overflow + header;
+}
+
+void TGLARFrameArenaReset(TGLARFrameArena *arena) {
+
+    if (arena->overflow) {
+
+        TGLARFrameArenaFreeOverflow(arena);
+
+        if (arena->peak > arena->capacity) {
+
+            unsigned char *block = realloc(arena->block, arena->peak);
+
+            if (block) {
+
+                arena->block = block;
+                arena->capacity = arena->peak;
+            }
+        }
+    }
+
+    arena->used = 0;
+    arena->peak = 0;
+}
@@ -0,0 +1,74 @@
+//
+//  TGLARFrameArena.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARFrameArena_h
+#define TGLARFrameArena_h
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A resettable bump allocator for per-frame scratch data.
+ *
+ * Allocations are served from a single block and released all
+ * at once by @p TGLARFrameArenaReset. Requests not fitting into
+ * the block are served from overflow blocks, and the next reset
+ * grows the block to the peak usage of the previous frame. Thus
+ * frames with steady memory needs do not touch the heap at all.
+ */
+typedef struct {
+
+    unsigned char *block;
+    size_t capacity;
+    size_t used;
+    size_t peak;
+    void *overflow;
+
+} TGLARFrameArena;
+
+/// Initializes an arena with an initial block of @p capacity bytes.
+void TGLARFrameArenaInit(TGLARFrameArena *arena, size_t capacity);
+
+/// Releases all memory held by the arena.
+void TGLARFrameArenaDestroy(TGLARFrameArena *arena);
+
+/** Allocates @p size bytes aligned to @p alignment, which must be a power of two.
+ *
+ * The memory stays valid until the next call to @p TGLARFrameArenaReset.
+ *
+ * @return A pointer to the allocated memory or @p NULL if the system is out of memory.
+ */
+void *TGLARFrameArenaAlloc(TGLARFrameArena *arena, size_t size, size_t alignment);
+
+/// Releases all allocations and grows the block if the last frame needed overflow memory.
+void TGLARFrameArenaReset(TGLARFrameArena *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARFrameArena_h */
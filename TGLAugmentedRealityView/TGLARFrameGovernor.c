@@ -0,0 +1,163 @@
+//
+//  TGLARFrameGovernor.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARFrameGovernor.h"
+
+#include <math.h>
+#include <string.h>
+
+// Display intervals up to this factor of the
+// budget are jitter, not missed refreshes
+//
+static const double kTGLARMissedRefreshFactor = 1.5;
+
+// Cheap knobs are turned first, halving the
+// frame rate is the last resort
+//
+static const TGLARQualitySettings kTGLARQualityLevels[TGLAR_QUALITY_LEVELS] = {
+
+    { UINT32_MAX, 1.00f, 1, 1, 1 },
+    { 64,         1.00f, 2, 2, 1 },
+    { 32,         0.50f, 2, 3, 1 },
+    { 16,         0.50f, 4, 4, 1 },
+    { 16,         0.25f, 4, 6, 2 },
+    { 8,          0.25f, 8, 8, 2 }
+};
+
+void TGLARFrameGovernorInit(TGLARFrameGovernor *governor, double targetFrameTime) {
+
+    memset(governor, 0, sizeof(TGLARFrameGovernor));
+
+    governor->targetFrameTime = (targetFrameTime > 0.0) ? targetFrameTime : 1.0 / 60.0;
+    governor->smoothing = 0.1;
+    governor->upperThreshold = 1.0;
+    governor->lowerThreshold = 0.6;
+    governor->degradeFrames = 10;
+    governor->improveFrames = 60;
+    governor->maxImproveFrames = 960;
+
+    governor->improveDelay = governor->improveFrames;
+}
+
+double TGLARFrameGovernorBudget(const TGLARFrameGovernor *governor, uint32_t level) {
+
+    return governor->targetFrameTime * TGLARQualitySettingsForLevel(level).frameInterval;
+}
+
+uint32_t TGLARFrameGovernorFrameInterval(const TGLARFrameGovernor *governor, uint32_t level, double refreshPeriod) {
+
+    double refreshes = (refreshPeriod > 0.0) ? round(governor->targetFrameTime / refreshPeriod) : 1.0;
+    uint32_t baseInterval = (refreshes > 1.0) ? (uint32_t)refreshes : 1;
+
+    return baseInterval * TGLARQualitySettingsForLevel(level).frameInterval;
+}
+
+TGLARQualitySettings TGLARQualitySettingsForLevel(uint32_t level) {
+
+    return kTGLARQualityLevels[(level < TGLAR_QUALITY_LEVELS) ? level : TGLAR_QUALITY_LEVELS - 1];
+}
+
+int TGLARFrameGovernorUpdate(TGLARFrameGovernor *governor, double frameTime, double displayInterval) {
+
+    double budget = TGLARFrameGovernorBudget(governor, governor->level);
+    double betterBudget = (governor->level > 0) ? TGLARFrameGovernorBudget(governor, governor->level - 1) : budget;
+
+    // The first interval after a level change may still
+    // have the previous frame rate and is not counted
+    //
+    if (governor->framesSinceChange > 0 && displayInterval > kTGLARMissedRefreshFactor * budget && displayInterval > frameTime) {
+
+        frameTime = displayInterval;
+    }
+
+    // The average restarts at a new level, so costs of
+    // the previous one do not push it further down
+    //
+    if (governor->framesSinceChange == 0 && governor->averageFrameTime == 0.0) {
+
+        governor->averageFrameTime = frameTime;
+
+    } else {
+
+        governor->averageFrameTime += governor->smoothing * (frameTime - governor->averageFrameTime);
+    }
+
+    if (governor->framesSinceChange < UINT32_MAX) governor->framesSinceChange++;
+
+    if (governor->averageFrameTime > governor->upperThreshold * budget) {
+
+        governor->overBudgetFrames++;
+        governor->underBudgetFrames = 0;
+
+    } else if (governor->averageFrameTime < governor->lowerThreshold * betterBudget) {
+
+        governor->underBudgetFrames++;
+        governor->overBudgetFrames = 0;
+
+    } else {
+
+        governor->overBudgetFrames = 0;
+        governor->underBudgetFrames = 0;
+    }
+
+    if (governor->overBudgetFrames >= governor->degradeFrames && governor->level + 1 < TGLAR_QUALITY_LEVELS) {
+
+        // Back off if the last raise did not hold
+        //
+        if (governor->lastChangeImproved && governor->framesSinceChange < governor->improveDelay) {
+
+            governor->improveDelay *= 2;
+
+            if (governor->improveDelay > governor->maxImproveFrames) governor->improveDelay = governor->maxImproveFrames;
+        }
+
+        governor->level++;
+        governor->lastChangeImproved = 0;
+        governor->overBudgetFrames = 0;
+        governor->underBudgetFrames = 0;
+        governor->framesSinceChange = 0;
+        governor->averageFrameTime = 0.0;
+
+        return 1;
+    }
+
+    if (governor->underBudgetFrames >= governor->improveDelay && governor->level > 0) {
+
+        governor->level--;
+        governor->lastChangeImproved = 1;
+        governor->overBudgetFrames = 0;
+        governor->underBudgetFrames = 0;
+        governor->framesSinceChange = 0;
+        governor->averageFrameTime = 0.0;
+
+        return -1;
+    }
+
+    // A level held long enough resets the back off
+    //
+    if (governor->framesSinceChange >= governor->maxImproveFrames) governor->improveDelay = governor->improveFrames;
+
+    return 0;
+}
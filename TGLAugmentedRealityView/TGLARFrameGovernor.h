@@ -0,0 +1,120 @@
+//
+//  TGLARFrameGovernor.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARFrameGovernor_h
+#define TGLARFrameGovernor_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The number of quality levels, level @p 0 being full quality.
+#define TGLAR_QUALITY_LEVELS 6
+
+/// The rendering settings of a quality level.
+typedef struct {
+
+    /// Maximum number of overlay views shown at once.
+    uint32_t maxVisibleLabels;
+    /// Scale applied to projected shape sizes when selecting levels of detail.
+    float detailScale;
+    /// Callout lengths are adjusted every n-th layout pass.
+    uint32_t calloutInterval;
+    /// The compass is updated every n-th frame.
+    uint32_t compassInterval;
+    /// Multiplier of the display link frame interval needed for the target frame time.
+    uint32_t frameInterval;
+
+} TGLARQualitySettings;
+
+/** A control loop selecting a quality level to hold a frame time budget.
+ *
+ * The cost of a frame is the CPU time spent on it, unless the display
+ * interval shows missed refreshes. Then the frame costs the time it was
+ * actually shown, which also covers GPU and compositor load the CPU time
+ * does not see. Frame costs are smoothed by an exponential moving average,
+ * which restarts at every level change.
+ *
+ * Quality is lowered after @p degradeFrames consecutive frames above
+ * @p upperThreshold times the budget, and raised after @p improveFrames
+ * consecutive frames below @p lowerThreshold times the budget of the next
+ * better level. If a raise is followed by a drop within the waiting period,
+ * the waiting period is doubled, so quality does not oscillate at a load
+ * boundary.
+ */
+typedef struct {
+
+    double targetFrameTime;
+    double smoothing;
+    double upperThreshold;
+    double lowerThreshold;
+    uint32_t degradeFrames;
+    uint32_t improveFrames;
+    uint32_t maxImproveFrames;
+
+    double averageFrameTime;
+    uint32_t level;
+    uint32_t overBudgetFrames;
+    uint32_t underBudgetFrames;
+    uint32_t framesSinceChange;
+    uint32_t improveDelay;
+    int lastChangeImproved;
+
+} TGLARFrameGovernor;
+
+/// Initializes a governor at full quality for a target frame time in seconds.
+void TGLARFrameGovernorInit(TGLARFrameGovernor *governor, double targetFrameTime);
+
+/** Feeds the cost of a frame to the governor.
+ *
+ * @param frameTime The CPU time in seconds spent on the frame.
+ * @param displayInterval The time in seconds between the display timestamps of this frame and the previous one, or @p 0 if unknown.
+ *
+ * @return @p +1 if quality was lowered, @p -1 if it was raised, @p 0 otherwise.
+ */
+int TGLARFrameGovernorUpdate(TGLARFrameGovernor *governor, double frameTime, double displayInterval);
+
+/// Returns the budget of a quality level in seconds, which grows with its frame interval.
+double TGLARFrameGovernorBudget(const TGLARFrameGovernor *governor, uint32_t level);
+
+/** Returns the number of display refreshes per frame at a quality level.
+ *
+ * The interval holds the target frame time at level @p 0, e.g. @p 2 for a
+ * target of 1/30 s on a 60 Hz display, and is multiplied at lower levels.
+ *
+ * @param refreshPeriod The display refresh period in seconds.
+ */
+uint32_t TGLARFrameGovernorFrameInterval(const TGLARFrameGovernor *governor, uint32_t level, double refreshPeriod);
+
+/// Returns the rendering settings of a quality level.
+TGLARQualitySettings TGLARQualitySettingsForLevel(uint32_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARFrameGovernor_h */
@@ -0,0 +1,73 @@
+//
+//  TGLARFramebuffer.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <GLKit/GLKit.h>
+
+/** An offscreen OpenGL ES render target with RGBA8 color and 16 bit depth buffers.
+ *
+ * Used by @p TGLARView for picking shapes and for rendering
+ * snapshots independent of the on-screen @p GLKView.
+ */
+@interface TGLARFramebuffer : NSObject
+
+/// The framebuffer's OpenGL ES context.
+@property (nonatomic, weak, readonly, nullable) EAGLContext *context;
+
+/// Framebuffer width in pixels.
+@property (nonatomic, readonly) GLsizei width;
+/// Framebuffer height in pixels.
+@property (nonatomic, readonly) GLsizei height;
+
+/** Designated initializer.
+ *
+ * @param context OpenGL ES context to create the framebuffer in.
+ * @param width Framebuffer width in pixels.
+ * @param height Framebuffer height in pixels.
+ *
+ * @return An initialized instance or nil if the framebuffer is incomplete.
+ */
+- (nullable instancetype)initWithContext:(nonnull EAGLContext *)context width:(GLsizei)width height:(GLsizei)height;
+
+/// Binds the framebuffer and sets the viewport to its size.
+- (void)bind;
+
+/** Reads pixels from the bound framebuffer.
+ *
+ * Rows are returned bottom up as stored by OpenGL ES.
+ *
+ * @param pixels A buffer of at least @p width * @p height * 4 bytes.
+ */
+- (void)readPixels:(nonnull void *)pixels;
+
+/** Reads a single RGBA pixel from the bound framebuffer.
+ *
+ * @param x Pixel column from the left.
+ * @param y Pixel row from the bottom.
+ * @param pixel A buffer of 4 bytes.
+ */
+- (void)readPixelAtX:(GLint)x y:(GLint)y into:(nonnull GLubyte *)pixel;
+
+@end
@@ -0,0 +1,110 @@
+//
+//  TGLARFramebuffer.m
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "TGLARFramebuffer.h"
+
+#import <OpenGLES/ES2/glext.h>
+
+@interface TGLARFramebuffer () {
+
+    GLuint _framebuffer;
+    GLuint _colorRenderbuffer;
+    GLuint _depthRenderbuffer;
+}
+
+@end
+
+@implementation TGLARFramebuffer
+
+- (instancetype)initWithContext:(EAGLContext *)context width:(GLsizei)width height:(GLsizei)height {
+
+    self = [super init];
+
+    if (self) {
+
+        _context = context;
+        _width = width;
+        _height = height;
+
+        [EAGLContext setCurrentContext:context];
+
+        glGenFramebuffers(1, &_framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+
+        glGenRenderbuffers(1, &_colorRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, _colorRenderbuffer);
+
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _colorRenderbuffer);
+
+        glGenRenderbuffers(1, &_depthRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, _depthRenderbuffer);
+
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, _depthRenderbuffer);
+
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+
+            NSLog(@"%s Framebuffer status: %x", __PRETTY_FUNCTION__, (int)status);
+            return nil;
+        }
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    if (self.context) {
+
+        [EAGLContext setCurrentContext:self.context];
+
+        glDeleteRenderbuffers(1, &_depthRenderbuffer);
+        glDeleteRenderbuffers(1, &_colorRenderbuffer);
+        glDeleteFramebuffers(1, &_framebuffer);
+    }
+}
+
+#pragma mark - Methods
+
+- (void)bind {
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    glViewport(0, 0, self.width, self.height);
+}
+
+- (void)readPixels:(void *)pixels {
+
+    glReadPixels(0, 0, self.width, self.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+}
+
+- (void)readPixelAtX:(GLint)x y:(GLint)y into:(GLubyte *)pixel {
+
+    glReadPixels(x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+}
+
+@end
@@ -39,10 +39,14 @@
 - (nullable instancetype)initWithContext:(nonnull EAGLContext *)context size:(CGSize)size image:(nullable UIImage *)image;
 
 /** Set the shape's texture image.
+ *
+ * The image is decoded asynchronously by the shared @p TGLARTextureStreamer.
+ * The shape is not drawn until its texture becomes resident. The texture
+ * resolution follows the shape's size on screen.
  *
  * @param image The Image to apply as shape's texture.
  *
- * @return YES on success, NO if texture loading fails.
+ * @return YES on success, NO if the image has no bitmap data to be decoded.
  */
 - (BOOL)setImage:(nullable UIImage *)image;
 
@@ -24,37 +24,16 @@
 //  THE SOFTWARE.
 
 #import "TGLARImageShape.h"
-
-// GL data
-//
-typedef struct {
-    
-    float Position[3];
-    float Texture[2];
-    float Normal[3];
-    
-} Vertex;
-
-static const Vertex Vertices[] = {
-    
-    { { 0, +1, -1 }, { 1, 1 }, { 1, 0, 0 } },
-    { { 0, +1, +1 }, { 1, 0 }, { 1, 0, 0 } },
-    { { 0, -1, +1 }, { 0, 0 }, { 1, 0, 0 } },
-    { { 0, -1, -1 }, { 0, 1 }, { 1, 0, 0 } }
-};
-
-static const GLubyte Indices[] = { 0, 1, 2, 2, 3, 0 };
-
-static GLuint indexBuffer = 0;
-static NSUInteger bufferCount = 0;
+#import "TGLARTextureStreamer.h"
 
 @interface TGLARImageShape () {
     
-    GLuint _vertexBuffer;
-    GLuint _indexBuffer;
+    TGLARShapeGeometry _geometry;
+
+    CGSize _size;
 };
 
-@property (strong, nonatomic) GLKTextureInfo *textureInfo;
+@property (strong, nonatomic) TGLARStreamedTexture *texture;
 
 @end
 
@@ -66,43 +45,11 @@ static NSUInteger bufferCount = 0;
     
     if (self) {
 
-        self.effect.constantColor = GLKVector4Make(1.0, 1.0, 1.0, 1.0);
-        
+        _size = size;
+
         self.image = image;
         
-        float w2 = 0.5 * size.width;
-        float h2 = 0.5 * size.height;
-        
-        static Vertex bgVertices[4];
-        
-        for (NSUInteger idx = 0; idx < 4; idx++) {
-            
-            bgVertices[idx].Position[0] = Vertices[idx].Position[0];
-            bgVertices[idx].Position[1] = Vertices[idx].Position[1] * w2;
-            bgVertices[idx].Position[2] = Vertices[idx].Position[2] * h2;
-            
-            bgVertices[idx].Texture[0] = Vertices[idx].Texture[0];
-            bgVertices[idx].Texture[1] = Vertices[idx].Texture[1];
-            
-            bgVertices[idx].Normal[0] = Vertices[idx].Normal[0];
-            bgVertices[idx].Normal[1] = Vertices[idx].Normal[1];
-            bgVertices[idx].Normal[2] = Vertices[idx].Normal[2];
-        }
-        
-        glGenBuffers(1, &_vertexBuffer);
-        glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(bgVertices), bgVertices, GL_STATIC_DRAW);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        
-        if (indexBuffer == 0) {
-            
-            glGenBuffers(1, &indexBuffer);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(Indices), Indices, GL_STATIC_DRAW);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-        }
-        
-        ++bufferCount;
+        if (!TGLARShapeGeometryInitQuad(&_geometry, size.width, size.height)) return nil;
     }
     
     return self;
@@ -116,15 +63,7 @@ static NSUInteger bufferCount = 0;
         
         [self freeImage];
 
-        glDeleteBuffers(1, &_vertexBuffer); _vertexBuffer = 0;
-        
-        if (bufferCount > 0) --bufferCount;
-        
-        if (bufferCount == 0) {
-            
-            glDeleteBuffers(1, &indexBuffer);
-            indexBuffer = 0;
-        }
+        TGLARShapeGeometryDestroy(&_geometry);
     }
 }
 
@@ -138,112 +77,72 @@ static NSUInteger bufferCount = 0;
     
     if (image == nil) return YES;
     
-    NSError *error = nil;
-    
-    GLKTextureInfo *textureInfo = [GLKTextureLoader textureWithCGImage:image.CGImage options:nil error:&error];
-    
-    if (textureInfo) {
-        
-        self.textureInfo = textureInfo;
-        
-        self.effect.texture2d0.name = self.textureInfo.name;
-        self.effect.texture2d0.target = self.textureInfo.target;
-        self.effect.texture2d0.envMode = GLKTextureEnvModeReplace;
-        self.effect.texture2d0.enabled = GL_TRUE;
-        
-        return YES;
-        
-    } else {
-        
-        NSLog(@"%s Texture image could not be loaded: %@", __PRETTY_FUNCTION__, error.localizedDescription);
-        
-        self.effect.texture2d0.enabled = GL_FALSE;
-        
+    // Decoding happens asynchronously. The shape
+    // is not drawn until its texture is resident
+    //
+    self.texture = [[TGLARTextureStreamer sharedStreamer] textureWithImage:image context:self.context];
+
+    if (self.texture == nil) {
+
+        NSLog(@"%s Texture image could not be loaded: No bitmap data", __PRETTY_FUNCTION__);
+
         return NO;
     }
+
+    return YES;
+}
+
+- (void)requestResources {
+
+    if (self.texture) [self.texture requestProjectedSize:self.projectedSize * self.detailScale];
 }
 
 - (BOOL)draw {
     
-    if (![super draw]) return NO;
-    
-    glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
-    glEnableVertexAttribArray(GLKVertexAttribPosition);
-    glVertexAttribPointer(GLKVertexAttribPosition, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const GLvoid *)offsetof(Vertex, Position));
-    glEnableVertexAttribArray(GLKVertexAttribTexCoord0);
-    glVertexAttribPointer(GLKVertexAttribTexCoord0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const GLvoid *)offsetof(Vertex, Texture));
-    glEnableVertexAttribArray(GLKVertexAttribNormal);
-    glVertexAttribPointer(GLKVertexAttribNormal, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const GLvoid *)offsetof(Vertex, Normal));
-    
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
-    
-    glDrawElements(GL_TRIANGLES, sizeof(Indices)/sizeof(Indices[0]), GL_UNSIGNED_BYTE, 0);
-    
-    glDisableVertexAttribArray(GLKVertexAttribTexCoord0);
-    glDisableVertexAttribArray(GLKVertexAttribNormal);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (!self.drawingConstantColor && self.texture) {
 
-    return YES;
-}
+        [self requestResources];
 
-- (BOOL)drawUsingConstantColor:(GLKVector4)color {
+        if (self.texture.name == 0) return (self.context != nil);
 
-    GLKVector4 constantColor = self.effect.constantColor;
-    GLboolean useConstantColor = self.effect.useConstantColor;
-    GLboolean texture2d0Enabled = self.effect.texture2d0.enabled;
-    
-    self.effect.constantColor = color;
-    self.effect.useConstantColor = GL_TRUE;
-    self.effect.texture2d0.enabled = GL_FALSE;
-    
-    BOOL ok = [super drawUsingConstantColor:color];
-    
-    if (ok) {
-        
-        glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
-        glEnableVertexAttribArray(GLKVertexAttribPosition);
-        glVertexAttribPointer(GLKVertexAttribPosition, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const GLvoid *)offsetof(Vertex, Position));
-        glEnableVertexAttribArray(GLKVertexAttribNormal);
-        glVertexAttribPointer(GLKVertexAttribNormal, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const GLvoid *)offsetof(Vertex, Normal));
-        
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
-        
-        glDrawElements(GL_TRIANGLES, sizeof(Indices)/sizeof(Indices[0]), GL_UNSIGNED_BYTE, 0);
-        
-        glDisableVertexAttribArray(GLKVertexAttribNormal);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        self.material->texture = self.texture.name;
+        self.material->textureMode = TGLARShapeTextureModeReplace;
     }
+
+    if (![super draw]) return NO;
     
-    self.effect.texture2d0.enabled = texture2d0Enabled;
-    self.effect.useConstantColor = useConstantColor;
-    self.effect.constantColor = constantColor;
-    
-    return ok;
+    TGLARShapeGeometryDraw(&_geometry, 0, _geometry.indexCount);
+
+    return YES;
 }
 
 #pragma mark - Helpers
 
+- (float)projectedSize {
+
+    // Approximate the shape's on-screen size in pixels
+    // from its distance to the camera along the view axis
+    //
+    GLKVector3 eyePosition = GLKMatrix4MultiplyVector3WithTranslation(self.modelviewMatrix, GLKVector3Make(0.0, 0.0, 0.0));
+
+    float distance = -eyePosition.z;
+
+    if (distance <= 0.0) return 0.0;
+
+    float extent = MAX(_size.width, _size.height);
+
+    return extent * self.projectionMatrix.m11 * 0.5 * self.viewportSize.height / distance;
+}
+
 - (void)freeImage {
     
-    if (self.textureInfo) {
-        
-        // KLUDGE: Get rid of previous texture memory,
-        //         but there seems to be no official
-        //         way to release a GLKTextureInfo
-        //         allocated by GLKTextureLoader...
-        //
-        // See: http://stackoverflow.com/a/8720298
-        //
-        GLuint name = self.textureInfo.name;
-        
-        glDeleteTextures(1, &name);
-        
-        self.textureInfo = nil;
-    }
+    // A shared texture deletes its GL name as soon
+    // as no more shapes are using it
+    //
+    self.texture = nil;
     
-    self.effect.texture2d0.enabled = GL_FALSE;
+    self.material->texture = 0;
+    self.material->textureMode = TGLARShapeTextureModeNone;
 }
 
 @end
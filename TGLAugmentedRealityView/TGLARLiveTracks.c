@@ -0,0 +1,291 @@
+//
+//  TGLARLiveTracks.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARLiveTracks.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Samples are drained in batches of this size,
+// so draining does not depend on queue capacity
+//
+static const uint32_t kTGLARLiveDrainCount = 1024;
+
+static void TGLARLiveTrackPredict(const TGLARLiveTrack *track, double time, double maxExtrapolation, double position[3]) {
+
+    const TGLARLiveSample *latest = &track->latest;
+
+    if (track->sampleCount > 1 && time < latest->timestamp) {
+
+        // Cubic Hermite spline matching positions
+        // and velocities at both samples
+        //
+        const TGLARLiveSample *previous = &track->previous;
+
+        double duration = latest->timestamp - previous->timestamp;
+        double s = fmax((time - previous->timestamp) / duration, 0.0);
+        double s2 = s * s;
+        double s3 = s2 * s;
+
+        double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+        double h10 = (s3 - 2.0 * s2 + s) * duration;
+        double h01 = -2.0 * s3 + 3.0 * s2;
+        double h11 = (s3 - s2) * duration;
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            position[axis] = h00 * previous->position[axis] + h10 * previous->velocity[axis] + h01 * latest->position[axis] + h11 * latest->velocity[axis];
+        }
+
+        return;
+    }
+
+    double elapsed = fmin(fmax(time - latest->timestamp, 0.0), maxExtrapolation);
+
+    for (int axis = 0; axis < 3; axis++) {
+
+        position[axis] = latest->position[axis] + latest->velocity[axis] * elapsed;
+    }
+}
+
+static void TGLARLiveIntegratorApply(TGLARLiveIntegrator *integrator, const TGLARLiveSample *sample) {
+
+    if (sample->track >= integrator->trackCount) return;
+
+    TGLARLiveTrack *track = &integrator->tracks[sample->track];
+
+    if (track->sampleCount == 0) {
+
+        integrator->activeTracks[integrator->activeCount++] = sample->track;
+
+        track->latest = *sample;
+        track->sampleCount = 1;
+
+        return;
+    }
+
+    if (!(sample->timestamp > track->latest.timestamp)) return;
+
+    track->previous = track->latest;
+    track->latest = *sample;
+    track->sampleCount = 2;
+
+    // Keep the position shown last and blend
+    // out the difference to the new path
+    //
+    if (track->outputValid) {
+
+        double predicted[3];
+        double distance = 0.0;
+
+        TGLARLiveTrackPredict(track, track->outputTime - integrator->interpolationDelay, integrator->maxExtrapolation, predicted);
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            track->offset[axis] = track->output[axis] - predicted[axis];
+
+            distance += track->offset[axis] * track->offset[axis];
+        }
+
+        if (sqrt(distance) > integrator->snapDistance) memset(track->offset, 0, sizeof(track->offset));
+
+        track->offsetTime = track->outputTime;
+    }
+}
+
+int TGLARLiveQueueInit(TGLARLiveQueue *queue, uint32_t capacity) {
+
+    memset(queue, 0, sizeof(TGLARLiveQueue));
+
+    queue->capacity = 16;
+
+    while (queue->capacity < capacity && queue->capacity < (1u << 31)) queue->capacity *= 2;
+
+    queue->samples = malloc(queue->capacity * sizeof(TGLARLiveSample));
+
+    return (queue->samples != NULL);
+}
+
+void TGLARLiveQueueDestroy(TGLARLiveQueue *queue) {
+
+    free(queue->samples);
+
+    memset(queue, 0, sizeof(TGLARLiveQueue));
+}
+
+int TGLARLiveQueuePush(TGLARLiveQueue *queue, const TGLARLiveSample *sample) {
+
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= queue->capacity) {
+
+        __atomic_fetch_add(&queue->droppedCount, 1, __ATOMIC_RELAXED);
+
+        return 0;
+    }
+
+    queue->samples[head & (queue->capacity - 1)] = *sample;
+
+    // Publishes the sample to the consumer
+    //
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+
+    return 1;
+}
+
+uint32_t TGLARLiveQueuePop(TGLARLiveQueue *queue, TGLARLiveSample *samples, uint32_t maxCount) {
+
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+    uint32_t count = head - tail;
+
+    if (count > maxCount) count = maxCount;
+
+    uint32_t first = tail & (queue->capacity - 1);
+    uint32_t firstCount = queue->capacity - first;
+
+    if (firstCount > count) firstCount = count;
+
+    memcpy(samples, queue->samples + first, firstCount * sizeof(TGLARLiveSample));
+    memcpy(samples + firstCount, queue->samples, (count - firstCount) * sizeof(TGLARLiveSample));
+
+    // Hands the slots back to the producer
+    //
+    __atomic_store_n(&queue->tail, tail + count, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+uint64_t TGLARLiveQueueDroppedCount(const TGLARLiveQueue *queue) {
+
+    return __atomic_load_n(&queue->droppedCount, __ATOMIC_RELAXED);
+}
+
+int TGLARLiveIntegratorInit(TGLARLiveIntegrator *integrator) {
+
+    memset(integrator, 0, sizeof(TGLARLiveIntegrator));
+
+    integrator->interpolationDelay = 0.0;
+    integrator->maxExtrapolation = 1.0;
+    integrator->smoothingTime = 0.2;
+    integrator->snapDistance = 50.0;
+
+    integrator->drainCapacity = kTGLARLiveDrainCount;
+    integrator->drainBuffer = malloc(integrator->drainCapacity * sizeof(TGLARLiveSample));
+
+    return (integrator->drainBuffer != NULL);
+}
+
+void TGLARLiveIntegratorDestroy(TGLARLiveIntegrator *integrator) {
+
+    free(integrator->tracks);
+    free(integrator->activeTracks);
+    free(integrator->drainBuffer);
+
+    memset(integrator, 0, sizeof(TGLARLiveIntegrator));
+}
+
+int TGLARLiveIntegratorSetTrackCount(TGLARLiveIntegrator *integrator, uint32_t trackCount) {
+
+    if (trackCount > integrator->trackCount) {
+
+        TGLARLiveTrack *tracks = realloc(integrator->tracks, trackCount * sizeof(TGLARLiveTrack));
+
+        if (tracks == NULL) return 0;
+
+        integrator->tracks = tracks;
+
+        uint32_t *activeTracks = realloc(integrator->activeTracks, trackCount * sizeof(uint32_t));
+
+        if (activeTracks == NULL) return 0;
+
+        integrator->activeTracks = activeTracks;
+
+        memset(tracks + integrator->trackCount, 0, (trackCount - integrator->trackCount) * sizeof(TGLARLiveTrack));
+
+    } else {
+
+        // Removed tracks start over if added again
+        //
+        uint32_t activeCount = 0;
+
+        for (uint32_t idx = 0; idx < integrator->activeCount; idx++) {
+
+            if (integrator->activeTracks[idx] < trackCount) integrator->activeTracks[activeCount++] = integrator->activeTracks[idx];
+        }
+
+        integrator->activeCount = activeCount;
+
+        if (trackCount < integrator->trackCount) memset(integrator->tracks + trackCount, 0, (integrator->trackCount - trackCount) * sizeof(TGLARLiveTrack));
+    }
+
+    integrator->trackCount = trackCount;
+
+    return 1;
+}
+
+uint32_t TGLARLiveIntegratorUpdate(TGLARLiveIntegrator *integrator, TGLARLiveQueue *queue, double time) {
+
+    uint32_t count;
+
+    do {
+
+        count = TGLARLiveQueuePop(queue, integrator->drainBuffer, integrator->drainCapacity);
+
+        for (uint32_t idx = 0; idx < count; idx++) TGLARLiveIntegratorApply(integrator, &integrator->drainBuffer[idx]);
+
+    } while (count == integrator->drainCapacity);
+
+    double evaluationTime = time - integrator->interpolationDelay;
+
+    for (uint32_t idx = 0; idx < integrator->activeCount; idx++) {
+
+        TGLARLiveTrack *track = &integrator->tracks[integrator->activeTracks[idx]];
+
+        TGLARLiveTrackPredict(track, evaluationTime, integrator->maxExtrapolation, track->output);
+
+        if (track->offset[0] != 0.0 || track->offset[1] != 0.0 || track->offset[2] != 0.0) {
+
+            double weight = (integrator->smoothingTime > 0.0) ? exp(-fmax(time - track->offsetTime, 0.0) / integrator->smoothingTime) : 0.0;
+
+            if (weight < 1.0e-3) {
+
+                memset(track->offset, 0, sizeof(track->offset));
+
+            } else {
+
+                for (int axis = 0; axis < 3; axis++) track->output[axis] += track->offset[axis] * weight;
+            }
+        }
+
+        track->outputTime = time;
+        track->outputValid = 1;
+    }
+
+    return integrator->activeCount;
+}
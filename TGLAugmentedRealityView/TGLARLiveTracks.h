@@ -0,0 +1,172 @@
+//
+//  TGLARLiveTracks.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARLiveTracks_h
+#define TGLARLiveTracks_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A timestamped position and velocity of a moving overlay.
+typedef struct {
+
+    uint32_t track;
+    uint32_t reserved;
+    double timestamp;
+    double position[3];
+    double velocity[3];
+
+} TGLARLiveSample;
+
+/** A lock-free single producer, single consumer queue of samples.
+ *
+ * One thread may push while another one pops. Samples pushed
+ * while the queue is full are dropped and counted.
+ */
+typedef struct {
+
+    TGLARLiveSample *samples;
+    uint32_t capacity;
+
+    // Written by the producer only
+    //
+    uint32_t head;
+    uint64_t droppedCount;
+
+    // Keeps producer and consumer
+    // fields on separate cache lines
+    //
+    uint8_t separator[64];
+
+    // Written by the consumer only
+    //
+    uint32_t tail;
+
+} TGLARLiveQueue;
+
+/// The interpolation state of a single track.
+typedef struct {
+
+    TGLARLiveSample previous;
+    TGLARLiveSample latest;
+    uint32_t sampleCount;
+
+    double offset[3];
+    double offsetTime;
+
+    double output[3];
+    double outputTime;
+    uint32_t outputValid;
+
+} TGLARLiveTrack;
+
+/** Integrates samples into per-track positions at render time.
+ *
+ * Between the two latest samples of a track its position is a cubic
+ * Hermite interpolation of their positions and velocities. After the
+ * latest sample it is extrapolated by dead reckoning for at most
+ * @p maxExtrapolation seconds. When a new sample changes the predicted
+ * path, the difference to the position shown last is blended out over
+ * @p smoothingTime seconds, unless it exceeds @p snapDistance.
+ */
+typedef struct {
+
+    TGLARLiveTrack *tracks;
+    uint32_t trackCount;
+
+    /// Tracks having received samples, in order of their first sample.
+    uint32_t *activeTracks;
+    uint32_t activeCount;
+
+    /// Seconds subtracted from the render time to interpolate instead of extrapolate. Default is @p 0.0.
+    double interpolationDelay;
+    /// Maximum seconds to extrapolate beyond the latest sample. Default is @p 1.0.
+    double maxExtrapolation;
+    /// Seconds to blend out prediction errors. Default is @p 0.2.
+    double smoothingTime;
+    /// Prediction errors larger than this are not blended out. Default is @p 50.0.
+    double snapDistance;
+
+    TGLARLiveSample *drainBuffer;
+    uint32_t drainCapacity;
+
+} TGLARLiveIntegrator;
+
+/// Initializes a queue holding at least @p capacity samples, rounded up to a power of two.
+///
+/// @return Non-zero on success, zero if memory could not be allocated.
+int TGLARLiveQueueInit(TGLARLiveQueue *queue, uint32_t capacity);
+
+/// Releases all memory held by the queue.
+void TGLARLiveQueueDestroy(TGLARLiveQueue *queue);
+
+/// Appends a sample. Must only be called by the producer thread.
+///
+/// @return Non-zero on success, zero if the queue is full and the sample was dropped.
+int TGLARLiveQueuePush(TGLARLiveQueue *queue, const TGLARLiveSample *sample);
+
+/// Removes up to @p maxCount samples in push order. Must only be called by the consumer thread.
+///
+/// @return The number of samples copied to @p samples.
+uint32_t TGLARLiveQueuePop(TGLARLiveQueue *queue, TGLARLiveSample *samples, uint32_t maxCount);
+
+/// Returns the number of samples dropped because the queue was full.
+uint64_t TGLARLiveQueueDroppedCount(const TGLARLiveQueue *queue);
+
+/// Initializes an integrator with the default parameters and no tracks.
+///
+/// @return Non-zero on success, zero if memory could not be allocated.
+int TGLARLiveIntegratorInit(TGLARLiveIntegrator *integrator);
+
+/// Releases all memory held by the integrator.
+void TGLARLiveIntegratorDestroy(TGLARLiveIntegrator *integrator);
+
+/** Sets the number of tracks, keeping the state of existing ones.
+ *
+ * Samples for tracks beyond @p trackCount are ignored.
+ *
+ * @return Non-zero on success, zero if memory could not be allocated.
+ */
+int TGLARLiveIntegratorSetTrackCount(TGLARLiveIntegrator *integrator, uint32_t trackCount);
+
+/** Consumes all queued samples and updates the track positions.
+ *
+ * Samples older than a track's latest sample are ignored.
+ *
+ * @param time The render time in the clock of the sample timestamps.
+ *
+ * @return The number of active tracks. Their indexes are in @p activeTracks, their positions in the @p output of each track.
+ */
+uint32_t TGLARLiveIntegratorUpdate(TGLARLiveIntegrator *integrator, TGLARLiveQueue *queue, double time);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARLiveTracks_h */
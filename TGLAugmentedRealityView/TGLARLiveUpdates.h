@@ -0,0 +1,86 @@
+//
+//  TGLARLiveUpdates.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <GLKit/GLKVector3.h>
+
+#import "TGLARFloatingOrigin.h"
+
+/** High-rate position updates of moving overlays, such as vehicles.
+ *
+ * A producer thread pushes timestamped world positions and velocities
+ * into a lock-free queue. A @p TGLARView drains the queue every frame
+ * and moves the overlays to the positions interpolated or extrapolated
+ * to the frame's display time, without reloading any data.
+ *
+ * A track is the index of an overlay in the view's data source. Samples
+ * for indexes beyond the current number of overlays are ignored.
+ *
+ * @sa -[TGLARView liveUpdates]
+ */
+@interface TGLARLiveUpdates : NSObject
+
+/// The number of samples the queue holds before dropping samples.
+@property (nonatomic, readonly) NSUInteger capacity;
+/// The number of samples dropped because the queue was full. May be read on any thread.
+@property (nonatomic, readonly) uint64_t droppedSampleCount;
+
+/// Seconds the displayed positions lag behind to interpolate between samples instead of extrapolating. Default is @p 0.0.
+@property (nonatomic, assign) NSTimeInterval interpolationDelay;
+/// Maximum seconds positions are extrapolated beyond a track's latest sample. Default is @p 1.0.
+@property (nonatomic, assign) NSTimeInterval maxExtrapolationTime;
+/// Seconds over which jumps caused by new samples are smoothed out. Default is @p 0.2.
+@property (nonatomic, assign) NSTimeInterval smoothingTime;
+/// Jumps in meters larger than this are applied immediately instead of smoothed out. Default is @p 50.0.
+@property (nonatomic, assign) double snapDistance;
+
+/** Initializes live updates with a queue of the given capacity.
+ *
+ * @param capacity The minimum number of samples the queue holds, rounded up to a power of two.
+ */
+- (nonnull instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// Initializes live updates with a queue of 16384 samples.
+- (nonnull instancetype)init;
+
+/** Queues a position sample of a track.
+ *
+ * May be called on any thread, but only on one thread at a time.
+ *
+ * @param track The index of the overlay in the view's data source.
+ * @param timestamp The time the sample was taken in the @p CACurrentMediaTime() clock.
+ * @param position The world position of the overlay at @p timestamp.
+ * @param velocity The velocity of the overlay in meters per second.
+ *
+ * @return @p NO if the queue is full and the sample was dropped.
+ */
+- (BOOL)pushSampleForTrack:(NSUInteger)track timestamp:(NSTimeInterval)timestamp position:(TGLARWorldPosition)position velocity:(GLKVector3)velocity;
+
+/// Private method. For internal use only
+- (void)setTrackCount:(NSUInteger)trackCount;
+/// Private method. For internal use only
+- (void)advanceToTime:(NSTimeInterval)time usingBlock:(nonnull void (^)(NSUInteger track, TGLARWorldPosition position))block;
+
+@end
@@ -0,0 +1,152 @@
+//
+//  TGLARLiveUpdates.m
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "TGLARLiveUpdates.h"
+#import "TGLARLiveTracks.h"
+
+static const NSUInteger kTGLARLiveUpdatesDefaultCapacity = 16384;
+
+@interface TGLARLiveUpdates () {
+
+    TGLARLiveQueue _queue;
+    TGLARLiveIntegrator _integrator;
+}
+
+@end
+
+@implementation TGLARLiveUpdates
+
+- (instancetype)init {
+
+    return [self initWithCapacity:kTGLARLiveUpdatesDefaultCapacity];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+
+    self = [super init];
+
+    if (self) {
+
+        if (!TGLARLiveQueueInit(&_queue, (uint32_t)MIN(capacity, UINT32_MAX / 2))) return nil;
+        if (!TGLARLiveIntegratorInit(&_integrator)) return nil;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    TGLARLiveQueueDestroy(&_queue);
+    TGLARLiveIntegratorDestroy(&_integrator);
+}
+
+#pragma mark - Accessors
+
+- (NSUInteger)capacity {
+
+    return _queue.capacity;
+}
+
+- (uint64_t)droppedSampleCount {
+
+    return TGLARLiveQueueDroppedCount(&_queue);
+}
+
+- (NSTimeInterval)interpolationDelay {
+
+    return _integrator.interpolationDelay;
+}
+
+- (void)setInterpolationDelay:(NSTimeInterval)interpolationDelay {
+
+    _integrator.interpolationDelay = MAX(interpolationDelay, 0.0);
+}
+
+- (NSTimeInterval)maxExtrapolationTime {
+
+    return _integrator.maxExtrapolation;
+}
+
+- (void)setMaxExtrapolationTime:(NSTimeInterval)maxExtrapolationTime {
+
+    _integrator.maxExtrapolation = MAX(maxExtrapolationTime, 0.0);
+}
+
+- (NSTimeInterval)smoothingTime {
+
+    return _integrator.smoothingTime;
+}
+
+- (void)setSmoothingTime:(NSTimeInterval)smoothingTime {
+
+    _integrator.smoothingTime = MAX(smoothingTime, 0.0);
+}
+
+- (double)snapDistance {
+
+    return _integrator.snapDistance;
+}
+
+- (void)setSnapDistance:(double)snapDistance {
+
+    _integrator.snapDistance = snapDistance;
+}
+
+#pragma mark - Samples
+
+- (BOOL)pushSampleForTrack:(NSUInteger)track timestamp:(NSTimeInterval)timestamp position:(TGLARWorldPosition)position velocity:(GLKVector3)velocity {
+
+    if (track >= UINT32_MAX) return NO;
+
+    TGLARLiveSample sample = {
+
+        .track = (uint32_t)track,
+        .timestamp = timestamp,
+        .position = { position.x, position.y, position.z },
+        .velocity = { velocity.x, velocity.y, velocity.z }
+    };
+
+    return TGLARLiveQueuePush(&_queue, &sample) != 0;
+}
+
+- (void)setTrackCount:(NSUInteger)trackCount {
+
+    TGLARLiveIntegratorSetTrackCount(&_integrator, (uint32_t)MIN(trackCount, UINT32_MAX));
+}
+
+- (void)advanceToTime:(NSTimeInterval)time usingBlock:(void (^)(NSUInteger, TGLARWorldPosition))block {
+
+    uint32_t count = TGLARLiveIntegratorUpdate(&_integrator, &_queue, time);
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        uint32_t track = _integrator.activeTracks[idx];
+        const double *output = _integrator.tracks[track].output;
+
+        block(track, (TGLARWorldPosition){ output[0], output[1], output[2] });
+    }
+}
+
+@end
@@ -0,0 +1,1183 @@
+//
+//  TGLARMeshProcessing.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARMeshProcessing.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TGLAR_MESH_NO_INDEX UINT32_MAX
+#define TGLAR_MESH_MAX_FACE_CORNERS 64
+
+// Cache size of the FIFO simulated to find
+// cluster boundaries for overdraw optimization
+//
+static const uint32_t kTGLARMeshClusterCacheSize = 16;
+
+// Grid resolutions along the longest axis tried
+// for the coarser levels of detail
+//
+static const uint32_t kTGLARMeshLODResolutions[] = { 64, 32, 16, 8 };
+
+typedef struct {
+
+    float key;
+    uint32_t cluster;
+
+} TGLARMeshClusterOrder;
+
+typedef struct {
+
+    uint64_t key;
+    uint32_t representative;
+    uint32_t count;
+    float sum[3];
+    float distance;
+
+} TGLARMeshCell;
+
+static int TGLARMeshReserve(void **buffer, size_t *capacity, size_t count, size_t size) {
+
+    if (count <= *capacity) return 1;
+
+    size_t newCapacity = (*capacity > 0) ? *capacity : 64;
+
+    while (newCapacity < count) newCapacity *= 2;
+
+    void *newBuffer = realloc(*buffer, newCapacity * size);
+
+    if (newBuffer == NULL) return 0;
+
+    *buffer = newBuffer;
+    *capacity = newCapacity;
+
+    return 1;
+}
+
+static uint32_t TGLARMeshHashSize(uint32_t count) {
+
+    uint32_t size = 64;
+
+    while (size < 2 * (uint64_t)count) size *= 2;
+
+    return size;
+}
+
+static uint32_t TGLARMeshHash(uint64_t key) {
+
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return (uint32_t)key;
+}
+
+static void TGLARMeshTriangleNormal(const float *positions, uint32_t a, uint32_t b, uint32_t c, float normal[3]) {
+
+    const float *p0 = positions + 3 * a;
+    const float *p1 = positions + 3 * b;
+    const float *p2 = positions + 3 * c;
+
+    float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+
+    normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+static float TGLARMeshNormalize(float vector[3]) {
+
+    float length = sqrtf(vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2]);
+
+    if (length > FLT_MIN) {
+
+        vector[0] /= length;
+        vector[1] /= length;
+        vector[2] /= length;
+    }
+
+    return length;
+}
+
+void TGLARMeshDataInit(TGLARMeshData *mesh) {
+
+    memset(mesh, 0, sizeof(TGLARMeshData));
+}
+
+void TGLARMeshDataDestroy(TGLARMeshData *mesh) {
+
+    free(mesh->positions);
+    free(mesh->normals);
+    free(mesh->texCoords);
+    free(mesh->indices);
+
+    memset(mesh, 0, sizeof(TGLARMeshData));
+}
+
+// Number parsing stays within the current line,
+// unlike strtof and strtol skipping newlines
+//
+static const char *TGLARMeshSkipBlanks(const char *cursor, const char *end) {
+
+    while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')) cursor++;
+
+    return cursor;
+}
+
+static int TGLARMeshParseFloats(const char *cursor, const char *end, float *values, int count) {
+
+    for (int idx = 0; idx < count; idx++) {
+
+        char *next = NULL;
+
+        cursor = TGLARMeshSkipBlanks(cursor, end);
+
+        if (cursor >= end) return idx;
+
+        values[idx] = strtof(cursor, &next);
+
+        if (next == cursor || next > end) return idx;
+
+        cursor = next;
+    }
+
+    return count;
+}
+
+static uint32_t TGLARMeshResolveIndex(long index, size_t count) {
+
+    if (index > 0 && (size_t)index <= count) return (uint32_t)(index - 1);
+    if (index < 0 && (size_t)(-index) <= count) return (uint32_t)(count + index);
+
+    return TGLAR_MESH_NO_INDEX;
+}
+
+// Parses a face corner "p", "p/t", "p//n" or "p/t/n" into
+// zero-based indexes, TGLAR_MESH_NO_INDEX if not given
+//
+static const char *TGLARMeshParseCorner(const char *cursor, const char *end, const size_t counts[3], uint32_t corner[3], int *valid) {
+
+    char *next = NULL;
+
+    *valid = 0;
+
+    corner[0] = corner[1] = corner[2] = TGLAR_MESH_NO_INDEX;
+
+    long index = strtol(cursor, &next, 10);
+
+    if (next == cursor || next > end) return end;
+
+    corner[0] = TGLARMeshResolveIndex(index, counts[0]);
+    cursor = next;
+
+    for (int component = 1; component < 3 && cursor < end && *cursor == '/'; component++) {
+
+        cursor++;
+
+        if (cursor < end && *cursor != '/' && *cursor != ' ' && *cursor != '\t' && *cursor != '\r') {
+
+            index = strtol(cursor, &next, 10);
+
+            if (next == cursor || next > end) return end;
+
+            corner[component] = TGLARMeshResolveIndex(index, counts[component]);
+
+            if (corner[component] == TGLAR_MESH_NO_INDEX) return end;
+
+            cursor = next;
+        }
+    }
+
+    *valid = (corner[0] != TGLAR_MESH_NO_INDEX);
+
+    return cursor;
+}
+
+int TGLARMeshParseOBJ(TGLARMeshData *mesh, const char *text) {
+
+    TGLARMeshDataDestroy(mesh);
+
+    float *attributes[3] = { NULL, NULL, NULL };
+    size_t attributeCounts[3] = { 0, 0, 0 };
+    size_t attributeCapacities[3] = { 0, 0, 0 };
+    const int attributeSizes[3] = { 3, 2, 3 };
+
+    uint32_t *corners = NULL;
+    size_t cornerCount = 0;
+    size_t cornerCapacity = 0;
+
+    uint32_t *slots = NULL;
+    uint32_t *vertexCorners = NULL;
+
+    int missingNormals = 0;
+    int success = 0;
+
+    const char *cursor = text;
+
+    while (*cursor) {
+
+        const char *line = cursor;
+
+        while (*cursor && *cursor != '\n') cursor++;
+
+        const char *end = cursor;
+
+        if (*cursor) cursor++;
+
+        line = TGLARMeshSkipBlanks(line, end);
+
+        if (end - line < 2) continue;
+
+        int attribute = -1;
+
+        if (line[0] == 'v' && (line[1] == ' ' || line[1] == '\t')) attribute = 0;
+        else if (line[0] == 'v' && line[1] == 't') attribute = 1;
+        else if (line[0] == 'v' && line[1] == 'n') attribute = 2;
+
+        if (attribute >= 0) {
+
+            int size = attributeSizes[attribute];
+            float values[3] = { 0.0f, 0.0f, 0.0f };
+
+            // Texture coordinates may omit the second component
+            //
+            int parsed = TGLARMeshParseFloats(line + 2, end, values, size);
+
+            if (parsed < size && !(attribute == 1 && parsed >= 1)) continue;
+
+            if (!TGLARMeshReserve((void **)&attributes[attribute], &attributeCapacities[attribute], (attributeCounts[attribute] + 1) * size, sizeof(float))) goto cleanup;
+
+            memcpy(attributes[attribute] + attributeCounts[attribute] * size, values, size * sizeof(float));
+
+            attributeCounts[attribute]++;
+
+        } else if (line[0] == 'f' && (line[1] == ' ' || line[1] == '\t')) {
+
+            uint32_t face[TGLAR_MESH_MAX_FACE_CORNERS][3];
+            int faceCount = 0;
+            int valid = 1;
+
+            const char *corner = TGLARMeshSkipBlanks(line + 2, end);
+
+            while (corner < end && valid) {
+
+                if (faceCount < TGLAR_MESH_MAX_FACE_CORNERS) {
+
+                    corner = TGLARMeshParseCorner(corner, end, attributeCounts, face[faceCount], &valid);
+
+                    if (valid) faceCount++;
+
+                } else {
+
+                    corner = end;
+                }
+
+                corner = TGLARMeshSkipBlanks(corner, end);
+            }
+
+            if (!valid || faceCount < 3) continue;
+
+            if (!TGLARMeshReserve((void **)&corners, &cornerCapacity, (cornerCount + 3 * (faceCount - 2)) * 3, sizeof(uint32_t))) goto cleanup;
+
+            for (int idx = 1; idx + 1 < faceCount; idx++) {
+
+                memcpy(corners + 3 * cornerCount++, face[0], sizeof(face[0]));
+                memcpy(corners + 3 * cornerCount++, face[idx], sizeof(face[0]));
+                memcpy(corners + 3 * cornerCount++, face[idx + 1], sizeof(face[0]));
+            }
+        }
+    }
+
+    if (cornerCount == 0 || cornerCount > UINT32_MAX / 3) goto cleanup;
+
+    // Merge corners referring to the same
+    // position, texture and normal indexes
+    //
+    uint32_t slotCount = TGLARMeshHashSize((uint32_t)cornerCount);
+
+    slots = malloc(slotCount * sizeof(uint32_t));
+    vertexCorners = malloc(cornerCount * sizeof(uint32_t));
+    mesh->indices = malloc(cornerCount * sizeof(uint32_t));
+
+    if (slots == NULL || vertexCorners == NULL || mesh->indices == NULL) goto cleanup;
+
+    memset(slots, 0xff, slotCount * sizeof(uint32_t));
+
+    for (size_t idx = 0; idx < cornerCount; idx++) {
+
+        const uint32_t *corner = corners + 3 * idx;
+
+        uint64_t key = (uint64_t)corner[0] * 0x9e3779b97f4a7c15ULL ^ (uint64_t)corner[1] * 0xc2b2ae3d27d4eb4fULL ^ (uint64_t)corner[2] * 0x165667b19e3779f9ULL;
+        uint32_t slot = TGLARMeshHash(key) & (slotCount - 1);
+
+        while (slots[slot] != TGLAR_MESH_NO_INDEX && memcmp(corners + 3 * vertexCorners[slots[slot]], corner, 3 * sizeof(uint32_t)) != 0) {
+
+            slot = (slot + 1) & (slotCount - 1);
+        }
+
+        if (slots[slot] == TGLAR_MESH_NO_INDEX) {
+
+            slots[slot] = mesh->vertexCount;
+            vertexCorners[mesh->vertexCount++] = (uint32_t)idx;
+        }
+
+        mesh->indices[mesh->indexCount++] = slots[slot];
+    }
+
+    mesh->positions = malloc(mesh->vertexCount * 3 * sizeof(float));
+    mesh->normals = malloc(mesh->vertexCount * 3 * sizeof(float));
+    mesh->texCoords = malloc(mesh->vertexCount * 2 * sizeof(float));
+
+    if (mesh->positions == NULL || mesh->normals == NULL || mesh->texCoords == NULL) goto cleanup;
+
+    for (uint32_t vertex = 0; vertex < mesh->vertexCount; vertex++) {
+
+        const uint32_t *corner = corners + 3 * vertexCorners[vertex];
+
+        memcpy(mesh->positions + 3 * vertex, attributes[0] + 3 * corner[0], 3 * sizeof(float));
+
+        if (corner[1] != TGLAR_MESH_NO_INDEX) {
+
+            mesh->texCoords[2 * vertex] = attributes[1][2 * corner[1]];
+            mesh->texCoords[2 * vertex + 1] = 1.0f - attributes[1][2 * corner[1] + 1];
+
+        } else {
+
+            mesh->texCoords[2 * vertex] = mesh->texCoords[2 * vertex + 1] = 0.0f;
+        }
+
+        if (corner[2] != TGLAR_MESH_NO_INDEX) {
+
+            memcpy(mesh->normals + 3 * vertex, attributes[2] + 3 * corner[2], 3 * sizeof(float));
+
+            TGLARMeshNormalize(mesh->normals + 3 * vertex);
+
+        } else {
+
+            missingNormals = 1;
+        }
+    }
+
+    if (missingNormals) TGLARMeshComputeNormals(mesh);
+
+    success = 1;
+
+cleanup:
+
+    for (int idx = 0; idx < 3; idx++) free(attributes[idx]);
+
+    free(corners);
+    free(slots);
+    free(vertexCorners);
+
+    if (!success) TGLARMeshDataDestroy(mesh);
+
+    return success;
+}
+
+void TGLARMeshComputeNormals(TGLARMeshData *mesh) {
+
+    memset(mesh->normals, 0, mesh->vertexCount * 3 * sizeof(float));
+
+    for (uint32_t idx = 0; idx + 2 < mesh->indexCount; idx += 3) {
+
+        const uint32_t *triangle = mesh->indices + idx;
+        float normal[3];
+
+        TGLARMeshTriangleNormal(mesh->positions, triangle[0], triangle[1], triangle[2], normal);
+
+        for (int corner = 0; corner < 3; corner++) {
+
+            float *vertexNormal = mesh->normals + 3 * triangle[corner];
+
+            vertexNormal[0] += normal[0];
+            vertexNormal[1] += normal[1];
+            vertexNormal[2] += normal[2];
+        }
+    }
+
+    for (uint32_t vertex = 0; vertex < mesh->vertexCount; vertex++) {
+
+        float *normal = mesh->normals + 3 * vertex;
+
+        if (TGLARMeshNormalize(normal) <= FLT_MIN) {
+
+            normal[0] = normal[1] = 0.0f;
+            normal[2] = 1.0f;
+        }
+    }
+}
+
+void TGLARMeshConvertYUp(TGLARMeshData *mesh) {
+
+    for (uint32_t vertex = 0; vertex < mesh->vertexCount; vertex++) {
+
+        float *arrays[2] = { mesh->positions + 3 * vertex, mesh->normals + 3 * vertex };
+
+        for (int idx = 0; idx < 2; idx++) {
+
+            float *value = arrays[idx];
+            float x = value[0], y = value[1], z = value[2];
+
+            value[0] = z;
+            value[1] = x;
+            value[2] = y;
+        }
+    }
+}
+
+// Forsyth, "Linear-Speed Vertex Cache Optimisation"
+//
+static float TGLARMeshVertexScore(int32_t cachePosition, uint32_t remaining) {
+
+    if (remaining == 0) return -1.0f;
+
+    float score = 0.0f;
+
+    if (cachePosition >= 0) {
+
+        // The last triangle's vertices get a fixed score
+        // to avoid reusing them in the very next triangle
+        //
+        if (cachePosition < 3) {
+
+            score = 0.75f;
+
+        } else {
+
+            score = powf(1.0f - (float)(cachePosition - 3) / (TGLAR_MESH_CACHE_SIZE - 3), 1.5f);
+        }
+    }
+
+    return score + 2.0f / sqrtf((float)remaining);
+}
+
+int TGLARMeshOptimizeVertexCache(uint32_t *indices, uint32_t indexCount, uint32_t vertexCount) {
+
+    uint32_t triangleCount = indexCount / 3;
+
+    if (triangleCount < 2) return 1;
+
+    uint32_t *adjacencyStart = calloc((size_t)vertexCount + 1, sizeof(uint32_t));
+    uint32_t *remaining = calloc(vertexCount, sizeof(uint32_t));
+    uint32_t *adjacency = malloc((size_t)triangleCount * 3 * sizeof(uint32_t));
+    int32_t *cachePositions = malloc(vertexCount * sizeof(int32_t));
+    float *vertexScores = malloc(vertexCount * sizeof(float));
+    float *triangleScores = malloc(triangleCount * sizeof(float));
+    uint8_t *emitted = calloc(triangleCount, sizeof(uint8_t));
+    uint32_t *output = malloc((size_t)triangleCount * 3 * sizeof(uint32_t));
+
+    int success = 0;
+
+    if (!adjacencyStart || !remaining || !adjacency || !cachePositions || !vertexScores || !triangleScores || !emitted || !output) goto cleanup;
+
+    for (uint32_t idx = 0; idx < triangleCount * 3; idx++) {
+
+        if (indices[idx] >= vertexCount) goto cleanup;
+
+        remaining[indices[idx]]++;
+    }
+
+    for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+
+        adjacencyStart[vertex + 1] = adjacencyStart[vertex] + remaining[vertex];
+
+        cachePositions[vertex] = -1;
+        vertexScores[vertex] = TGLARMeshVertexScore(-1, remaining[vertex]);
+
+        remaining[vertex] = 0;
+    }
+
+    for (uint32_t triangle = 0; triangle < triangleCount; triangle++) {
+
+        triangleScores[triangle] = 0.0f;
+
+        for (int corner = 0; corner < 3; corner++) {
+
+            uint32_t vertex = indices[3 * triangle + corner];
+
+            adjacency[adjacencyStart[vertex] + remaining[vertex]++] = triangle;
+            triangleScores[triangle] += vertexScores[vertex];
+        }
+    }
+
+    uint32_t cache[TGLAR_MESH_CACHE_SIZE + 3];
+    uint32_t cacheCount = 0;
+
+    uint32_t bestTriangle = 0;
+    uint32_t nextTriangle = 0;
+
+    for (uint32_t triangle = 1; triangle < triangleCount; triangle++) {
+
+        if (triangleScores[triangle] > triangleScores[bestTriangle]) bestTriangle = triangle;
+    }
+
+    for (uint32_t outputCount = 0; outputCount < triangleCount; outputCount++) {
+
+        // Fall back to the next unused triangle in input
+        // order if no cached vertex has triangles left
+        //
+        if (bestTriangle == TGLAR_MESH_NO_INDEX) {
+
+            while (emitted[nextTriangle]) nextTriangle++;
+
+            bestTriangle = nextTriangle;
+        }
+
+        const uint32_t *triangle = indices + 3 * bestTriangle;
+
+        memcpy(output + 3 * outputCount, triangle, 3 * sizeof(uint32_t));
+
+        emitted[bestTriangle] = 1;
+
+        uint32_t newCache[TGLAR_MESH_CACHE_SIZE + 3];
+        uint32_t newCount = 0;
+
+        for (int corner = 0; corner < 3; corner++) {
+
+            uint32_t vertex = triangle[corner];
+            uint32_t *list = adjacency + adjacencyStart[vertex];
+
+            for (uint32_t idx = 0; idx < remaining[vertex]; idx++) {
+
+                if (list[idx] == bestTriangle) {
+
+                    list[idx] = list[--remaining[vertex]];
+                    break;
+                }
+            }
+
+            if (corner == 0 || (vertex != triangle[0] && (corner == 1 || vertex != triangle[1]))) newCache[newCount++] = vertex;
+        }
+
+        for (uint32_t idx = 0; idx < cacheCount; idx++) {
+
+            uint32_t vertex = cache[idx];
+
+            if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2]) newCache[newCount++] = vertex;
+        }
+
+        for (uint32_t idx = 0; idx < newCount; idx++) {
+
+            uint32_t vertex = newCache[idx];
+
+            cachePositions[vertex] = (idx < TGLAR_MESH_CACHE_SIZE) ? (int32_t)idx : -1;
+            vertexScores[vertex] = TGLARMeshVertexScore(cachePositions[vertex], remaining[vertex]);
+        }
+
+        // Rescore the triangles of all vertices whose cache
+        // position changed and pick the best of them
+        //
+        float bestScore = -FLT_MAX;
+
+        bestTriangle = TGLAR_MESH_NO_INDEX;
+
+        for (uint32_t idx = 0; idx < newCount; idx++) {
+
+            uint32_t vertex = newCache[idx];
+            const uint32_t *list = adjacency + adjacencyStart[vertex];
+
+            for (uint32_t adjacent = 0; adjacent < remaining[vertex]; adjacent++) {
+
+                uint32_t candidate = list[adjacent];
+                const uint32_t *candidateIndices = indices + 3 * candidate;
+
+                float score = vertexScores[candidateIndices[0]] + vertexScores[candidateIndices[1]] + vertexScores[candidateIndices[2]];
+
+                triangleScores[candidate] = score;
+
+                if (idx < TGLAR_MESH_CACHE_SIZE && score > bestScore) {
+
+                    bestScore = score;
+                    bestTriangle = candidate;
+                }
+            }
+        }
+
+        cacheCount = (newCount < TGLAR_MESH_CACHE_SIZE) ? newCount : TGLAR_MESH_CACHE_SIZE;
+
+        memcpy(cache, newCache, cacheCount * sizeof(uint32_t));
+    }
+
+    memcpy(indices, output, (size_t)triangleCount * 3 * sizeof(uint32_t));
+
+    success = 1;
+
+cleanup:
+
+    free(adjacencyStart);
+    free(remaining);
+    free(adjacency);
+    free(cachePositions);
+    free(vertexScores);
+    free(triangleScores);
+    free(emitted);
+    free(output);
+
+    return success;
+}
+
+float TGLARMeshACMR(const uint32_t *indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize) {
+
+    uint32_t triangleCount = indexCount / 3;
+
+    if (triangleCount == 0) return 0.0f;
+
+    uint32_t *timestamps = calloc(vertexCount, sizeof(uint32_t));
+
+    if (timestamps == NULL) return 0.0f;
+
+    uint32_t time = cacheSize + 1;
+    uint32_t misses = 0;
+
+    for (uint32_t idx = 0; idx < triangleCount * 3; idx++) {
+
+        uint32_t vertex = indices[idx];
+
+        if (vertex < vertexCount && time - timestamps[vertex] > cacheSize) {
+
+            timestamps[vertex] = time++;
+            misses++;
+        }
+    }
+
+    free(timestamps);
+
+    return (float)misses / triangleCount;
+}
+
+static int TGLARMeshClusterOrderCompare(const void *a, const void *b) {
+
+    const TGLARMeshClusterOrder *order1 = a;
+    const TGLARMeshClusterOrder *order2 = b;
+
+    // Descending by key, stable by cluster
+    //
+    if (order1->key > order2->key) return -1;
+    if (order1->key < order2->key) return 1;
+
+    return (order1->cluster < order2->cluster) ? -1 : (order1->cluster > order2->cluster);
+}
+
+// Sander et al., "Fast Triangle Reordering for Vertex
+// Locality and Reduced Overdraw", using hard cache
+// boundaries only
+//
+int TGLARMeshOptimizeOverdraw(uint32_t *indices, uint32_t indexCount, const float *positions, uint32_t vertexCount) {
+
+    uint32_t triangleCount = indexCount / 3;
+
+    if (triangleCount < 2) return 1;
+
+    uint32_t *timestamps = calloc(vertexCount, sizeof(uint32_t));
+    uint32_t *clusterStart = malloc(((size_t)triangleCount + 1) * sizeof(uint32_t));
+    TGLARMeshClusterOrder *order = malloc(triangleCount * sizeof(TGLARMeshClusterOrder));
+    uint32_t *output = malloc((size_t)triangleCount * 3 * sizeof(uint32_t));
+
+    int success = 0;
+
+    if (!timestamps || !clusterStart || !order || !output) goto cleanup;
+
+    uint32_t clusterCount = 0;
+    uint32_t time = kTGLARMeshClusterCacheSize + 1;
+
+    for (uint32_t triangle = 0; triangle < triangleCount; triangle++) {
+
+        int misses = 0;
+
+        for (int corner = 0; corner < 3; corner++) {
+
+            uint32_t vertex = indices[3 * triangle + corner];
+
+            if (vertex >= vertexCount) goto cleanup;
+
+            if (time - timestamps[vertex] > kTGLARMeshClusterCacheSize) {
+
+                timestamps[vertex] = time++;
+                misses++;
+            }
+        }
+
+        if (triangle == 0 || misses == 3) clusterStart[clusterCount++] = triangle;
+    }
+
+    clusterStart[clusterCount] = triangleCount;
+
+    if (clusterCount < 2) {
+
+        success = 1;
+        goto cleanup;
+    }
+
+    // Clusters facing away from the mesh center are
+    // drawn first, since they are likely to occlude
+    //
+    double meshCenter[3] = { 0.0, 0.0, 0.0 };
+    double meshArea = 0.0;
+
+    for (uint32_t triangle = 0; triangle < triangleCount; triangle++) {
+
+        const uint32_t *corners = indices + 3 * triangle;
+        float normal[3];
+
+        TGLARMeshTriangleNormal(positions, corners[0], corners[1], corners[2], normal);
+
+        double area = sqrt((double)normal[0] * normal[0] + (double)normal[1] * normal[1] + (double)normal[2] * normal[2]);
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            double centroid = (positions[3 * corners[0] + axis] + positions[3 * corners[1] + axis] + positions[3 * corners[2] + axis]) / 3.0;
+
+            meshCenter[axis] += centroid * area;
+        }
+
+        meshArea += area;
+    }
+
+    for (int axis = 0; axis < 3; axis++) meshCenter[axis] = (meshArea > 0.0) ? meshCenter[axis] / meshArea : 0.0;
+
+    for (uint32_t cluster = 0; cluster < clusterCount; cluster++) {
+
+        double center[3] = { 0.0, 0.0, 0.0 };
+        float normalSum[3] = { 0.0f, 0.0f, 0.0f };
+        double area = 0.0;
+
+        for (uint32_t triangle = clusterStart[cluster]; triangle < clusterStart[cluster + 1]; triangle++) {
+
+            const uint32_t *corners = indices + 3 * triangle;
+            float normal[3];
+
+            TGLARMeshTriangleNormal(positions, corners[0], corners[1], corners[2], normal);
+
+            double triangleArea = sqrt((double)normal[0] * normal[0] + (double)normal[1] * normal[1] + (double)normal[2] * normal[2]);
+
+            for (int axis = 0; axis < 3; axis++) {
+
+                double centroid = (positions[3 * corners[0] + axis] + positions[3 * corners[1] + axis] + positions[3 * corners[2] + axis]) / 3.0;
+
+                center[axis] += centroid * triangleArea;
+                normalSum[axis] += normal[axis];
+            }
+
+            area += triangleArea;
+        }
+
+        TGLARMeshNormalize(normalSum);
+
+        float key = 0.0f;
+
+        if (area > 0.0) {
+
+            for (int axis = 0; axis < 3; axis++) key += (float)(center[axis] / area - meshCenter[axis]) * normalSum[axis];
+        }
+
+        order[cluster].key = key;
+        order[cluster].cluster = cluster;
+    }
+
+    qsort(order, clusterCount, sizeof(TGLARMeshClusterOrder), TGLARMeshClusterOrderCompare);
+
+    uint32_t outputCount = 0;
+
+    for (uint32_t idx = 0; idx < clusterCount; idx++) {
+
+        uint32_t cluster = order[idx].cluster;
+        uint32_t count = (clusterStart[cluster + 1] - clusterStart[cluster]) * 3;
+
+        memcpy(output + outputCount, indices + 3 * clusterStart[cluster], count * sizeof(uint32_t));
+
+        outputCount += count;
+    }
+
+    memcpy(indices, output, (size_t)triangleCount * 3 * sizeof(uint32_t));
+
+    success = 1;
+
+cleanup:
+
+    free(timestamps);
+    free(clusterStart);
+    free(order);
+    free(output);
+
+    return success;
+}
+
+uint32_t TGLARMeshSimplify(uint32_t *destination, const uint32_t *indices, uint32_t indexCount, const float *positions, uint32_t vertexCount, float cellSize) {
+
+    uint32_t triangleCount = indexCount / 3;
+
+    if (triangleCount == 0 || !(cellSize > 0.0f)) return 0;
+
+    uint32_t cellCapacity = TGLARMeshHashSize(vertexCount);
+
+    uint32_t *vertexCells = malloc(vertexCount * sizeof(uint32_t));
+    TGLARMeshCell *cells = malloc(cellCapacity * sizeof(TGLARMeshCell));
+
+    uint32_t count = 0;
+
+    if (vertexCells == NULL || cells == NULL) goto cleanup;
+
+    memset(vertexCells, 0xff, vertexCount * sizeof(uint32_t));
+
+    for (uint32_t slot = 0; slot < cellCapacity; slot++) cells[slot].count = 0;
+
+    float minimum[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+
+    for (uint32_t idx = 0; idx < triangleCount * 3; idx++) {
+
+        if (indices[idx] >= vertexCount) goto cleanup;
+
+        const float *position = positions + 3 * indices[idx];
+
+        for (int axis = 0; axis < 3; axis++) minimum[axis] = fminf(minimum[axis], position[axis]);
+    }
+
+    // Assign every referenced vertex to a cell and
+    // accumulate the cell's average position
+    //
+    for (uint32_t idx = 0; idx < triangleCount * 3; idx++) {
+
+        uint32_t vertex = indices[idx];
+
+        if (vertexCells[vertex] != TGLAR_MESH_NO_INDEX) continue;
+
+        const float *position = positions + 3 * vertex;
+        uint64_t key = 0;
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            uint64_t coordinate = (uint64_t)((position[axis] - minimum[axis]) / cellSize);
+
+            if (coordinate > 0x1fffff) coordinate = 0x1fffff;
+
+            key |= coordinate << (21 * axis);
+        }
+
+        uint32_t slot = TGLARMeshHash(key) & (cellCapacity - 1);
+
+        while (cells[slot].count > 0 && cells[slot].key != key) slot = (slot + 1) & (cellCapacity - 1);
+
+        TGLARMeshCell *cell = &cells[slot];
+
+        if (cell->count == 0) {
+
+            memset(cell, 0, sizeof(TGLARMeshCell));
+
+            cell->key = key;
+            cell->distance = FLT_MAX;
+        }
+
+        cell->count++;
+        cell->sum[0] += position[0];
+        cell->sum[1] += position[1];
+        cell->sum[2] += position[2];
+
+        vertexCells[vertex] = slot;
+    }
+
+    for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+
+        if (vertexCells[vertex] == TGLAR_MESH_NO_INDEX) continue;
+
+        TGLARMeshCell *cell = &cells[vertexCells[vertex]];
+        const float *position = positions + 3 * vertex;
+
+        float distance = 0.0f;
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            float delta = position[axis] - cell->sum[axis] / cell->count;
+
+            distance += delta * delta;
+        }
+
+        if (distance < cell->distance) {
+
+            cell->distance = distance;
+            cell->representative = vertex;
+        }
+    }
+
+    for (uint32_t triangle = 0; triangle < triangleCount; triangle++) {
+
+        uint32_t a = cells[vertexCells[indices[3 * triangle]]].representative;
+        uint32_t b = cells[vertexCells[indices[3 * triangle + 1]]].representative;
+        uint32_t c = cells[vertexCells[indices[3 * triangle + 2]]].representative;
+
+        if (a == b || b == c || a == c) continue;
+
+        destination[count++] = a;
+        destination[count++] = b;
+        destination[count++] = c;
+    }
+
+cleanup:
+
+    free(vertexCells);
+    free(cells);
+
+    return count;
+}
+
+// Renumbers vertices in order of first use, dropping
+// unused ones, so vertex fetches stay sequential
+//
+static int TGLARMeshOptimizeVertexFetch(TGLARMeshData *mesh) {
+
+    uint32_t *remap = malloc(mesh->vertexCount * sizeof(uint32_t));
+
+    if (remap == NULL) return 0;
+
+    memset(remap, 0xff, mesh->vertexCount * sizeof(uint32_t));
+
+    uint32_t vertexCount = 0;
+
+    for (uint32_t idx = 0; idx < mesh->indexCount; idx++) {
+
+        uint32_t vertex = mesh->indices[idx];
+
+        if (remap[vertex] == TGLAR_MESH_NO_INDEX) remap[vertex] = vertexCount++;
+
+        mesh->indices[idx] = remap[vertex];
+    }
+
+    float *positions = malloc(vertexCount * 3 * sizeof(float));
+    float *normals = malloc(vertexCount * 3 * sizeof(float));
+    float *texCoords = malloc(vertexCount * 2 * sizeof(float));
+
+    if (positions == NULL || normals == NULL || texCoords == NULL) {
+
+        // Indices are renumbered already, so
+        // the vertices have to be moved anyway
+        //
+        free(positions);
+        free(normals);
+        free(texCoords);
+        free(remap);
+
+        return 0;
+    }
+
+    for (uint32_t vertex = 0; vertex < mesh->vertexCount; vertex++) {
+
+        uint32_t target = remap[vertex];
+
+        if (target == TGLAR_MESH_NO_INDEX) continue;
+
+        memcpy(positions + 3 * target, mesh->positions + 3 * vertex, 3 * sizeof(float));
+        memcpy(normals + 3 * target, mesh->normals + 3 * vertex, 3 * sizeof(float));
+        memcpy(texCoords + 2 * target, mesh->texCoords + 2 * vertex, 2 * sizeof(float));
+    }
+
+    free(mesh->positions);
+    free(mesh->normals);
+    free(mesh->texCoords);
+    free(remap);
+
+    mesh->positions = positions;
+    mesh->normals = normals;
+    mesh->texCoords = texCoords;
+    mesh->vertexCount = vertexCount;
+
+    return 1;
+}
+
+int TGLARPackedMeshBuild(TGLARPackedMesh *packed, TGLARMeshData *mesh) {
+
+    memset(packed, 0, sizeof(TGLARPackedMesh));
+
+    mesh->indexCount -= mesh->indexCount % 3;
+
+    if (mesh->indexCount == 0 || mesh->vertexCount == 0) return 0;
+
+    for (uint32_t idx = 0; idx < mesh->indexCount; idx++) {
+
+        if (mesh->indices[idx] >= mesh->vertexCount) return 0;
+    }
+
+    if (!TGLARMeshOptimizeVertexCache(mesh->indices, mesh->indexCount, mesh->vertexCount)) return 0;
+    if (!TGLARMeshOptimizeOverdraw(mesh->indices, mesh->indexCount, mesh->positions, mesh->vertexCount)) return 0;
+    if (!TGLARMeshOptimizeVertexFetch(mesh)) return 0;
+
+    float minimum[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float maximum[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    for (uint32_t vertex = 0; vertex < mesh->vertexCount; vertex++) {
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            minimum[axis] = fminf(minimum[axis], mesh->positions[3 * vertex + axis]);
+            maximum[axis] = fmaxf(maximum[axis], mesh->positions[3 * vertex + axis]);
+        }
+    }
+
+    // A uniform scale keeps the quantized
+    // normals valid in the modelview matrix
+    //
+    packed->scale = 0.0f;
+
+    for (int axis = 0; axis < 3; axis++) {
+
+        packed->center[axis] = 0.5f * (minimum[axis] + maximum[axis]);
+        packed->scale = fmaxf(packed->scale, 0.5f * (maximum[axis] - minimum[axis]));
+    }
+
+    if (!(packed->scale > 0.0f)) packed->scale = 1.0f;
+
+    // Levels of detail are at most as large as the full
+    // resolution, so this is an upper bound for all
+    //
+    packed->vertices = malloc(mesh->vertexCount * sizeof(TGLARMeshVertex));
+    packed->indices = malloc((size_t)mesh->indexCount * TGLAR_MESH_MAX_LODS * sizeof(uint32_t));
+
+    if (packed->vertices == NULL || packed->indices == NULL) {
+
+        TGLARPackedMeshDestroy(packed);
+        return 0;
+    }
+
+    memcpy(packed->indices, mesh->indices, mesh->indexCount * sizeof(uint32_t));
+
+    packed->lodCount = 1;
+    packed->lodIndexCount[0] = mesh->indexCount;
+    packed->indexCount = mesh->indexCount;
+
+    size_t resolutionCount = sizeof(kTGLARMeshLODResolutions) / sizeof(kTGLARMeshLODResolutions[0]);
+
+    for (size_t idx = 0; idx < resolutionCount && packed->lodCount < TGLAR_MESH_MAX_LODS; idx++) {
+
+        float cellSize = 2.0f * packed->scale / kTGLARMeshLODResolutions[idx];
+
+        uint32_t previousCount = packed->lodIndexCount[packed->lodCount - 1];
+        uint32_t *destination = packed->indices + packed->indexCount;
+        uint32_t count = TGLARMeshSimplify(destination, mesh->indices, mesh->indexCount, mesh->positions, mesh->vertexCount, cellSize);
+
+        if (count == 0) break;
+
+        // Try a coarser grid if this one does not pay off
+        //
+        if (count > previousCount / 5 * 4) continue;
+
+        if (!TGLARMeshOptimizeVertexCache(destination, count, mesh->vertexCount)) break;
+
+        packed->lodFirstIndex[packed->lodCount] = packed->indexCount;
+        packed->lodIndexCount[packed->lodCount] = count;
+        packed->lodError[packed->lodCount] = sqrtf(3.0f) * cellSize / packed->scale;
+        packed->lodCount++;
+        packed->indexCount += count;
+    }
+
+    // Give back the room reserved for levels that were not kept.
+    // The larger buffer stays valid if shrinking fails
+    //
+    uint32_t *indices = realloc(packed->indices, packed->indexCount * sizeof(uint32_t));
+
+    if (indices != NULL) packed->indices = indices;
+
+    packed->vertexCount = mesh->vertexCount;
+
+    for (uint32_t vertex = 0; vertex < mesh->vertexCount; vertex++) {
+
+        TGLARMeshVertex *packedVertex = &packed->vertices[vertex];
+
+        float normal[3];
+
+        memcpy(normal, mesh->normals + 3 * vertex, sizeof(normal));
+
+        TGLARMeshNormalize(normal);
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            float position = (mesh->positions[3 * vertex + axis] - packed->center[axis]) / packed->scale;
+
+            packedVertex->position[axis] = (int16_t)lrintf(fmaxf(-1.0f, fminf(1.0f, position)) * 32767.0f);
+            packedVertex->normal[axis] = (int8_t)lrintf(fmaxf(-1.0f, fminf(1.0f, normal[axis])) * 127.0f);
+        }
+
+        packedVertex->position[3] = 0;
+        packedVertex->normal[3] = 0;
+
+        packedVertex->texCoord[0] = TGLARMeshHalfFromFloat(mesh->texCoords[2 * vertex]);
+        packedVertex->texCoord[1] = TGLARMeshHalfFromFloat(mesh->texCoords[2 * vertex + 1]);
+    }
+
+    return 1;
+}
+
+void TGLARPackedMeshDestroy(TGLARPackedMesh *packed) {
+
+    free(packed->vertices);
+    free(packed->indices);
+
+    memset(packed, 0, sizeof(TGLARPackedMesh));
+}
+
+uint16_t TGLARMeshHalfFromFloat(float value) {
+
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+    uint32_t exponent = (bits >> 23) & 0xff;
+    uint32_t mantissa = bits & 0x7fffff;
+
+    if (exponent == 0xff) return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+
+    int32_t halfExponent = (int32_t)exponent - 127 + 15;
+
+    if (halfExponent >= 31) return sign | 0x7c00;
+
+    uint32_t shift = 13;
+    uint32_t half;
+
+    if (halfExponent <= 0) {
+
+        // Subnormal half, or zero if too small
+        //
+        if (halfExponent < -10) return sign;
+
+        mantissa |= 0x800000;
+        shift = (uint32_t)(14 - halfExponent);
+        half = mantissa >> shift;
+
+    } else {
+
+        half = ((uint32_t)halfExponent << 10) | (mantissa >> shift);
+    }
+
+    // Round to nearest even, carrying into the exponent
+    //
+    uint32_t remainder = mantissa & ((1u << shift) - 1);
+    uint32_t halfway = 1u << (shift - 1);
+
+    if (remainder > halfway || (remainder == halfway && (half & 1))) half++;
+
+    return sign | (uint16_t)half;
+}
@@ -0,0 +1,177 @@
+//
+//  TGLARMeshProcessing.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARMeshProcessing_h
+#define TGLARMeshProcessing_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Maximum number of levels of detail in a packed mesh, including the full resolution level.
+#define TGLAR_MESH_MAX_LODS 4
+
+/// Number of entries of the vertex cache the triangle order is optimized for.
+#define TGLAR_MESH_CACHE_SIZE 32
+
+/** Indexed triangle mesh data in single precision.
+ *
+ * Every vertex has a position, a normal and a texture coordinate.
+ * The arrays are owned by the mesh and released by @p TGLARMeshDataDestroy.
+ */
+typedef struct {
+
+    float *positions;
+    float *normals;
+    float *texCoords;
+    uint32_t vertexCount;
+
+    uint32_t *indices;
+    uint32_t indexCount;
+
+} TGLARMeshData;
+
+/// An interleaved, quantized vertex of 16 bytes.
+typedef struct {
+
+    /// Position relative to the packed mesh center in units of its scale, normalized to @p [-32767,32767].
+    int16_t position[4];
+    /// Unit normal normalized to @p [-127,127].
+    int8_t normal[4];
+    /// Texture coordinate as IEEE half floats.
+    uint16_t texCoord[2];
+
+} TGLARMeshVertex;
+
+/** A mesh ready to be uploaded to vertex and index buffers.
+ *
+ * All levels of detail share the vertices and store their indices
+ * back to back in @p indices, coarser levels following finer ones.
+ * Vertex positions decode to @p center + @p scale * position / 32767.
+ */
+typedef struct {
+
+    TGLARMeshVertex *vertices;
+    uint32_t vertexCount;
+
+    uint32_t *indices;
+    uint32_t indexCount;
+
+    uint32_t lodCount;
+    uint32_t lodFirstIndex[TGLAR_MESH_MAX_LODS];
+    uint32_t lodIndexCount[TGLAR_MESH_MAX_LODS];
+    /// Maximum deviation of each level from the full resolution in units of @p scale.
+    float lodError[TGLAR_MESH_MAX_LODS];
+
+    float center[3];
+    float scale;
+
+} TGLARPackedMesh;
+
+/// Initializes an empty mesh.
+void TGLARMeshDataInit(TGLARMeshData *mesh);
+
+/// Releases all memory held by the mesh.
+void TGLARMeshDataDestroy(TGLARMeshData *mesh);
+
+/** Parses a Wavefront OBJ mesh.
+ *
+ * Faces of all groups and objects are merged into a single mesh.
+ * Polygons are triangulated as fans. Vertices sharing the same
+ * position, normal and texture coordinate indexes are merged.
+ * Texture coordinates are flipped to a top-left origin.
+ *
+ * @param text NUL-terminated OBJ text.
+ *
+ * @return Non-zero on success, zero if the text holds no faces or memory could not be allocated.
+ */
+int TGLARMeshParseOBJ(TGLARMeshData *mesh, const char *text);
+
+/// Replaces the vertex normals by the area weighted normals of the adjacent triangles.
+void TGLARMeshComputeNormals(TGLARMeshData *mesh);
+
+/// Rotates a mesh with its Y axis pointing up so that Y maps to Z and Z maps to X, i.e. the mesh front faces north.
+void TGLARMeshConvertYUp(TGLARMeshData *mesh);
+
+/** Reorders triangles to improve post-transform vertex cache hits.
+ *
+ * Uses Forsyth's linear-speed optimization for a cache of
+ * @p TGLAR_MESH_CACHE_SIZE entries.
+ *
+ * @return Non-zero on success, zero if memory could not be allocated.
+ */
+int TGLARMeshOptimizeVertexCache(uint32_t *indices, uint32_t indexCount, uint32_t vertexCount);
+
+/** Reorders clusters of triangles to draw outward facing surfaces first.
+ *
+ * The triangles must already be optimized for the vertex cache. They
+ * are split where the cache would be flushed anyway, so the reordering
+ * reduces overdraw without adding cache misses.
+ *
+ * @return Non-zero on success, zero if memory could not be allocated.
+ */
+int TGLARMeshOptimizeOverdraw(uint32_t *indices, uint32_t indexCount, const float *positions, uint32_t vertexCount);
+
+/// Returns the average number of cache misses per triangle for a FIFO cache of @p cacheSize entries.
+float TGLARMeshACMR(const uint32_t *indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize);
+
+/** Simplifies a mesh by clustering its vertices in a uniform grid.
+ *
+ * Every cell keeps the vertex closest to the average of its vertices,
+ * so the result references the original vertices. Triangles collapsing
+ * within a cell are dropped.
+ *
+ * @param destination Receives at most @p indexCount indices.
+ * @param cellSize The grid cell size in the units of @p positions.
+ *
+ * @return The number of indices in @p destination.
+ */
+uint32_t TGLARMeshSimplify(uint32_t *destination, const uint32_t *indices, uint32_t indexCount, const float *positions, uint32_t vertexCount, float cellSize);
+
+/** Optimizes and packs a mesh for drawing.
+ *
+ * Triangles are reordered for the vertex cache and overdraw, vertices
+ * for fetch locality. Coarser levels of detail are generated until
+ * they no longer save a fifth of the triangles. Vertices are quantized
+ * and interleaved. @p mesh is reordered in the process.
+ *
+ * @return Non-zero on success, zero if @p mesh is empty or memory could not be allocated.
+ */
+int TGLARPackedMeshBuild(TGLARPackedMesh *packed, TGLARMeshData *mesh);
+
+/// Releases all memory held by the packed mesh.
+void TGLARPackedMeshDestroy(TGLARPackedMesh *packed);
+
+/// Returns the IEEE half float closest to @p value.
+uint16_t TGLARMeshHalfFromFloat(float value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARMeshProcessing_h */
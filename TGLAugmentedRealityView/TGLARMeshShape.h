@@ -0,0 +1,158 @@
+//
+//  TGLARMeshShape.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+#import "TGLARShapeOverlay.h"
+
+/** A triangle mesh uploaded to OpenGL ES buffers shared by all shapes showing it.
+ *
+ * Meshes are loaded from Wavefront OBJ, glTF or binary glTF files. The
+ * triangles are reordered for the post-transform vertex cache and to
+ * reduce overdraw, coarser levels of detail are generated, and vertices
+ * are quantized to 16 bytes each. All levels share one vertex buffer.
+ *
+ * Mesh files are expected to have their Y axis pointing up. They are
+ * rotated so Y points along the @p TGLARView's Z axis and the mesh front,
+ * i.e. its positive Z axis, faces the positive X axis. Units are meters.
+ */
+@interface TGLARMesh : NSObject
+
+/// The OpenGL ES context the buffers are created in.
+@property (nonatomic, weak, readonly, nullable) EAGLContext *context;
+
+/// The number of vertices shared by all levels of detail.
+@property (nonatomic, readonly) NSUInteger vertexCount;
+/// The number of triangles at full resolution.
+@property (nonatomic, readonly) NSUInteger triangleCount;
+/// The number of levels of detail, including the full resolution level @p 0.
+@property (nonatomic, readonly) NSUInteger levelCount;
+
+/// Transforms the quantized vertex positions into mesh coordinates in meters.
+@property (nonatomic, readonly) GLKMatrix4 decodeMatrix;
+
+/** Returns a mesh loaded from a file, sharing it with other callers if possible.
+ *
+ * The file is loaded and processed synchronously. Meshes are cached
+ * by URL and the context's share group as long as shapes are using
+ * them. Must be called on the main thread.
+ *
+ * @param url The file URL of an @p .obj, @p .gltf or @p .glb file.
+ * @param context The OpenGL ES context to create the buffers in.
+ *
+ * @return A possibly shared mesh or @p nil if the file cannot be loaded.
+ *
+ * @sa +loadMeshWithContentsOfURL:context:completion:
+ */
++ (nullable instancetype)meshWithContentsOfURL:(nonnull NSURL *)url context:(nonnull EAGLContext *)context;
+
+/** Loads a mesh from a file in the background, sharing it with other callers if possible.
+ *
+ * The file is parsed and processed on a background queue, the buffers
+ * are created on the main queue. Concurrent loads of the same file for
+ * the same share group are performed once. Must be called on the main
+ * thread.
+ *
+ * @param url The file URL of an @p .obj, @p .gltf or @p .glb file.
+ * @param context The OpenGL ES context to create the buffers in.
+ * @param completion Called on the main queue with the possibly shared mesh or @p nil if the file cannot be loaded. Called immediately if the mesh is already loaded.
+ */
++ (void)loadMeshWithContentsOfURL:(nonnull NSURL *)url context:(nonnull EAGLContext *)context completion:(nonnull void (^)(TGLARMesh * _Nullable mesh))completion;
+
+/** Waits until all background loads for the context's share group have completed.
+ *
+ * Runs the main run loop meanwhile, so completions are called before
+ * returning. Must be called on the main thread.
+ *
+ * @param context The OpenGL ES context meshes are being loaded for.
+ */
++ (void)waitForPendingLoadsWithContext:(nonnull EAGLContext *)context;
+
+/// Returns the number of triangles of a level of detail.
+- (NSUInteger)triangleCountAtLevel:(NSUInteger)level;
+
+/** Selects the coarsest level of detail deviating less than a pixel on screen.
+ *
+ * @param pixelsPerUnit Size on screen in pixels of one unit of @p -decodeMatrix' scale.
+ *
+ * @return A level from @p 0 to @p -levelCount - 1.
+ */
+- (NSUInteger)levelForPixelsPerUnit:(float)pixelsPerUnit;
+
+/** Draws a level of detail using the prepared shape program.
+ *
+ * Binds the buffers and sets up position, normal and texture
+ * coordinate attributes. The caller must prepare the program
+ * with @p -decodeMatrix applied to its modelview matrix.
+ */
+- (void)drawLevel:(NSUInteger)level;
+
+@end
+
+/// A 3D shape showing a lit, optionally textured triangle mesh.
+@interface TGLARMeshShape : TGLARShapeOverlay
+
+/// The mesh shown by this shape, @p nil while it is loading or if it could not be loaded.
+@property (nonatomic, readonly, nullable) TGLARMesh *mesh;
+/// The diffuse color of the mesh. Default is @p [UIColor whiteColor].
+@property (nonatomic, copy, nonnull) UIColor *color;
+/// The level of detail used by the last call to @p -draw.
+@property (nonatomic, readonly) NSUInteger level;
+
+/** Designated initializer.
+ *
+ * @param context OpenGL ES context to create shape in.
+ * @param mesh The mesh to show. Must have been created in @p context's share group.
+ *
+ * @return An initialized instance.
+ */
+- (nullable instancetype)initWithContext:(nonnull EAGLContext *)context mesh:(nullable TGLARMesh *)mesh;
+
+/** Convenience initializer loading a possibly shared mesh in the background.
+ *
+ * Nothing is drawn until the mesh is loaded. If it cannot be
+ * loaded @p -mesh stays @p nil and the shape stays invisible.
+ *
+ * @param context OpenGL ES context to create shape in.
+ * @param url The file URL of an @p .obj, @p .gltf or @p .glb file.
+ *
+ * @return An initialized instance.
+ *
+ * @sa +[TGLARMesh loadMeshWithContentsOfURL:context:completion:]
+ */
+- (nullable instancetype)initWithContext:(nonnull EAGLContext *)context URL:(nonnull NSURL *)url;
+
+/** Set the shape's texture image, modulated with @p -color and lighting.
+ *
+ * The image is decoded asynchronously by the shared @p TGLARTextureStreamer.
+ * Until the texture becomes resident the mesh is drawn untextured.
+ *
+ * @param image The Image to apply as shape's texture.
+ *
+ * @return YES on success, NO if the image has no bitmap data to be decoded.
+ */
+- (BOOL)setImage:(nullable UIImage *)image;
+
+@end
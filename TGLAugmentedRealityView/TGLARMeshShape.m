@@ -0,0 +1,867 @@
+//
+//  TGLARMeshShape.m
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "TGLARMeshShape.h"
+#import "TGLARMeshProcessing.h"
+#import "TGLARTextureStreamer.h"
+
+#import <OpenGLES/ES2/glext.h>
+
+// Levels are switched when the coarser one
+// deviates less than this on screen
+//
+static const float kTGLARMeshLODPixelError = 1.0;
+
+static const uint32_t kTGLARGLBMagic = 0x46546C67;
+static const uint32_t kTGLARGLBChunkJSON = 0x4E4F534A;
+static const uint32_t kTGLARGLBChunkBIN = 0x004E4942;
+
+static const NSUInteger kTGLARGLTFMaxNodeDepth = 32;
+
+static double TGLARGLTFComponentValue(const uint8_t *bytes, NSInteger componentType, BOOL normalized) {
+
+    switch (componentType) {
+
+        case GL_FLOAT: { float value; memcpy(&value, bytes, sizeof(value)); return value; }
+        case GL_UNSIGNED_INT: { uint32_t value; memcpy(&value, bytes, sizeof(value)); return value; }
+        case GL_UNSIGNED_SHORT: { uint16_t value; memcpy(&value, bytes, sizeof(value)); return normalized ? value / 65535.0 : value; }
+        case GL_SHORT: { int16_t value; memcpy(&value, bytes, sizeof(value)); return normalized ? MAX(value / 32767.0, -1.0) : value; }
+        case GL_UNSIGNED_BYTE: { uint8_t value = *bytes; return normalized ? value / 255.0 : value; }
+        case GL_BYTE: { int8_t value = (int8_t)*bytes; return normalized ? MAX(value / 127.0, -1.0) : value; }
+    }
+
+    return 0.0;
+}
+
+static size_t TGLARGLTFComponentSize(NSInteger componentType) {
+
+    switch (componentType) {
+
+        case GL_FLOAT:
+        case GL_UNSIGNED_INT: return 4;
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT: return 2;
+        case GL_UNSIGNED_BYTE:
+        case GL_BYTE: return 1;
+    }
+
+    return 0;
+}
+
+#pragma mark - Mesh interface
+
+@interface TGLARMesh () {
+
+    TGLARShapeGeometry _geometry;
+
+    NSUInteger _levelFirstIndex[TGLAR_MESH_MAX_LODS];
+    NSUInteger _levelIndexCount[TGLAR_MESH_MAX_LODS];
+    float _levelError[TGLAR_MESH_MAX_LODS];
+}
+
+@end
+
+#pragma mark - Mesh implementation
+
+@implementation TGLARMesh
+
+// Buffers can be used by all contexts of a share group,
+// so meshes are shared per share group and URL. Both the
+// cache and pending loads are only accessed on the main
+// thread
+//
++ (NSMapTable<NSString *, TGLARMesh *> *)sharedMeshesInSharegroup:(EAGLSharegroup *)sharegroup {
+
+    static NSMapTable<EAGLSharegroup *, NSMapTable *> *sharedMeshes = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+
+        sharedMeshes = [NSMapTable weakToStrongObjectsMapTable];
+    });
+
+    NSMapTable *meshes = [sharedMeshes objectForKey:sharegroup];
+
+    if (meshes == nil) {
+
+        meshes = [NSMapTable strongToWeakObjectsMapTable];
+
+        [sharedMeshes setObject:meshes forKey:sharegroup];
+    }
+
+    return meshes;
+}
+
++ (NSMutableDictionary<NSString *, NSMutableArray *> *)pendingLoadsInSharegroup:(EAGLSharegroup *)sharegroup {
+
+    static NSMapTable<EAGLSharegroup *, NSMutableDictionary *> *pendingLoads = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+
+        pendingLoads = [NSMapTable weakToStrongObjectsMapTable];
+    });
+
+    NSMutableDictionary *loads = [pendingLoads objectForKey:sharegroup];
+
+    if (loads == nil) {
+
+        loads = [NSMutableDictionary dictionary];
+
+        [pendingLoads setObject:loads forKey:sharegroup];
+    }
+
+    return loads;
+}
+
++ (instancetype)sharedMeshWithContentsOfURL:(NSURL *)url context:(EAGLContext *)context {
+
+    TGLARMesh *mesh = [[self sharedMeshesInSharegroup:context.sharegroup] objectForKey:url.absoluteString];
+
+    // The context a mesh was created in may be gone,
+    // taking the buffers with it
+    //
+    return (mesh.context.sharegroup == context.sharegroup) ? mesh : nil;
+}
+
++ (instancetype)meshWithContentsOfURL:(NSURL *)url context:(EAGLContext *)context {
+
+    TGLARMesh *mesh = [self sharedMeshWithContentsOfURL:url context:context];
+
+    if (mesh) return mesh;
+
+    TGLARPackedMesh packedMesh;
+
+    if (![self buildPackedMesh:&packedMesh contentsOfURL:url]) return nil;
+
+    mesh = [[self alloc] initWithContext:context packedMesh:&packedMesh];
+
+    TGLARPackedMeshDestroy(&packedMesh);
+
+    if (mesh) [[self sharedMeshesInSharegroup:context.sharegroup] setObject:mesh forKey:url.absoluteString];
+
+    return mesh;
+}
+
++ (void)loadMeshWithContentsOfURL:(NSURL *)url context:(EAGLContext *)context completion:(void (^)(TGLARMesh *))completion {
+
+    TGLARMesh *mesh = [self sharedMeshWithContentsOfURL:url context:context];
+
+    if (mesh) {
+
+        completion(mesh);
+        return;
+    }
+
+    // Callers loading a mesh already being
+    // loaded wait for the same result
+    //
+    NSString *key = url.absoluteString;
+    NSMutableDictionary<NSString *, NSMutableArray *> *pendingLoads = [self pendingLoadsInSharegroup:context.sharegroup];
+    NSMutableArray *completions = pendingLoads[key];
+
+    if (completions) {
+
+        [completions addObject:[completion copy]];
+        return;
+    }
+
+    pendingLoads[key] = [NSMutableArray arrayWithObject:[completion copy]];
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+
+        TGLARPackedMesh *packedMesh = malloc(sizeof(TGLARPackedMesh));
+
+        if (packedMesh && ![self buildPackedMesh:packedMesh contentsOfURL:url]) {
+
+            free(packedMesh);
+            packedMesh = NULL;
+        }
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+
+            TGLARMesh *mesh = nil;
+
+            if (packedMesh) {
+
+                mesh = [[self alloc] initWithContext:context packedMesh:packedMesh];
+
+                TGLARPackedMeshDestroy(packedMesh);
+                free(packedMesh);
+
+                if (mesh) [[self sharedMeshesInSharegroup:context.sharegroup] setObject:mesh forKey:key];
+            }
+
+            NSMutableDictionary<NSString *, NSMutableArray *> *pendingLoads = [self pendingLoadsInSharegroup:context.sharegroup];
+            NSArray *completions = pendingLoads[key];
+
+            [pendingLoads removeObjectForKey:key];
+
+            for (void (^completion)(TGLARMesh *) in completions) completion(mesh);
+        });
+    });
+}
+
++ (void)waitForPendingLoadsWithContext:(EAGLContext *)context {
+
+    // Completions are dispatched to the main queue,
+    // which is drained while the run loop runs
+    //
+    while ([self pendingLoadsInSharegroup:context.sharegroup].count > 0) {
+
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+}
+
++ (BOOL)buildPackedMesh:(TGLARPackedMesh *)packedMesh contentsOfURL:(NSURL *)url {
+
+    TGLARMeshData meshData;
+
+    TGLARMeshDataInit(&meshData);
+
+    if (![self loadMeshData:&meshData contentsOfURL:url]) {
+
+        NSLog(@"%s Mesh could not be loaded: %@", __PRETTY_FUNCTION__, url);
+
+        return NO;
+    }
+
+    TGLARMeshConvertYUp(&meshData);
+
+    BOOL success = TGLARPackedMeshBuild(packedMesh, &meshData) != 0;
+
+    if (!success) NSLog(@"%s Mesh has no triangles: %@", __PRETTY_FUNCTION__, url);
+
+    TGLARMeshDataDestroy(&meshData);
+
+    return success;
+}
+
+- (instancetype)initWithContext:(EAGLContext *)context packedMesh:(const TGLARPackedMesh *)packedMesh {
+
+    self = [super init];
+
+    if (self) {
+
+        _context = context;
+
+        _vertexCount = packedMesh->vertexCount;
+        _triangleCount = packedMesh->lodIndexCount[0] / 3;
+        _levelCount = packedMesh->lodCount;
+
+        for (NSUInteger level = 0; level < _levelCount; level++) {
+
+            _levelFirstIndex[level] = packedMesh->lodFirstIndex[level];
+            _levelIndexCount[level] = packedMesh->lodIndexCount[level];
+            _levelError[level] = packedMesh->lodError[level];
+        }
+
+        GLKMatrix4 centerMatrix = GLKMatrix4MakeTranslation(packedMesh->center[0], packedMesh->center[1], packedMesh->center[2]);
+
+        _decodeMatrix = GLKMatrix4Scale(centerMatrix, packedMesh->scale, packedMesh->scale, packedMesh->scale);
+
+        [EAGLContext setCurrentContext:context];
+
+        if (!TGLARShapeGeometryInitPackedMesh(&_geometry, packedMesh)) return nil;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    if (self.context) {
+
+        [EAGLContext setCurrentContext:self.context];
+
+        TGLARShapeGeometryDestroy(&_geometry);
+    }
+}
+
+#pragma mark - Methods
+
+- (NSUInteger)triangleCountAtLevel:(NSUInteger)level {
+
+    return (level < self.levelCount) ? _levelIndexCount[level] / 3 : 0;
+}
+
+- (NSUInteger)levelForPixelsPerUnit:(float)pixelsPerUnit {
+
+    NSUInteger level = 0;
+
+    while (level + 1 < self.levelCount && _levelError[level + 1] * pixelsPerUnit < kTGLARMeshLODPixelError) level++;
+
+    return level;
+}
+
+- (void)drawLevel:(NSUInteger)level {
+
+    if (level >= self.levelCount) level = self.levelCount - 1;
+
+    TGLARShapeGeometryDraw(&_geometry, (uint32_t)_levelFirstIndex[level], (uint32_t)_levelIndexCount[level]);
+}
+
+#pragma mark - Loading
+
++ (BOOL)loadMeshData:(TGLARMeshData *)meshData contentsOfURL:(NSURL *)url {
+
+    NSData *data = [NSData dataWithContentsOfURL:url options:NSDataReadingMappedIfSafe error:nil];
+
+    if (data == nil) return NO;
+
+    NSString *extension = url.pathExtension.lowercaseString;
+
+    if ([extension isEqualToString:@"obj"]) {
+
+        // The parser expects a NUL-terminated string
+        //
+        NSMutableData *text = [data mutableCopy];
+
+        [text increaseLengthBy:1];
+
+        return TGLARMeshParseOBJ(meshData, text.bytes);
+    }
+
+    NSData *binaryChunk = nil;
+
+    if (data.length >= 20 && *(const uint32_t *)data.bytes == kTGLARGLBMagic) {
+
+        data = [self chunksOfBinaryGLTF:data binaryChunk:&binaryChunk];
+
+        if (data == nil) return NO;
+    }
+
+    NSDictionary *gltf = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+
+    if (![gltf isKindOfClass:[NSDictionary class]]) return NO;
+
+    NSMutableArray<NSData *> *buffers = [NSMutableArray array];
+
+    for (NSDictionary *buffer in gltf[@"buffers"]) {
+
+        NSString *uri = buffer[@"uri"];
+        NSData *bufferData = nil;
+
+        if (uri == nil) {
+
+            bufferData = binaryChunk;
+
+        } else if ([uri hasPrefix:@"data:"]) {
+
+            NSRange range = [uri rangeOfString:@";base64,"];
+
+            if (range.location != NSNotFound) bufferData = [[NSData alloc] initWithBase64EncodedString:[uri substringFromIndex:NSMaxRange(range)] options:0];
+
+        } else {
+
+            NSURL *bufferURL = [NSURL URLWithString:uri relativeToURL:url];
+
+            bufferData = [NSData dataWithContentsOfURL:bufferURL options:NSDataReadingMappedIfSafe error:nil];
+        }
+
+        if (bufferData == nil) return NO;
+
+        [buffers addObject:bufferData];
+    }
+
+    return [self loadMeshData:meshData fromGLTF:gltf buffers:buffers];
+}
+
++ (NSData *)chunksOfBinaryGLTF:(NSData *)data binaryChunk:(NSData **)binaryChunk {
+
+    const uint8_t *bytes = data.bytes;
+    NSUInteger offset = 12;
+    NSData *jsonChunk = nil;
+
+    while (offset + 8 <= data.length) {
+
+        uint32_t chunkLength = *(const uint32_t *)(bytes + offset);
+        uint32_t chunkType = *(const uint32_t *)(bytes + offset + 4);
+
+        offset += 8;
+
+        if (chunkLength > data.length - offset) return nil;
+
+        NSData *chunk = [data subdataWithRange:NSMakeRange(offset, chunkLength)];
+
+        if (chunkType == kTGLARGLBChunkJSON && jsonChunk == nil) jsonChunk = chunk;
+        if (chunkType == kTGLARGLBChunkBIN && *binaryChunk == nil) *binaryChunk = chunk;
+
+        offset += chunkLength;
+    }
+
+    return jsonChunk;
+}
+
++ (BOOL)loadMeshData:(TGLARMeshData *)meshData fromGLTF:(NSDictionary *)gltf buffers:(NSArray<NSData *> *)buffers {
+
+    NSMutableData *positions = [NSMutableData data];
+    NSMutableData *normals = [NSMutableData data];
+    NSMutableData *texCoords = [NSMutableData data];
+    NSMutableData *indices = [NSMutableData data];
+
+    BOOL missingNormals = NO;
+
+    // Collect mesh nodes of the default scene with their
+    // world transforms, all meshes if there is no scene
+    //
+    NSMutableArray<NSNumber *> *meshIndexes = [NSMutableArray array];
+    NSMutableArray<NSValue *> *meshTransforms = [NSMutableArray array];
+
+    NSArray *scenes = gltf[@"scenes"];
+    NSUInteger sceneIndex = [gltf[@"scene"] unsignedIntegerValue];
+
+    if (sceneIndex < scenes.count) {
+
+        for (NSNumber *node in scenes[sceneIndex][@"nodes"]) {
+
+            [self collectMeshesOfNode:node.unsignedIntegerValue gltf:gltf parentTransform:GLKMatrix4Identity depth:0 meshIndexes:meshIndexes transforms:meshTransforms];
+        }
+
+    } else {
+
+        for (NSUInteger idx = 0; idx < [gltf[@"meshes"] count]; idx++) {
+
+            [meshIndexes addObject:@(idx)];
+            [meshTransforms addObject:[NSValue valueWithBytes:&GLKMatrix4Identity objCType:@encode(GLKMatrix4)]];
+        }
+    }
+
+    NSArray *meshes = gltf[@"meshes"];
+
+    for (NSUInteger idx = 0; idx < meshIndexes.count; idx++) {
+
+        NSUInteger meshIndex = meshIndexes[idx].unsignedIntegerValue;
+
+        if (meshIndex >= meshes.count) return NO;
+
+        GLKMatrix4 transform;
+
+        [meshTransforms[idx] getValue:&transform];
+
+        GLKMatrix3 linearTransform = GLKMatrix4GetMatrix3(transform);
+        GLKMatrix3 normalMatrix = GLKMatrix3InvertAndTranspose(linearTransform, NULL);
+
+        BOOL mirrored = GLKVector3DotProduct(GLKVector3CrossProduct(GLKMatrix3GetColumn(linearTransform, 0), GLKMatrix3GetColumn(linearTransform, 1)), GLKMatrix3GetColumn(linearTransform, 2)) < 0.0f;
+
+        for (NSDictionary *primitive in meshes[meshIndex][@"primitives"]) {
+
+            NSNumber *mode = primitive[@"mode"];
+
+            if (mode && mode.integerValue != GL_TRIANGLES) continue;
+
+            NSDictionary *attributes = primitive[@"attributes"];
+
+            NSData *primitivePositions = [self floatsOfAccessor:attributes[@"POSITION"] components:3 gltf:gltf buffers:buffers];
+
+            if (primitivePositions == nil) return NO;
+
+            uint32_t firstVertex = (uint32_t)(positions.length / (3 * sizeof(float)));
+            NSUInteger firstIndex = indices.length / sizeof(uint32_t);
+            uint32_t vertexCount = (uint32_t)(primitivePositions.length / (3 * sizeof(float)));
+
+            NSData *primitiveNormals = [self floatsOfAccessor:attributes[@"NORMAL"] components:3 gltf:gltf buffers:buffers];
+            NSData *primitiveTexCoords = [self floatsOfAccessor:attributes[@"TEXCOORD_0"] components:2 gltf:gltf buffers:buffers];
+
+            if (primitiveNormals.length != primitivePositions.length) {
+
+                primitiveNormals = [NSMutableData dataWithLength:primitivePositions.length];
+                missingNormals = YES;
+            }
+
+            if (primitiveTexCoords.length != vertexCount * 2 * sizeof(float)) primitiveTexCoords = [NSMutableData dataWithLength:vertexCount * 2 * sizeof(float)];
+
+            const GLKVector3 *vertexPositions = primitivePositions.bytes;
+            const GLKVector3 *vertexNormals = primitiveNormals.bytes;
+
+            for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+
+                GLKVector3 position = GLKMatrix4MultiplyVector3WithTranslation(transform, vertexPositions[vertex]);
+                GLKVector3 normal = GLKMatrix3MultiplyVector3(normalMatrix, vertexNormals[vertex]);
+
+                [positions appendBytes:position.v length:sizeof(position.v)];
+                [normals appendBytes:normal.v length:sizeof(normal.v)];
+            }
+
+            [texCoords appendData:primitiveTexCoords];
+
+            if (primitive[@"indices"]) {
+
+                __block BOOL valid = YES;
+
+                BOOL success = [self enumerateAccessor:primitive[@"indices"] components:1 gltf:gltf buffers:buffers usingBlock:^(NSUInteger element, const double *values) {
+
+                    uint32_t value = firstVertex + (uint32_t)values[0];
+
+                    valid = valid && (values[0] < vertexCount);
+
+                    [indices appendBytes:&value length:sizeof(value)];
+                }];
+
+                if (!success || !valid) return NO;
+
+            } else {
+
+                for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+
+                    uint32_t value = firstVertex + vertex;
+
+                    [indices appendBytes:&value length:sizeof(value)];
+                }
+            }
+
+            // Keep whole triangles so the next primitive starts aligned
+            //
+            indices.length -= (indices.length / sizeof(uint32_t) - firstIndex) % 3 * sizeof(uint32_t);
+
+            // Mirroring transforms flip the winding
+            //
+            if (mirrored) {
+
+                uint32_t *triangles = indices.mutableBytes;
+
+                for (NSUInteger index = firstIndex; index + 2 < indices.length / sizeof(uint32_t); index += 3) {
+
+                    uint32_t swap = triangles[index + 1];
+
+                    triangles[index + 1] = triangles[index + 2];
+                    triangles[index + 2] = swap;
+                }
+            }
+        }
+    }
+
+    if (indices.length == 0) return NO;
+
+    meshData->vertexCount = (uint32_t)(positions.length / (3 * sizeof(float)));
+    meshData->indexCount = (uint32_t)(indices.length / sizeof(uint32_t));
+
+    meshData->positions = malloc(positions.length);
+    meshData->normals = malloc(normals.length);
+    meshData->texCoords = malloc(texCoords.length);
+    meshData->indices = malloc(indices.length);
+
+    if (!meshData->positions || !meshData->normals || !meshData->texCoords || !meshData->indices) {
+
+        TGLARMeshDataDestroy(meshData);
+        return NO;
+    }
+
+    memcpy(meshData->positions, positions.bytes, positions.length);
+    memcpy(meshData->normals, normals.bytes, normals.length);
+    memcpy(meshData->texCoords, texCoords.bytes, texCoords.length);
+    memcpy(meshData->indices, indices.bytes, indices.length);
+
+    if (missingNormals) TGLARMeshComputeNormals(meshData);
+
+    return YES;
+}
+
++ (void)collectMeshesOfNode:(NSUInteger)nodeIndex gltf:(NSDictionary *)gltf parentTransform:(GLKMatrix4)parentTransform depth:(NSUInteger)depth meshIndexes:(NSMutableArray<NSNumber *> *)meshIndexes transforms:(NSMutableArray<NSValue *> *)transforms {
+
+    NSArray *nodes = gltf[@"nodes"];
+
+    if (nodeIndex >= nodes.count || depth > kTGLARGLTFMaxNodeDepth) return;
+
+    NSDictionary *node = nodes[nodeIndex];
+    GLKMatrix4 transform = GLKMatrix4Identity;
+
+    NSArray<NSNumber *> *matrix = node[@"matrix"];
+
+    if (matrix.count == 16) {
+
+        for (NSUInteger idx = 0; idx < 16; idx++) transform.m[idx] = matrix[idx].floatValue;
+
+    } else {
+
+        NSArray<NSNumber *> *translation = node[@"translation"];
+        NSArray<NSNumber *> *rotation = node[@"rotation"];
+        NSArray<NSNumber *> *scale = node[@"scale"];
+
+        if (translation.count == 3) transform = GLKMatrix4Translate(transform, translation[0].floatValue, translation[1].floatValue, translation[2].floatValue);
+
+        if (rotation.count == 4) {
+
+            GLKQuaternion quaternion = GLKQuaternionNormalize(GLKQuaternionMake(rotation[0].floatValue, rotation[1].floatValue, rotation[2].floatValue, rotation[3].floatValue));
+
+            transform = GLKMatrix4Multiply(transform, GLKMatrix4MakeWithQuaternion(quaternion));
+        }
+
+        if (scale.count == 3) transform = GLKMatrix4Scale(transform, scale[0].floatValue, scale[1].floatValue, scale[2].floatValue);
+    }
+
+    transform = GLKMatrix4Multiply(parentTransform, transform);
+
+    if (node[@"mesh"]) {
+
+        [meshIndexes addObject:node[@"mesh"]];
+        [transforms addObject:[NSValue valueWithBytes:&transform objCType:@encode(GLKMatrix4)]];
+    }
+
+    for (NSNumber *child in node[@"children"]) {
+
+        [self collectMeshesOfNode:child.unsignedIntegerValue gltf:gltf parentTransform:transform depth:depth + 1 meshIndexes:meshIndexes transforms:transforms];
+    }
+}
+
++ (BOOL)enumerateAccessor:(NSNumber *)accessorIndex components:(NSUInteger)components gltf:(NSDictionary *)gltf buffers:(NSArray<NSData *> *)buffers usingBlock:(void (^)(NSUInteger element, const double *values))block {
+
+    NSArray *accessors = gltf[@"accessors"];
+
+    if (accessorIndex == nil || accessorIndex.unsignedIntegerValue >= accessors.count) return NO;
+
+    NSDictionary *accessor = accessors[accessorIndex.unsignedIntegerValue];
+    NSDictionary *typeComponents = @{ @"SCALAR": @1, @"VEC2": @2, @"VEC3": @3, @"VEC4": @4 };
+
+    if ([typeComponents[accessor[@"type"]] unsignedIntegerValue] != components) return NO;
+
+    // Sparse accessors without buffer view are not supported
+    //
+    NSArray *bufferViews = gltf[@"bufferViews"];
+    NSNumber *viewIndex = accessor[@"bufferView"];
+
+    if (viewIndex == nil || viewIndex.unsignedIntegerValue >= bufferViews.count) return NO;
+
+    NSDictionary *bufferView = bufferViews[viewIndex.unsignedIntegerValue];
+    NSUInteger bufferIndex = [bufferView[@"buffer"] unsignedIntegerValue];
+
+    if (bufferIndex >= buffers.count) return NO;
+
+    NSData *buffer = buffers[bufferIndex];
+
+    NSInteger componentType = [accessor[@"componentType"] integerValue];
+    size_t componentSize = TGLARGLTFComponentSize(componentType);
+
+    NSUInteger count = [accessor[@"count"] unsignedIntegerValue];
+    NSUInteger stride = [bufferView[@"byteStride"] unsignedIntegerValue];
+    NSUInteger viewOffset = [bufferView[@"byteOffset"] unsignedIntegerValue];
+    NSUInteger viewLength = [bufferView[@"byteLength"] unsignedIntegerValue];
+    NSUInteger offset = viewOffset + [accessor[@"byteOffset"] unsignedIntegerValue];
+
+    if (stride == 0) stride = componentSize * components;
+
+    if (componentSize == 0 || count == 0 || viewOffset + viewLength > buffer.length) return NO;
+    if (offset + stride * (count - 1) + componentSize * components > viewOffset + viewLength) return NO;
+
+    BOOL normalized = [accessor[@"normalized"] boolValue];
+    const uint8_t *bytes = (const uint8_t *)buffer.bytes + offset;
+
+    for (NSUInteger element = 0; element < count; element++) {
+
+        double values[4];
+
+        for (NSUInteger component = 0; component < components; component++) {
+
+            values[component] = TGLARGLTFComponentValue(bytes + element * stride + component * componentSize, componentType, normalized);
+        }
+
+        block(element, values);
+    }
+
+    return YES;
+}
+
++ (NSData *)floatsOfAccessor:(NSNumber *)accessorIndex components:(NSUInteger)components gltf:(NSDictionary *)gltf buffers:(NSArray<NSData *> *)buffers {
+
+    NSMutableData *floats = [NSMutableData data];
+
+    BOOL success = [self enumerateAccessor:accessorIndex components:components gltf:gltf buffers:buffers usingBlock:^(NSUInteger element, const double *values) {
+
+        for (NSUInteger component = 0; component < components; component++) {
+
+            float value = values[component];
+
+            [floats appendBytes:&value length:sizeof(value)];
+        }
+    }];
+
+    return success ? floats : nil;
+}
+
+@end
+
+#pragma mark - Shape interface
+
+@interface TGLARMeshShape ()
+
+@property (nonatomic, strong) TGLARMesh *mesh;
+@property (nonatomic, strong) TGLARStreamedTexture *texture;
+
+@end
+
+#pragma mark - Shape implementation
+
+@implementation TGLARMeshShape
+
+- (instancetype)initWithContext:(EAGLContext *)context mesh:(TGLARMesh *)mesh {
+
+    self = [super initWithContext:context];
+
+    if (self) {
+
+        _mesh = mesh;
+
+        self.material->lighting = 1;
+        self.material->ambientIntensity = 0.4;
+        self.material->diffuseIntensity = 0.8;
+
+        self.color = [UIColor whiteColor];
+    }
+
+    return self;
+}
+
+- (instancetype)initWithContext:(EAGLContext *)context URL:(NSURL *)url {
+
+    self = [self initWithContext:context mesh:nil];
+
+    if (self) {
+
+        __weak TGLARMeshShape *weakSelf = self;
+
+        [TGLARMesh loadMeshWithContentsOfURL:url context:context completion:^(TGLARMesh *mesh) {
+
+            weakSelf.mesh = mesh;
+        }];
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    if (self.context) {
+
+        [EAGLContext setCurrentContext:self.context];
+
+        // Buffers are deleted with the
+        // last shape using the mesh
+        //
+        self.texture = nil;
+    }
+}
+
+#pragma mark - Accessors
+
+- (void)setColor:(UIColor *)color {
+
+    _color = [color copy];
+
+    CGFloat red = 1.0, green = 1.0, blue = 1.0, alpha = 1.0;
+
+    [color getRed:&red green:&green blue:&blue alpha:&alpha];
+
+    self.material->color[0] = red;
+    self.material->color[1] = green;
+    self.material->color[2] = blue;
+    self.material->color[3] = alpha;
+}
+
+- (GLKMatrix4)drawingTransform {
+
+    GLKMatrix4 drawingTransform = [super drawingTransform];
+
+    return self.mesh ? GLKMatrix4Multiply(drawingTransform, self.mesh.decodeMatrix) : drawingTransform;
+}
+
+#pragma mark - Methods
+
+- (BOOL)setImage:(UIImage *)image {
+
+    [EAGLContext setCurrentContext:self.context];
+
+    self.texture = nil;
+    self.material->texture = 0;
+
+    if (image == nil) return YES;
+
+    self.texture = [[TGLARTextureStreamer sharedStreamer] textureWithImage:image context:self.context];
+
+    if (self.texture == nil) {
+
+        NSLog(@"%s Texture image could not be loaded: No bitmap data", __PRETTY_FUNCTION__);
+
+        return NO;
+    }
+
+    return YES;
+}
+
+- (void)requestResources {
+
+    // Texture resolution follows the size on screen
+    //
+    if (self.mesh && self.texture) [self.texture requestProjectedSize:2.0 * self.pixelsPerUnit * self.detailScale];
+}
+
+- (BOOL)draw {
+
+    // Nothing to draw until the mesh is loaded
+    //
+    if (self.mesh == nil) return NO;
+
+    float pixelsPerUnit = self.pixelsPerUnit * self.detailScale;
+
+    if (!self.drawingConstantColor) {
+
+        [self requestResources];
+
+        self.material->texture = self.texture.name;
+        self.material->textureMode = TGLARShapeTextureModeModulate;
+
+        // The light is fixed relative to the world, so
+        // its direction follows the view transformation
+        //
+        GLKVector3 lightDirection = GLKVector3Normalize(GLKMatrix4MultiplyVector3(self.viewMatrix, GLKVector3Make(0.3, 0.2, 1.0)));
+
+        memcpy(self.material->lightDirection, lightDirection.v, sizeof(lightDirection.v));
+    }
+
+    if (![super draw]) return NO;
+
+    _level = [self.mesh levelForPixelsPerUnit:pixelsPerUnit];
+
+    [self.mesh drawLevel:self.level];
+
+    return YES;
+}
+
+#pragma mark - Helpers
+
+- (float)pixelsPerUnit {
+
+    // Approximate the on-screen size of one decoded unit
+    // from the mesh center's distance along the view axis
+    //
+    GLKMatrix4 modelviewMatrix = self.modelviewMatrix;
+    GLKVector3 eyePosition = GLKMatrix4MultiplyVector3WithTranslation(modelviewMatrix, GLKVector3Make(0.0, 0.0, 0.0));
+
+    float distance = MAX(-eyePosition.z, 1.0e-3);
+    float unitLength = GLKVector3Length(GLKVector3Make(modelviewMatrix.m00, modelviewMatrix.m01, modelviewMatrix.m02));
+
+    return unitLength * self.projectionMatrix.m11 * 0.5 * self.viewportSize.height / distance;
+}
+
+@end
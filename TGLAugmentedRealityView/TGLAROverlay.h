@@ -26,6 +26,8 @@
 #import <Foundation/Foundation.h>
 #import <GLKit/GLKVector3.h>
 
+#import "TGLARFloatingOrigin.h"
+
 @class TGLARViewOverlay;
 @class TGLARShapeOverlay;
 
@@ -38,6 +40,11 @@
  * located at the coordinate system origin. The distance
  * values are given in meters.
  *
+ * If the overlay implements @p -worldPosition this method is
+ * not used. The @p TGLARView keeps the position relative to
+ * its floating origin itself instead, see
+ * @p -[TGLARView targetPositionOfOverlayAtIndex:].
+ *
  * The coordinate system is right-handed with positive X axis
  * pointing north, the postive Y axis pointing east and the
  * positive Z axis pointing upwards.
@@ -58,6 +65,20 @@
 
 @optional;
 
+/** Returns the double precision X/Y/Z position this overlay is attached to.
+ *
+ * The position is defined relative to a fixed world reference
+ * point using the same axes as @p -targetPosition. If implemented
+ * the containing @p TGLARView reads it on @p -reloadData and keeps
+ * it in a contiguous buffer, from which target positions relative
+ * to its floating origin are computed whenever the origin moves.
+ *
+ * @return The X/Y/Z world position of the overlay target.
+ *
+ * @sa -[TGLARView cameraWorldPosition]
+ */
+- (TGLARWorldPosition)worldPosition;
+
 /** Returns the view to show for this overlay.
  *
  * If the receiver does not respond to this selector
@@ -80,4 +101,15 @@
  */
 - (nullable TGLARShapeOverlay *)overlayShape;
 
+/** Returns a string identifying this overlay across app launches.
+ *
+ * Derived state of overlays returning an identifier is saved to
+ * and restored from a @p TGLARStateSnapshot.
+ *
+ * @return A stable identifier or @p nil if the state should not be saved.
+ *
+ * @sa -[TGLARView stateSnapshot]
+ */
+- (nullable NSString *)overlayIdentifier;
+
 @end
@@ -40,4 +40,29 @@
 /// An array of @p TGLARViewOverlay objects to be layout out.
 @property (nonatomic, strong, nullable) NSArray<TGLARViewOverlay *> *overlayViews;
 
+/// Overlay target positions owned by the @p TGLARView. If @p NULL, the views' overlays are asked for their @p -targetPosition.
+@property (nonatomic, assign, nullable) const GLKVector3 *targetPositions;
+/// The index into @p targetPositions of each entry in @p overlayViews. Owned by the @p TGLARView.
+@property (nonatomic, assign, nullable) const NSUInteger *targetIndexes;
+
+/// Maximum number of overlay views shown at once, keeping the nearest ones. Default is @p NSUIntegerMax.
+@property (nonatomic, assign) NSUInteger maxVisibleOverlays;
+/// Callout lengths are adjusted on every n-th layout pass only. Default is @p 1.
+@property (nonatomic, assign) NSUInteger calloutUpdateInterval;
+
+/// Culling result of the last layout pass with one flag per entry in @p overlayViews, non-zero if the view is on screen.
+@property (nonatomic, readonly, nullable) const uint8_t *visibleFlags;
+
+/** Returns the visible overlay views close to a point.
+ *
+ * The query uses the screen-space index built during the last layout pass.
+ *
+ * @param point A point in the receiver's coordinate system.
+ * @param radius Maximum distance in points between @p point and a view's frame.
+ * @param maxCount Maximum number of views to return.
+ *
+ * @return The overlay views ordered by ascending distance.
+ */
+- (nonnull NSArray<TGLARViewOverlay *> *)overlayViewsNearPoint:(CGPoint)point radius:(CGFloat)radius maxCount:(NSUInteger)maxCount;
+
 @end
@@ -24,9 +24,29 @@
 //  THE SOFTWARE.
 
 #import "TGLAROverlayContainerView.h"
+#import "TGLAROverlayLayout.h"
 
 #import <GLKit/GLKVector2.h>
 
+#include <stdlib.h>
+
+static const float kTGLAROverlayGridCellSize = 64.0;
+static const size_t kTGLAROverlayHitTestCandidates = 32;
+
+@interface TGLAROverlayContainerView () {
+
+    TGLAROverlayLayout _layout;
+
+    NSUInteger *_visibleOrder;
+    NSUInteger _visibleCount;
+
+    uint8_t *_visibleFlags;
+
+    NSUInteger _layoutCount;
+}
+
+@end
+
 @implementation TGLAROverlayContainerView
 
 - (instancetype)initWithFrame:(CGRect)frame {
@@ -54,6 +74,19 @@
     _contentView.opaque = NO;
 
     [self addSubview:_contentView];
+
+    _maxVisibleOverlays = NSUIntegerMax;
+    _calloutUpdateInterval = 1;
+
+    TGLAROverlayLayoutInit(&_layout, kTGLAROverlayGridCellSize);
+}
+
+- (void)dealloc {
+
+    TGLAROverlayLayoutDestroy(&_layout);
+
+    free(_visibleOrder);
+    free(_visibleFlags);
 }
 
 #pragma mark - Accessors
@@ -67,9 +100,30 @@
     
     _overlayViews = overlayViews;
     
+    // Views stay in the hierarchy and are hidden
+    // while off screen. Layout only reorders them
+    //
+    free(_visibleOrder);
+
+    _visibleOrder = calloc(MAX(overlayViews.count, 1), sizeof(NSUInteger));
+    _visibleCount = 0;
+
+    free(_visibleFlags);
+
+    _visibleFlags = calloc(MAX(overlayViews.count, 1), sizeof(uint8_t));
+
+    TGLARScreenGridBuild(&_layout.grid, 0.0, 0.0, NULL, 0);
+
+    for (TGLARViewOverlay *view in overlayViews) [self.contentView addSubview:view];
+
     [self setNeedsLayout];
 }
 
+- (const uint8_t *)visibleFlags {
+
+    return _visibleFlags;
+}
+
 - (void)setOverlayTransformation:(GLKMatrix4)overlayTransformation {
     
     _overlayTransformation = overlayTransformation;
@@ -105,43 +159,78 @@
 
     // Perform 3D viewing transformation and clip invisible overlays
     //
-    NSMutableArray<TGLARViewOverlay *> *visibleViews = [NSMutableArray array];
+    // All scratch data is taken from the layout's frame
+    // arena, so steady state layout passes do not allocate
+    // memory
+    //
+    TGLAROverlayLayoutReset(&_layout);
 
-    for (TGLARViewOverlay *view in self.overlayViews) {
-        
-        GLKVector3 targetPosition = [view.overlay targetPosition];
-        GLKVector4 positionVector = GLKVector4MakeWithVector3(targetPosition, 1.0);
-        GLKVector4 homoVector = GLKMatrix4MultiplyVector4(self.overlayTransformation, positionVector);
+    NSArray<TGLARViewOverlay *> *overlayViews = self.overlayViews;
+    NSUInteger count = overlayViews.count;
+
+    GLKVector3 *positions = TGLARFrameArenaAlloc(&_layout.arena, MAX(count, 1) * sizeof(GLKVector3), __alignof__(GLKVector3));
+
+    if (positions == NULL) {
+
+        [self discardLayout];
+
+        return;
+    }
+
+    const GLKVector3 *targetPositions = self.targetPositions;
+    const NSUInteger *targetIndexes = self.targetIndexes;
+
+    for (NSUInteger index = 0; index < count; index++) {
+
+        positions[index] = (targetPositions && targetIndexes) ? targetPositions[targetIndexes[index]] : [overlayViews[index].overlay targetPosition];
+    }
+
+    GLKMatrix4 overlayTransformation = self.overlayTransformation;
+    uint32_t maxVisibleOverlays = (uint32_t)MIN(self.maxVisibleOverlays, UINT32_MAX);
+
+    if (!TGLAROverlayLayoutProject(&_layout, (const float *)positions, (uint32_t)count, overlayTransformation.m, maxVisibleOverlays, _visibleFlags)) {
+
+        [self discardLayout];
+
+        return;
+    }
+
+    const GLKVector3 *viewPositions = (const GLKVector3 *)_layout.viewPositions;
+
+    for (NSUInteger index = 0; index < count; index++) {
+
+        TGLARViewOverlay *view = overlayViews[index];
+
+        view.viewPosition = viewPositions[index];
+
+        if (!_visibleFlags[index] && !view.hidden) {
 
-        view.viewPosition = GLKVector3Make(homoVector.x / homoVector.w, homoVector.y / homoVector.w, homoVector.z / homoVector.w);
-        
-        GLKVector2 unitPosition = GLKVector2Make(view.viewPosition.x, view.viewPosition.y);
-        float unitLength = GLKVector2Length(unitPosition);
-        
-        if (unitLength < 2.0 && view.viewPosition.z <= 1.0) {
-            
-            [visibleViews addObject:view];
-            
-        } else {
-            
             view.hidden = YES;
             view.calloutLength = 0.0;
         }
+    }
 
-        [view removeFromSuperview];
+    const TGLAROverlayLayoutItem *visibleItems = _layout.items;
+    NSUInteger visibleCount = _layout.visibleCount;
+
+    BOOL orderChanged = (visibleCount != _visibleCount);
+
+    for (NSUInteger idx = 0; idx < visibleCount && !orderChanged; idx++) {
+
+        orderChanged = (_visibleOrder[idx] != visibleItems[idx].index);
     }
-    
-    // Arrange n visible overlays from back (0) to front (n-1)
-    //
-    [visibleViews sortUsingComparator:^NSComparisonResult (TGLARViewOverlay *view1, TGLARViewOverlay *view2) {
 
-        if (view1.viewPosition.z > view2.viewPosition.z) return (NSComparisonResult)NSOrderedAscending;
-        if (view1.viewPosition.z < view2.viewPosition.z) return (NSComparisonResult)NSOrderedDescending;
-        
-        return (NSComparisonResult)NSOrderedSame;
-    }];
+    if (orderChanged) {
+
+        for (NSUInteger idx = 0; idx < visibleCount; idx++) {
 
-    for (TGLARViewOverlay *view in visibleViews) [self.contentView addSubview:view];
+            _visibleOrder[idx] = visibleItems[idx].index;
+
+            [self.contentView bringSubviewToFront:overlayViews[visibleItems[idx].index]];
+        }
+
+        _visibleCount = visibleCount;
+    }
 
     // Position overlays in container and minimize overlap
     //
@@ -149,76 +238,152 @@
     CGFloat calloutOffset = 30.0;
     CGFloat calloutDefault = 120.0;
 
-    for (NSInteger idx = visibleViews.count - 1; idx >= 0; idx--) {
+    CGSize contentSize = self.contentView.bounds.size;
 
-        TGLARViewOverlay *view = visibleViews[idx];
+    BOOL updateCallouts = (_layoutCount++ % MAX(self.calloutUpdateInterval, 1) == 0);
 
-        GLKVector2 unitPosition = GLKVector2Make(view.viewPosition.x, view.viewPosition.y);
-        float unitLength = GLKVector2Length(unitPosition);
+    for (NSInteger idx = visibleCount - 1; idx >= 0; idx--) {
 
-        CGPoint screenPosition;
-        
-        screenPosition.x = round(0.5 * (unitPosition.x + 1.0) * CGRectGetWidth(self.contentView.bounds)) + offset.width;
-        screenPosition.y = round(0.5 * (1.0 - unitPosition.y) * CGRectGetHeight(self.contentView.bounds)) + offset.height;
+        const TGLAROverlayLayoutItem *item = &visibleItems[idx];
+        TGLARViewOverlay *view = overlayViews[item->index];
+
+        GLKVector2 unitPosition = GLKVector2Make(item->viewPosition[0], item->viewPosition[1]);
+        float unitLength = item->unitLength;
+
+        BOOL rightAligned = view.rightAligned;
 
         if (view.hidden) {
 
-            // Newly appearing view needs length
+            // Newly appearing view needs length, unless
+            // restored from a previous run's snapshot
             //
-            if (calloutLength > 0.0) {
-                
-                view.calloutLength = ++calloutLength;
+            if (view.calloutSettled) {
+
+                calloutLength = view.calloutLength;
+
+                view.calloutSettled = NO;
 
             } else {
 
-                view.calloutLength = calloutLength = calloutDefault;
+                if (calloutLength > 0.0) {
+
+                    view.calloutLength = ++calloutLength;
+
+                } else {
+
+                    view.calloutLength = calloutLength = calloutDefault;
+                }
+
+                view.rightAligned = (unitPosition.x > 0.0);
             }
 
-            view.rightAligned = (unitPosition.x > 0.0);
             view.hidden = NO;
 
         } else {
             
-            if (calloutLength == 0.0) {
-                
-                if (view.calloutLength > calloutDefault) {
+            if (updateCallouts) {
+
+                if (calloutLength == 0.0) {
                     
-                    view.calloutLength--;
+                    if (view.calloutLength > calloutDefault) {
+                        
+                        view.calloutLength--;
+                        
+                    } else if (view.calloutLength < calloutDefault) {
+                        
+                        view.calloutLength++;
+                    }
+
+                } else if ((view.calloutLength - calloutLength) > calloutOffset) {
                     
-                } else if (view.calloutLength < calloutDefault) {
+                    view.calloutLength--;
                     
+                } else if ((view.calloutLength - calloutLength) < calloutOffset) {
+                
                     view.calloutLength++;
                 }
-
-            } else if ((view.calloutLength - calloutLength) > calloutOffset) {
-                
-                view.calloutLength--;
-                
-            } else if ((view.calloutLength - calloutLength) < calloutOffset) {
-            
-                view.calloutLength++;
             }
             
             calloutLength = view.calloutLength;
         }
 
-        [view sizeToFit];
-        
-        CGRect frame = view.bounds;
-
-        frame.origin.x = screenPosition.x;
+        CGSize previousSize = view.bounds.size;
 
-        if (view.rightAligned) frame.origin.x -= CGRectGetWidth(frame);
+        [view sizeToFit];
         
-        frame.origin.y = screenPosition.y;
+        CGSize size = view.bounds.size;
+        TGLARScreenRect rect = TGLAROverlayLayoutPlace(&_layout, (uint32_t)idx, contentSize.width, contentSize.height, offset.width, offset.height, size.width, size.height, view.rightAligned, view.upsideDown);
 
-        if (!view.upsideDown) frame.origin.y -= CGRectGetHeight(frame);
+        CGRect frame = CGRectMake(rect.x, rect.y, rect.width, rect.height);
 
         view.frame = frame;
         view.alpha = (unitLength > 1.0) ? MAX(2.0 - unitLength, 0.0) : 1.0;
 
-        [view setNeedsDisplay];
+        // The callout only needs to be redrawn
+        // when its size or alignment changes
+        //
+        if (!CGSizeEqualToSize(previousSize, frame.size) || rightAligned != view.rightAligned) {
+
+            [view setNeedsDisplay];
+        }
+    }
+
+    // Index overlay frames in back to front order
+    // for hit testing until the next layout pass
+    //
+    if (!TGLAROverlayLayoutFinish(&_layout, contentSize.width, contentSize.height)) [self discardLayout];
+}
+
+- (void)discardLayout {
+
+    // Without memory for a layout pass nothing is
+    // shown, so hit tests and the radar do not use
+    // results of an earlier pass
+    //
+    for (TGLARViewOverlay *view in self.overlayViews) {
+
+        if (!view.hidden) {
+
+            view.hidden = YES;
+            view.calloutLength = 0.0;
+        }
+    }
+
+    memset(_visibleFlags, 0, MAX(self.overlayViews.count, 1) * sizeof(uint8_t));
+
+    _visibleCount = 0;
+
+    TGLARScreenGridBuild(&_layout.grid, 0.0, 0.0, NULL, 0);
+}
+
+#pragma mark - Queries
+
+- (NSArray<TGLARViewOverlay *> *)overlayViewsNearPoint:(CGPoint)point radius:(CGFloat)radius maxCount:(NSUInteger)maxCount {
+
+    NSMutableArray<TGLARViewOverlay *> *views = [NSMutableArray array];
+
+    // No more overlays than visible can be found,
+    // which also keeps the buffer size from overflowing
+    //
+    maxCount = MIN(maxCount, _visibleCount);
+
+    if (maxCount == 0) return views;
+
+    CGPoint contentPoint = [self.contentView convertPoint:point fromView:self];
+
+    NSMutableData *results = [NSMutableData dataWithLength:maxCount * sizeof(uint32_t)];
+    uint32_t *indexes = results.mutableBytes;
+
+    if (indexes == NULL) return views;
+
+    size_t count = TGLARScreenGridQueryRadius(&_layout.grid, contentPoint.x, contentPoint.y, radius, indexes, maxCount);
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        [views addObject:self.overlayViews[_visibleOrder[indexes[idx]]]];
     }
+
+    return views;
 }
 
 #pragma mark - Interaction
@@ -227,10 +392,29 @@
     
     if ([self pointInside:point withEvent:event] && self.isUserInteractionEnabled && !self.isHidden && self.alpha > 0.01) {
         
-        for (UIView *subview in [self.contentView.subviews reverseObjectEnumerator]) {
+        // Only ask views whose frame contains the
+        // point, starting with the front most one
+        //
+        CGPoint contentPoint = [self.contentView convertPoint:point fromView:self];
+
+        // Dense scenes may stack more views in a
+        // cell than fit on the stack, none of them
+        // must be skipped
+        //
+        size_t population = TGLARScreenGridCellPopulation(&_layout.grid, contentPoint.x, contentPoint.y);
+
+        uint32_t stackCandidates[kTGLAROverlayHitTestCandidates];
+        NSMutableData *heapCandidates = (population > kTGLAROverlayHitTestCandidates) ? [NSMutableData dataWithLength:population * sizeof(uint32_t)] : nil;
+        uint32_t *candidates = heapCandidates ? heapCandidates.mutableBytes : stackCandidates;
+
+        size_t count = TGLARScreenGridQueryPoint(&_layout.grid, contentPoint.x, contentPoint.y, candidates, population);
+
+        for (size_t idx = 0; idx < count; idx++) {
             
-            CGPoint convertedPoint = [subview convertPoint:point fromView:self];
-            UIView *hitTestView = [subview hitTest:convertedPoint withEvent:event];
+            TGLARViewOverlay *view = self.overlayViews[_visibleOrder[candidates[idx]]];
+
+            CGPoint convertedPoint = [view convertPoint:point fromView:self];
+            UIView *hitTestView = [view hitTest:convertedPoint withEvent:event];
             
             if (hitTestView) return hitTestView;
         }
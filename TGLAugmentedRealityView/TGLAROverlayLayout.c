@@ -0,0 +1,164 @@
+//
+//  TGLAROverlayLayout.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLAROverlayLayout.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int TGLAROverlayLayoutItemCompare(const void *a, const void *b) {
+
+    const TGLAROverlayLayoutItem *item1 = a;
+    const TGLAROverlayLayoutItem *item2 = b;
+
+    // Arrange from back to front, keeping the
+    // data source order for equal distances
+    //
+    if (item1->viewPosition[2] > item2->viewPosition[2]) return -1;
+    if (item1->viewPosition[2] < item2->viewPosition[2]) return 1;
+
+    if (item1->index < item2->index) return -1;
+    if (item1->index > item2->index) return 1;
+
+    return 0;
+}
+
+void TGLAROverlayLayoutInit(TGLAROverlayLayout *layout, float cellSize) {
+
+    memset(layout, 0, sizeof(TGLAROverlayLayout));
+
+    TGLARFrameArenaInit(&layout->arena, 4096);
+    TGLARScreenGridInit(&layout->grid, cellSize);
+}
+
+void TGLAROverlayLayoutDestroy(TGLAROverlayLayout *layout) {
+
+    TGLARFrameArenaDestroy(&layout->arena);
+    TGLARScreenGridDestroy(&layout->grid);
+
+    memset(layout, 0, sizeof(TGLAROverlayLayout));
+}
+
+void TGLAROverlayLayoutReset(TGLAROverlayLayout *layout) {
+
+    TGLARFrameArenaReset(&layout->arena);
+
+    layout->viewPositions = NULL;
+    layout->items = NULL;
+    layout->rects = NULL;
+    layout->count = 0;
+    layout->visibleCount = 0;
+}
+
+int TGLAROverlayLayoutProject(TGLAROverlayLayout *layout, const float *positions, uint32_t count, const float transformation[16], uint32_t maxVisible, uint8_t *visibleFlags) {
+
+    size_t slots = count ? count : 1;
+
+    float *viewPositions = TGLARFrameArenaAlloc(&layout->arena, 3 * slots * sizeof(float), __alignof__(float));
+    TGLAROverlayLayoutItem *items = TGLARFrameArenaAlloc(&layout->arena, slots * sizeof(TGLAROverlayLayoutItem), __alignof__(TGLAROverlayLayoutItem));
+
+    if (viewPositions == NULL || items == NULL) return 0;
+
+    const float *m = transformation;
+    uint32_t visibleCount = 0;
+
+    for (uint32_t index = 0; index < count; index++) {
+
+        const float *p = positions + 3 * index;
+        float *viewPosition = viewPositions + 3 * index;
+
+        float w = m[3] * p[0] + m[7] * p[1] + m[11] * p[2] + m[15];
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            viewPosition[axis] = (m[axis] * p[0] + m[4 + axis] * p[1] + m[8 + axis] * p[2] + m[12 + axis]) / w;
+        }
+
+        float unitLength = sqrtf(viewPosition[0] * viewPosition[0] + viewPosition[1] * viewPosition[1]);
+        int visible = (unitLength < 2.0f && viewPosition[2] <= 1.0f);
+
+        visibleFlags[index] = (uint8_t)visible;
+
+        if (visible) {
+
+            TGLAROverlayLayoutItem *item = &items[visibleCount++];
+
+            memcpy(item->viewPosition, viewPosition, sizeof(item->viewPosition));
+
+            item->unitLength = unitLength;
+            item->index = index;
+        }
+    }
+
+    // Arrange n visible overlays from back (0) to front (n-1)
+    //
+    qsort(items, visibleCount, sizeof(TGLAROverlayLayoutItem), TGLAROverlayLayoutItemCompare);
+
+    // Keep the nearest overlays at the front if limited
+    //
+    if (visibleCount > maxVisible) {
+
+        uint32_t dropCount = visibleCount - maxVisible;
+
+        for (uint32_t idx = 0; idx < dropCount; idx++) visibleFlags[items[idx].index] = 0;
+
+        items += dropCount;
+        visibleCount -= dropCount;
+    }
+
+    TGLARScreenRect *rects = TGLARFrameArenaAlloc(&layout->arena, (visibleCount ? visibleCount : 1) * sizeof(TGLARScreenRect), __alignof__(TGLARScreenRect));
+
+    if (rects == NULL) return 0;
+
+    layout->viewPositions = viewPositions;
+    layout->count = count;
+    layout->items = items;
+    layout->rects = rects;
+    layout->visibleCount = visibleCount;
+
+    return 1;
+}
+
+TGLARScreenRect TGLAROverlayLayoutPlace(TGLAROverlayLayout *layout, uint32_t visibleIndex, float contentWidth, float contentHeight, float offsetX, float offsetY, float width, float height, int rightAligned, int upsideDown) {
+
+    const TGLAROverlayLayoutItem *item = &layout->items[visibleIndex];
+    TGLARScreenRect *rect = &layout->rects[visibleIndex];
+
+    rect->x = roundf(0.5f * (item->viewPosition[0] + 1.0f) * contentWidth) + offsetX;
+    rect->y = roundf(0.5f * (1.0f - item->viewPosition[1]) * contentHeight) + offsetY;
+    rect->width = width;
+    rect->height = height;
+
+    if (rightAligned) rect->x -= width;
+    if (!upsideDown) rect->y -= height;
+
+    return *rect;
+}
+
+int TGLAROverlayLayoutFinish(TGLAROverlayLayout *layout, float contentWidth, float contentHeight) {
+
+    return TGLARScreenGridBuild(&layout->grid, contentWidth, contentHeight, layout->rects, layout->visibleCount);
+}
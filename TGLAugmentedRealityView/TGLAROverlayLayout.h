@@ -0,0 +1,129 @@
+//
+//  TGLAROverlayLayout.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLAROverlayLayout_h
+#define TGLAROverlayLayout_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TGLARFrameArena.h"
+#include "TGLARScreenGrid.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Per-frame layout state of a single visible overlay view.
+typedef struct {
+
+    /// Normalized device coordinates of the overlay's target position.
+    float viewPosition[3];
+    /// Distance from the screen center in normalized device coordinates.
+    float unitLength;
+    /// Index of the overlay view.
+    uint32_t index;
+
+} TGLAROverlayLayoutItem;
+
+/** The portable part of an overlay container's layout pass.
+ *
+ * A pass projects the overlay target positions, culls overlays off
+ * screen, sorts the visible ones from back to front, places their
+ * rectangles and indexes them in a screen grid for hit testing. All
+ * scratch data is taken from a frame arena, so steady state passes
+ * do not allocate memory.
+ *
+ * A pass is started by @p TGLAROverlayLayoutReset, which invalidates
+ * all results of the previous pass, followed by
+ * @p TGLAROverlayLayoutProject, @p TGLAROverlayLayoutPlace for every
+ * visible overlay and @p TGLAROverlayLayoutFinish.
+ */
+typedef struct {
+
+    TGLARFrameArena arena;
+    TGLARScreenGrid grid;
+
+    /// View positions of all overlays, three floats each.
+    float *viewPositions;
+    uint32_t count;
+
+    /// Visible overlays from back to front.
+    TGLAROverlayLayoutItem *items;
+    /// Rectangles of the visible overlays in the order of @p items.
+    TGLARScreenRect *rects;
+    uint32_t visibleCount;
+
+} TGLAROverlayLayout;
+
+/// Initializes a layout with a hit testing grid of @p cellSize points.
+void TGLAROverlayLayoutInit(TGLAROverlayLayout *layout, float cellSize);
+
+/// Releases all memory held by the layout.
+void TGLAROverlayLayoutDestroy(TGLAROverlayLayout *layout);
+
+/// Starts a layout pass. Memory for its inputs may be taken from @p arena afterwards.
+void TGLAROverlayLayoutReset(TGLAROverlayLayout *layout);
+
+/** Projects, culls and sorts overlays.
+ *
+ * Overlays within twice the screen's half diagonal in normalized device
+ * coordinates and in front of the far plane are visible. If more than
+ * @p maxVisible are visible, the farthest ones are culled.
+ *
+ * @param positions Target positions, three floats per overlay.
+ * @param count Number of overlays.
+ * @param transformation Column-major matrix transforming target positions to clip coordinates.
+ * @param maxVisible Maximum number of visible overlays.
+ * @param visibleFlags Receives a non-zero flag for every visible overlay.
+ *
+ * @return Non-zero on success, zero if memory could not be allocated.
+ */
+int TGLAROverlayLayoutProject(TGLAROverlayLayout *layout, const float *positions, uint32_t count, const float transformation[16], uint32_t maxVisible, uint8_t *visibleFlags);
+
+/** Places the rectangle of a visible overlay view.
+ *
+ * The callout anchor is the projected target position in points,
+ * rounded to whole points and shifted by @p offsetX and @p offsetY.
+ * The rectangle extends left of the anchor if right aligned, and
+ * below it if upside down.
+ *
+ * @param visibleIndex Index into @p items.
+ *
+ * @return The rectangle, also stored in @p rects.
+ */
+TGLARScreenRect TGLAROverlayLayoutPlace(TGLAROverlayLayout *layout, uint32_t visibleIndex, float contentWidth, float contentHeight, float offsetX, float offsetY, float width, float height, int rightAligned, int upsideDown);
+
+/** Indexes the placed rectangles for hit testing until the next pass.
+ *
+ * @return Non-zero on success, zero if memory could not be allocated.
+ */
+int TGLAROverlayLayoutFinish(TGLAROverlayLayout *layout, float contentWidth, float contentHeight);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLAROverlayLayout_h */
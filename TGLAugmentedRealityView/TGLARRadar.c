@@ -0,0 +1,157 @@
+//
+//  TGLARRadar.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARRadar.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int TGLARRadarInit(TGLARRadar *radar, uint32_t resolution) {
+
+    memset(radar, 0, sizeof(TGLARRadar));
+
+    radar->resolution = (resolution > 0) ? resolution : 32;
+
+    size_t binCount = (size_t)radar->resolution * radar->resolution;
+
+    radar->binBlips = calloc(binCount, sizeof(uint32_t));
+    radar->blips = malloc(binCount * sizeof(TGLARRadarBlip));
+
+    if (radar->binBlips == NULL || radar->blips == NULL) {
+
+        TGLARRadarDestroy(radar);
+        return 0;
+    }
+
+    return 1;
+}
+
+void TGLARRadarDestroy(TGLARRadar *radar) {
+
+    free(radar->binBlips);
+    free(radar->blips);
+
+    memset(radar, 0, sizeof(TGLARRadar));
+}
+
+size_t TGLARRadarUpdate(TGLARRadar *radar, const float *positions, const uint8_t *visible, size_t count, const float viewMatrix[16], float range) {
+
+    // Clear only the bins used by the previous update
+    //
+    for (size_t idx = 0; idx < radar->blipCount; idx++) radar->binBlips[radar->blips[idx].bin] = 0;
+
+    radar->blipCount = 0;
+
+    if (radar->binBlips == NULL || range <= 0.0f) return 0;
+
+    const float *m = viewMatrix;
+
+    // Camera position is -R^T * t for a rigid view matrix,
+    // the heading is the camera's -z axis in world space
+    //
+    float cameraX = -(m[0] * m[12] + m[1] * m[13] + m[2] * m[14]);
+    float cameraY = -(m[4] * m[12] + m[5] * m[13] + m[6] * m[14]);
+
+    float forwardX = -m[2];
+    float forwardY = -m[6];
+    float forwardLength = sqrtf(forwardX * forwardX + forwardY * forwardY);
+
+    if (forwardLength < 1.0e-3f) {
+
+        forwardX = m[1];
+        forwardY = m[5];
+        forwardLength = sqrtf(forwardX * forwardX + forwardY * forwardY);
+    }
+
+    if (forwardLength < 1.0e-6f) return 0;
+
+    float scale = 1.0f / (range * forwardLength);
+
+    forwardX *= scale;
+    forwardY *= scale;
+
+    uint32_t resolution = radar->resolution;
+    float binScale = 0.5f * resolution;
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        float dx = positions[3 * idx + 0] - cameraX;
+        float dy = positions[3 * idx + 1] - cameraY;
+
+        // Right is forward x up with up = +z
+        //
+        float x = dx * forwardY - dy * forwardX;
+        float y = dx * forwardX + dy * forwardY;
+
+        if (x * x + y * y > 1.0f) continue;
+
+        uint32_t column = (uint32_t)((x + 1.0f) * binScale);
+        uint32_t row = (uint32_t)((y + 1.0f) * binScale);
+
+        if (column >= resolution) column = resolution - 1;
+        if (row >= resolution) row = resolution - 1;
+
+        uint32_t bin = row * resolution + column;
+        uint32_t blipIndex = radar->binBlips[bin];
+
+        TGLARRadarBlip *blip;
+
+        if (blipIndex == 0) {
+
+            blip = &radar->blips[radar->blipCount++];
+
+            blip->x = 0.0f;
+            blip->y = 0.0f;
+            blip->count = 0;
+            blip->visibleCount = 0;
+            blip->bin = bin;
+
+            radar->binBlips[bin] = (uint32_t)radar->blipCount;
+
+        } else {
+
+            blip = &radar->blips[blipIndex - 1];
+        }
+
+        blip->x += x;
+        blip->y += y;
+        blip->count++;
+
+        if (visible && visible[idx]) blip->visibleCount++;
+    }
+
+    // Blips are drawn at the centroid of their positions
+    //
+    for (size_t idx = 0; idx < radar->blipCount; idx++) {
+
+        TGLARRadarBlip *blip = &radar->blips[idx];
+
+        blip->x /= blip->count;
+        blip->y /= blip->count;
+    }
+
+    return radar->blipCount;
+}
@@ -0,0 +1,96 @@
+//
+//  TGLARRadar.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARRadar_h
+#define TGLARRadar_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A radar blip summarizing all positions falling into one bin.
+ *
+ * Coordinates are in the unit disc with @p +y pointing to the
+ * camera heading and @p +x to its right.
+ */
+typedef struct {
+
+    float x;
+    float y;
+    uint32_t count;
+    uint32_t visibleCount;
+    uint32_t bin;
+
+} TGLARRadarBlip;
+
+/** Projects positions onto a heading-up radar and merges them into bins.
+ *
+ * The radar disc is divided into @p resolution x @p resolution bins,
+ * so the number of blips and thus the drawing cost is bounded no matter
+ * how many positions are passed in. Buffers are allocated once on init.
+ */
+typedef struct {
+
+    uint32_t resolution;
+
+    uint32_t *binBlips;
+
+    TGLARRadarBlip *blips;
+    size_t blipCount;
+
+} TGLARRadar;
+
+/// Initializes a radar with @p resolution bins per axis.
+///
+/// @return Non-zero on success, zero if memory could not be allocated.
+int TGLARRadarInit(TGLARRadar *radar, uint32_t resolution);
+
+/// Releases all memory held by the radar.
+void TGLARRadarDestroy(TGLARRadar *radar);
+
+/** Rebuilds the radar blips from the current camera pose.
+ *
+ * Positions are projected onto the horizontal @p x-y plane around the
+ * camera position. The camera heading is derived from the view matrix,
+ * falling back to the camera's up direction when looking straight down.
+ *
+ * @param positions Packed @p x, @p y, @p z triplets in the view matrix' world space.
+ * @param visible Optional per position flags, non-zero if the position passed view culling.
+ * @param count The number of positions.
+ * @param viewMatrix A rigid column-major view matrix.
+ * @param range Radius of the radar in world units. Positions further away are dropped.
+ *
+ * @return The number of blips in @p radar->blips.
+ */
+size_t TGLARRadarUpdate(TGLARRadar *radar, const float *positions, const uint8_t *visible, size_t count, const float viewMatrix[16], float range);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARRadar_h */
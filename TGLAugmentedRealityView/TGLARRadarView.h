@@ -0,0 +1,68 @@
+//
+//  TGLARRadarView.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <UIKit/UIKit.h>
+#import <GLKit/GLKMatrix4.h>
+
+IB_DESIGNABLE
+
+/** A @p UIView subclass presenting overlay positions around the camera as a heading-up radar.
+ *
+ * The radar is fed by a @p TGLARView with the positions of its overlays,
+ * the view's culling results and view matrix. Positions are merged into
+ * a fixed number of bins, which are drawn in a single batched pass, so
+ * the drawing cost does not grow with the number of overlays.
+ */
+@interface TGLARRadarView : UIView
+
+/// The radar range circle color. Default is @p [UIColor whiteColor].
+@property (nonatomic, copy, nullable) IBInspectable UIColor *rangeColor;
+/// The range circle and heading line width. Default is @p 1.0.
+@property (nonatomic, assign) IBInspectable CGFloat rangeLineWidth;
+
+/// The color of blips outside the camera's field of view. Default is @p [UIColor lightGrayColor].
+@property (nonatomic, copy, nullable) IBInspectable UIColor *blipColor;
+/// The color of blips containing overlays visible on screen. Default is @p [UIColor yellowColor].
+@property (nonatomic, copy, nullable) IBInspectable UIColor *visibleBlipColor;
+/// The radius of a blip representing a single overlay. Default is @p 2.0.
+@property (nonatomic, assign) IBInspectable CGFloat blipRadius;
+
+/// The number of bins per axis overlay positions are merged into. Default is @p 32.
+@property (nonatomic, assign) IBInspectable NSUInteger resolution;
+
+/// The number of blips drawn after the last update.
+@property (nonatomic, readonly) NSUInteger blipCount;
+
+/** Updates the radar from the current camera pose.
+ *
+ * @param positions The overlay target positions.
+ * @param visibleFlags Optional per position flags, non-zero if the overlay passed view culling.
+ * @param count The number of positions.
+ * @param viewMatrix The AR view's view matrix.
+ * @param range The radar radius in world units, e.g. the far clipping distance.
+ */
+- (void)updateWithPositions:(nullable const GLKVector3 *)positions visibleFlags:(nullable const uint8_t *)visibleFlags count:(NSUInteger)count viewMatrix:(GLKMatrix4)viewMatrix range:(CGFloat)range;
+
+@end
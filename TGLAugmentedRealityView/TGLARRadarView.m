@@ -0,0 +1,201 @@
+//
+//  TGLARRadarView.m
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "TGLARRadarView.h"
+#import "TGLARRadar.h"
+
+#include <math.h>
+
+@interface TGLARRadarView () {
+
+    TGLARRadar _radar;
+}
+
+@end
+
+@implementation TGLARRadarView
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder {
+
+    self = [super initWithCoder:aDecoder];
+
+    if (self) [self initRadar];
+
+    return self;
+}
+
+- (instancetype)initWithFrame:(CGRect)frame {
+
+    self = [super initWithFrame:frame];
+
+    if (self) [self initRadar];
+
+    return self;
+}
+
+- (void)initRadar {
+
+    _rangeColor = [UIColor whiteColor];
+    _rangeLineWidth = 1.0;
+
+    _blipColor = [UIColor lightGrayColor];
+    _visibleBlipColor = [UIColor yellowColor];
+    _blipRadius = 2.0;
+
+    _resolution = 32;
+
+    TGLARRadarInit(&_radar, (uint32_t)_resolution);
+}
+
+- (void)dealloc {
+
+    TGLARRadarDestroy(&_radar);
+}
+
+#pragma mark - Accessors
+
+- (void)setRangeColor:(UIColor *)rangeColor {
+
+    _rangeColor = [rangeColor copy];
+
+    [self setNeedsDisplay];
+}
+
+- (void)setRangeLineWidth:(CGFloat)rangeLineWidth {
+
+    _rangeLineWidth = rangeLineWidth;
+
+    [self setNeedsDisplay];
+}
+
+- (void)setBlipColor:(UIColor *)blipColor {
+
+    _blipColor = [blipColor copy];
+
+    [self setNeedsDisplay];
+}
+
+- (void)setVisibleBlipColor:(UIColor *)visibleBlipColor {
+
+    _visibleBlipColor = [visibleBlipColor copy];
+
+    [self setNeedsDisplay];
+}
+
+- (void)setBlipRadius:(CGFloat)blipRadius {
+
+    _blipRadius = blipRadius;
+
+    [self setNeedsDisplay];
+}
+
+- (void)setResolution:(NSUInteger)resolution {
+
+    _resolution = MAX(resolution, 1);
+
+    TGLARRadarDestroy(&_radar);
+    TGLARRadarInit(&_radar, (uint32_t)_resolution);
+
+    [self setNeedsDisplay];
+}
+
+- (NSUInteger)blipCount {
+
+    return _radar.blipCount;
+}
+
+#pragma mark - Methods
+
+- (void)updateWithPositions:(const GLKVector3 *)positions visibleFlags:(const uint8_t *)visibleFlags count:(NSUInteger)count viewMatrix:(GLKMatrix4)viewMatrix range:(CGFloat)range {
+
+    TGLARRadarUpdate(&_radar, (const float *)positions, visibleFlags, positions ? count : 0, viewMatrix.m, range);
+
+    [self setNeedsDisplay];
+}
+
+#pragma mark - Drawing
+
+- (void)drawRect:(CGRect)rect {
+
+    [self.backgroundColor setFill];
+    UIRectFill(self.bounds);
+
+    CGContextRef context = UIGraphicsGetCurrentContext();
+
+    CGFloat centerX = CGRectGetMidX(self.bounds);
+    CGFloat centerY = CGRectGetMidY(self.bounds);
+    CGFloat radius = 0.5 * MIN(CGRectGetWidth(self.bounds), CGRectGetHeight(self.bounds)) - self.rangeLineWidth;
+
+    if (radius <= 0.0) return;
+
+    // Range circle and heading line
+    //
+    [self.rangeColor setStroke];
+
+    CGContextSetLineWidth(context, self.rangeLineWidth);
+    CGContextAddEllipseInRect(context, CGRectMake(centerX - radius, centerY - radius, 2.0 * radius, 2.0 * radius));
+    CGContextMoveToPoint(context, centerX, centerY);
+    CGContextAddLineToPoint(context, centerX, centerY - radius);
+    CGContextStrokePath(context);
+
+    // All blips of the same color are collected
+    // in one path and filled with a single call
+    //
+    for (NSInteger pass = 0; pass < 2; pass++) {
+
+        BOOL visiblePass = (pass == 1);
+
+        for (size_t idx = 0; idx < _radar.blipCount; idx++) {
+
+            const TGLARRadarBlip *blip = &_radar.blips[idx];
+
+            if ((blip->visibleCount > 0) != visiblePass) continue;
+
+            CGFloat blipRadius = self.blipRadius * MIN(1.0 + 0.5 * log2(blip->count), 3.0);
+            CGFloat x = centerX + blip->x * radius;
+            CGFloat y = centerY - blip->y * radius;
+
+            CGContextAddEllipseInRect(context, CGRectMake(x - blipRadius, y - blipRadius, 2.0 * blipRadius, 2.0 * blipRadius));
+        }
+
+        [(visiblePass ? self.visibleBlipColor : self.blipColor) setFill];
+
+        CGContextFillPath(context);
+    }
+}
+
+#pragma mark - Interface Builder
+
+- (void)prepareForInterfaceBuilder {
+
+    [super prepareForInterfaceBuilder];
+
+    GLKVector3 positions[] = { GLKVector3Make(50.0, 0.0, 0.0), GLKVector3Make(0.0, 30.0, 0.0), GLKVector3Make(-20.0, -60.0, 0.0) };
+    uint8_t visibleFlags[] = { 1, 0, 0 };
+
+    [self updateWithPositions:positions visibleFlags:visibleFlags count:3 viewMatrix:GLKMatrix4MakeLookAt(0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0) range:100.0];
+}
+
+@end
@@ -0,0 +1,71 @@
+//
+//  TGLARRenderBackend.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARRenderBackend_h
+#define TGLARRenderBackend_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The platform part of rendering shapes offscreen.
+ *
+ * A backend provides an OpenGL ES 2 context and an RGBA8 render
+ * target with depth buffer. Everything else, i.e. drawing with
+ * @p TGLARShapeRenderer and reading back pixels, is plain OpenGL
+ * ES 2 shared by all platforms: EAGL on iOS, or EGL on Linux,
+ * where Mesa renders without any display.
+ */
+typedef struct {
+
+    /// Passed to the callbacks.
+    void *context;
+
+    /// Makes the backend's context current. Returns non-zero on success.
+    int (*makeCurrent)(void *context);
+    /// Binds a target of the given size, creating it if needed, and sets the viewport. Returns non-zero on success.
+    int (*bindTarget)(void *context, uint32_t width, uint32_t height);
+
+} TGLARRenderBackend;
+
+/** Makes the context current and binds a target for an offscreen frame.
+ *
+ * @return Non-zero on success.
+ */
+int TGLARRenderBackendBegin(const TGLARRenderBackend *backend, uint32_t width, uint32_t height);
+
+/** Reads back the bound target after drawing.
+ *
+ * @param pixels A buffer of @p width * @p height * 4 bytes receiving RGBA8 rows top down.
+ */
+void TGLARRenderBackendReadPixels(const TGLARRenderBackend *backend, uint32_t width, uint32_t height, uint8_t *pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARRenderBackend_h */
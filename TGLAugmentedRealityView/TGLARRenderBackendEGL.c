@@ -0,0 +1,155 @@
+//
+//  TGLARRenderBackendEGL.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARRenderBackendEGL.h"
+
+#include <EGL/eglext.h>
+#include <string.h>
+
+static void TGLARRenderBackendEGLDeleteTarget(TGLARRenderBackendEGL *egl) {
+
+    if (egl->depthRenderbuffer) glDeleteRenderbuffers(1, &egl->depthRenderbuffer);
+    if (egl->colorRenderbuffer) glDeleteRenderbuffers(1, &egl->colorRenderbuffer);
+    if (egl->framebuffer) glDeleteFramebuffers(1, &egl->framebuffer);
+
+    egl->depthRenderbuffer = 0;
+    egl->colorRenderbuffer = 0;
+    egl->framebuffer = 0;
+    egl->width = 0;
+    egl->height = 0;
+}
+
+static int TGLARRenderBackendEGLMakeCurrent(void *context) {
+
+    TGLARRenderBackendEGL *egl = context;
+
+    return eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, egl->context) == EGL_TRUE;
+}
+
+static int TGLARRenderBackendEGLBindTarget(void *context, uint32_t width, uint32_t height) {
+
+    TGLARRenderBackendEGL *egl = context;
+
+    if (egl->framebuffer == 0 || egl->width != width || egl->height != height) {
+
+        TGLARRenderBackendEGLDeleteTarget(egl);
+
+        glGenFramebuffers(1, &egl->framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, egl->framebuffer);
+
+        glGenRenderbuffers(1, &egl->colorRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, egl->colorRenderbuffer);
+
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES, (GLsizei)width, (GLsizei)height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, egl->colorRenderbuffer);
+
+        glGenRenderbuffers(1, &egl->depthRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, egl->depthRenderbuffer);
+
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, (GLsizei)width, (GLsizei)height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, egl->depthRenderbuffer);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+
+            TGLARRenderBackendEGLDeleteTarget(egl);
+            return 0;
+        }
+
+        egl->width = width;
+        egl->height = height;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, egl->framebuffer);
+    glViewport(0, 0, (GLsizei)width, (GLsizei)height);
+
+    return 1;
+}
+
+int TGLARRenderBackendEGLInit(TGLARRenderBackendEGL *egl, TGLARRenderBackend *backend) {
+
+    memset(egl, 0, sizeof(*egl));
+
+    // Prefer Mesa's surfaceless platform, which
+    // needs neither a display server nor a GPU
+    //
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    egl->display = getPlatformDisplay ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL) : EGL_NO_DISPLAY;
+
+    if (egl->display == EGL_NO_DISPLAY) egl->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if (egl->display == EGL_NO_DISPLAY || !eglInitialize(egl->display, NULL, NULL)) {
+
+        egl->display = EGL_NO_DISPLAY;
+        return 0;
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_ES_API)) {
+
+        TGLARRenderBackendEGLDestroy(egl);
+        return 0;
+    }
+
+    // Rendering goes to a framebuffer object, so
+    // any configuration will do, or none at all
+    //
+    const EGLint configAttributes[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT, EGL_NONE };
+    const EGLint contextAttributes[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+
+    EGLConfig config = EGL_NO_CONFIG_KHR;
+    EGLint configCount = 0;
+
+    if (!eglChooseConfig(egl->display, configAttributes, &config, 1, &configCount) || configCount == 0) config = EGL_NO_CONFIG_KHR;
+
+    egl->context = eglCreateContext(egl->display, config, EGL_NO_CONTEXT, contextAttributes);
+
+    if (egl->context == EGL_NO_CONTEXT || !TGLARRenderBackendEGLMakeCurrent(egl)) {
+
+        TGLARRenderBackendEGLDestroy(egl);
+        return 0;
+    }
+
+    backend->context = egl;
+    backend->makeCurrent = TGLARRenderBackendEGLMakeCurrent;
+    backend->bindTarget = TGLARRenderBackendEGLBindTarget;
+
+    return 1;
+}
+
+void TGLARRenderBackendEGLDestroy(TGLARRenderBackendEGL *egl) {
+
+    if (egl->context != EGL_NO_CONTEXT && TGLARRenderBackendEGLMakeCurrent(egl)) TGLARRenderBackendEGLDeleteTarget(egl);
+
+    if (egl->display != EGL_NO_DISPLAY) {
+
+        eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (egl->context != EGL_NO_CONTEXT) eglDestroyContext(egl->display, egl->context);
+
+        eglTerminate(egl->display);
+    }
+
+    memset(egl, 0, sizeof(*egl));
+}
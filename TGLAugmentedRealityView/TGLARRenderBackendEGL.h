@@ -0,0 +1,71 @@
+//
+//  TGLARRenderBackendEGL.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARRenderBackendEGL_h
+#define TGLARRenderBackendEGL_h
+
+#include "TGLARRenderBackend.h"
+#include "TGLARShapeRenderer.h"
+
+#include <EGL/egl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A headless render backend using EGL, e.g. Mesa's llvmpipe on Linux.
+ *
+ * The context is created without any surface and renders into a
+ * framebuffer object recreated whenever the target size changes.
+ */
+typedef struct {
+
+    EGLDisplay display;
+    EGLContext context;
+
+    GLuint framebuffer;
+    GLuint colorRenderbuffer;
+    GLuint depthRenderbuffer;
+    uint32_t width;
+    uint32_t height;
+
+} TGLARRenderBackendEGL;
+
+/** Creates the display connection and context.
+ *
+ * @param backend Receives the callbacks bound to @p egl.
+ *
+ * @return Non-zero on success. Zero if no suitable display or context is available.
+ */
+int TGLARRenderBackendEGLInit(TGLARRenderBackendEGL *egl, TGLARRenderBackend *backend);
+
+/// Releases the target, context and display connection.
+void TGLARRenderBackendEGLDestroy(TGLARRenderBackendEGL *egl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARRenderBackendEGL_h */
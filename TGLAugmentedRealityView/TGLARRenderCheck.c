@@ -0,0 +1,105 @@
+//
+//  TGLARRenderCheck.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARRenderCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void TGLARRenderCheckFlipRows(uint8_t *pixels, uint32_t width, uint32_t height) {
+
+    size_t rowBytes = (size_t)width * 4;
+
+    for (uint32_t y = 0; y < height / 2; y++) {
+
+        uint8_t *top = pixels + (size_t)y * rowBytes;
+        uint8_t *bottom = pixels + (size_t)(height - 1 - y) * rowBytes;
+
+        for (size_t idx = 0; idx < rowBytes; idx++) {
+
+            uint8_t swap = top[idx];
+
+            top[idx] = bottom[idx];
+            bottom[idx] = swap;
+        }
+    }
+}
+
+void TGLARRenderCheckCompare(const uint8_t *pixels, const uint8_t *reference, uint32_t width, uint32_t height, uint8_t tolerance, TGLARImageDifference *difference) {
+
+    size_t count = (size_t)width * height;
+    uint64_t sum = 0;
+
+    memset(difference, 0, sizeof(TGLARImageDifference));
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        int mismatch = 0;
+
+        for (size_t c = 0; c < 4; c++) {
+
+            int a = pixels[4 * idx + c];
+            int b = reference[4 * idx + c];
+            uint8_t delta = (uint8_t)((a > b) ? a - b : b - a);
+
+            if (delta > tolerance) mismatch = 1;
+            if (delta > difference->maxDifference) difference->maxDifference = delta;
+
+            sum += delta;
+        }
+
+        difference->mismatchedPixels += mismatch;
+    }
+
+    if (count > 0) difference->meanDifference = (double)sum / (double)(4 * count);
+}
+
+static int TGLARRenderCheckCompareDouble(const void *a, const void *b) {
+
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+
+    return (da > db) - (da < db);
+}
+
+void TGLARRenderCheckSummarizeTimings(double *samples, size_t count, TGLARTimingSummary *summary) {
+
+    memset(summary, 0, sizeof(TGLARTimingSummary));
+
+    if (count == 0) return;
+
+    qsort(samples, count, sizeof(double), TGLARRenderCheckCompareDouble);
+
+    double sum = 0.0;
+
+    for (size_t idx = 0; idx < count; idx++) sum += samples[idx];
+
+    summary->count = count;
+    summary->min = samples[0];
+    summary->max = samples[count - 1];
+    summary->mean = sum / (double)count;
+    summary->median = samples[count / 2];
+    summary->p95 = samples[(count * 95 - 1) / 100];
+}
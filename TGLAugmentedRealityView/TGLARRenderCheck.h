@@ -0,0 +1,81 @@
+//
+//  TGLARRenderCheck.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARRenderCheck_h
+#define TGLARRenderCheck_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The result of comparing two RGBA8 images.
+typedef struct {
+
+    /// Number of pixels with at least one channel differing by more than the tolerance.
+    uint32_t mismatchedPixels;
+    /// Largest channel difference found.
+    uint8_t maxDifference;
+    /// Mean absolute channel difference.
+    double meanDifference;
+
+} TGLARImageDifference;
+
+/// Summary statistics of a series of frame times.
+typedef struct {
+
+    size_t count;
+    double min;
+    double max;
+    double mean;
+    double median;
+    double p95;
+
+} TGLARTimingSummary;
+
+/// Flips an RGBA8 image vertically in place, e.g. to convert OpenGL rows to top-down order.
+void TGLARRenderCheckFlipRows(uint8_t *pixels, uint32_t width, uint32_t height);
+
+/** Compares two RGBA8 images of the same size.
+ *
+ * @param tolerance Largest channel difference still considered a match.
+ * @param difference Receives the comparison result.
+ */
+void TGLARRenderCheckCompare(const uint8_t *pixels, const uint8_t *reference, uint32_t width, uint32_t height, uint8_t tolerance, TGLARImageDifference *difference);
+
+/** Computes summary statistics of frame times.
+ *
+ * @param samples An array of @p count times. The array is sorted in place.
+ * @param summary Receives the statistics. All values are zero if @p count is zero.
+ */
+void TGLARRenderCheckSummarizeTimings(double *samples, size_t count, TGLARTimingSummary *summary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARRenderCheck_h */
@@ -0,0 +1,93 @@
+//
+//  TGLARRenderDriver.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <GLKit/GLKit.h>
+
+@class TGLARView;
+
+/// The outcome of rendering a single pose with a @p TGLARRenderDriver.
+@interface TGLARRenderResult : NSObject
+
+/// Index of the pose in the array passed to the driver.
+@property (nonatomic, readonly) NSUInteger poseIndex;
+/// URL of the golden image for this pose.
+@property (nonatomic, readonly, nonnull) NSURL *goldenURL;
+/// YES if no golden image existed and the rendered image was stored instead.
+@property (nonatomic, readonly, getter=isRecorded) BOOL recorded;
+/// YES if the rendered image matches the golden image within the driver's tolerances.
+@property (nonatomic, readonly, getter=isPassed) BOOL passed;
+/// Number of pixels exceeding the driver's @p -channelTolerance.
+@property (nonatomic, readonly) NSUInteger mismatchedPixels;
+/// Largest channel difference found.
+@property (nonatomic, readonly) NSUInteger maxDifference;
+/// Time in seconds spent drawing the pose.
+@property (nonatomic, readonly) NSTimeInterval renderTime;
+
+@end
+
+/** Renders a @p TGLARView's shapes from recorded camera poses and compares them to golden images.
+ *
+ * Golden images are PNG files named @p pose-000.png, @p pose-001.png, ...
+ * Each pose is rendered once. Textures are decoded synchronously
+ * during a run, and pending mesh loads and live updates are applied
+ * before drawing, so images do not depend on the timing of background
+ * work.
+ */
+@interface TGLARRenderDriver : NSObject
+
+/// The AR view to render.
+@property (nonatomic, weak, readonly, nullable) TGLARView *arView;
+
+/// Rendered image width in pixels. Default is @p 320.
+@property (nonatomic, assign) NSUInteger width;
+/// Rendered image height in pixels. Default is @p 480.
+@property (nonatomic, assign) NSUInteger height;
+/// Largest channel difference still considered a match. Default is @p 2.
+@property (nonatomic, assign) NSUInteger channelTolerance;
+/// Number of mismatching pixels still considered a pass. Default is @p 0.
+@property (nonatomic, assign) NSUInteger maxMismatchedPixels;
+/// If set to YES, missing golden images are created from the rendered images. Default is @p YES.
+@property (nonatomic, assign) BOOL recordsMissingGoldens;
+
+/// Wraps a camera pose for use in the poses array.
++ (nonnull NSValue *)valueWithPose:(GLKMatrix4)pose;
+
+/// Initializes a driver for the given AR view.
+- (nonnull instancetype)initWithARView:(nonnull TGLARView *)arView;
+
+/** Renders all poses and compares them to the golden images in a directory.
+ *
+ * @param poses An array of camera poses created with @p +valueWithPose:.
+ * @param directory The directory containing the golden images.
+ *
+ * @return One result per pose.
+ */
+- (nonnull NSArray<TGLARRenderResult *> *)runWithPoses:(nonnull NSArray<NSValue *> *)poses goldenDirectory:(nonnull NSURL *)directory;
+
+/// Returns a summary of the render times of the last run.
+- (nonnull NSString *)timingReport;
+
+@end
@@ -0,0 +1,211 @@
+//
+//  TGLARRenderDriver.m
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "TGLARRenderDriver.h"
+#import "TGLARRenderCheck.h"
+#import "TGLARTextureStreamer.h"
+#import "TGLARView.h"
+
+@interface TGLARRenderResult ()
+
+@property (nonatomic, assign) NSUInteger poseIndex;
+@property (nonatomic, strong) NSURL *goldenURL;
+@property (nonatomic, assign) BOOL recorded;
+@property (nonatomic, assign) BOOL passed;
+@property (nonatomic, assign) NSUInteger mismatchedPixels;
+@property (nonatomic, assign) NSUInteger maxDifference;
+@property (nonatomic, assign) NSTimeInterval renderTime;
+
+@end
+
+@implementation TGLARRenderResult
+
+@end
+
+@interface TGLARRenderDriver ()
+
+@property (nonatomic, strong) NSMutableData *renderTimes;
+
+@end
+
+@implementation TGLARRenderDriver
+
++ (NSValue *)valueWithPose:(GLKMatrix4)pose {
+
+    return [NSValue valueWithBytes:&pose objCType:@encode(GLKMatrix4)];
+}
+
+- (instancetype)initWithARView:(TGLARView *)arView {
+
+    self = [super init];
+
+    if (self) {
+
+        _arView = arView;
+
+        _width = 320;
+        _height = 480;
+        _channelTolerance = 2;
+        _maxMismatchedPixels = 0;
+        _recordsMissingGoldens = YES;
+
+        _renderTimes = [NSMutableData data];
+    }
+
+    return self;
+}
+
+#pragma mark - Methods
+
+- (NSArray<TGLARRenderResult *> *)runWithPoses:(NSArray<NSValue *> *)poses goldenDirectory:(NSURL *)directory {
+
+    NSMutableArray<TGLARRenderResult *> *results = [NSMutableArray arrayWithCapacity:poses.count];
+
+    [self.renderTimes setLength:0];
+
+    // Golden images are rendered at full quality
+    // and never depend on background decodes
+    //
+    TGLARTextureStreamer *streamer = [TGLARTextureStreamer sharedStreamer];
+
+    BOOL adaptiveQuality = self.arView.isAdaptingQuality;
+    BOOL decodesSynchronously = streamer.decodesSynchronously;
+
+    self.arView.adaptiveQuality = NO;
+    streamer.decodesSynchronously = YES;
+
+    for (NSUInteger idx = 0; idx < poses.count; idx++) {
+
+        GLKMatrix4 pose;
+
+        [poses[idx] getValue:&pose];
+
+        TGLARRenderResult *result = [[TGLARRenderResult alloc] init];
+
+        result.poseIndex = idx;
+        result.goldenURL = [directory URLByAppendingPathComponent:[NSString stringWithFormat:@"pose-%03lu.png", (unsigned long)idx]];
+
+        NSTimeInterval renderTime = 0.0;
+
+        NSData *pixels = [self.arView renderShapesWithCameraTransform:pose width:self.width height:self.height renderTime:&renderTime];
+
+        result.renderTime = renderTime;
+
+        [self.renderTimes appendBytes:&renderTime length:sizeof(renderTime)];
+
+        NSData *golden = [self pixelsFromImageAtURL:result.goldenURL];
+
+        if (pixels == nil) {
+
+            result.passed = NO;
+
+        } else if (golden == nil) {
+
+            if (self.recordsMissingGoldens) result.recorded = [self writePixels:pixels toImageAtURL:result.goldenURL];
+
+            result.passed = result.recorded;
+
+        } else {
+
+            TGLARImageDifference difference;
+
+            TGLARRenderCheckCompare(pixels.bytes, golden.bytes, (uint32_t)self.width, (uint32_t)self.height, (uint8_t)MIN(self.channelTolerance, 255), &difference);
+
+            result.mismatchedPixels = difference.mismatchedPixels;
+            result.maxDifference = difference.maxDifference;
+            result.passed = (difference.mismatchedPixels <= self.maxMismatchedPixels);
+        }
+
+        [results addObject:result];
+    }
+
+    self.arView.adaptiveQuality = adaptiveQuality;
+    streamer.decodesSynchronously = decodesSynchronously;
+
+    return results;
+}
+
+- (NSString *)timingReport {
+
+    NSMutableData *samples = [self.renderTimes mutableCopy];
+    TGLARTimingSummary summary;
+
+    TGLARRenderCheckSummarizeTimings(samples.mutableBytes, samples.length / sizeof(double), &summary);
+
+    return [NSString stringWithFormat:@"%lu frames: min %.3f ms, median %.3f ms, mean %.3f ms, p95 %.3f ms, max %.3f ms", (unsigned long)summary.count, 1000.0 * summary.min, 1000.0 * summary.median, 1000.0 * summary.mean, 1000.0 * summary.p95, 1000.0 * summary.max];
+}
+
+#pragma mark - Helpers
+
+- (NSData *)pixelsFromImageAtURL:(NSURL *)url {
+
+    UIImage *image = [UIImage imageWithContentsOfFile:url.path];
+
+    if (image.CGImage == NULL) return nil;
+
+    if (CGImageGetWidth(image.CGImage) != self.width || CGImageGetHeight(image.CGImage) != self.height) {
+
+        NSLog(@"%s Golden image size does not match: %@", __PRETTY_FUNCTION__, url.lastPathComponent);
+        return nil;
+    }
+
+    NSMutableData *pixels = [NSMutableData dataWithLength:self.width * self.height * 4];
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef bitmap = CGBitmapContextCreate(pixels.mutableBytes, self.width, self.height, 8, self.width * 4, colorSpace, kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big);
+
+    CGContextSetBlendMode(bitmap, kCGBlendModeCopy);
+    CGContextDrawImage(bitmap, CGRectMake(0, 0, self.width, self.height), image.CGImage);
+
+    CGContextRelease(bitmap);
+    CGColorSpaceRelease(colorSpace);
+
+    return pixels;
+}
+
+- (BOOL)writePixels:(NSData *)pixels toImageAtURL:(NSURL *)url {
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGDataProviderRef provider = CGDataProviderCreateWithCFData((__bridge CFDataRef)pixels);
+    CGImageRef cgImage = CGImageCreate(self.width, self.height, 8, 32, self.width * 4, colorSpace, kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big, provider, NULL, false, kCGRenderingIntentDefault);
+
+    NSData *png = UIImagePNGRepresentation([UIImage imageWithCGImage:cgImage]);
+
+    CGImageRelease(cgImage);
+    CGDataProviderRelease(provider);
+    CGColorSpaceRelease(colorSpace);
+
+    NSError *error = nil;
+
+    if (![png writeToURL:url options:NSDataWritingAtomic error:&error]) {
+
+        NSLog(@"%s Golden image could not be written: %@", __PRETTY_FUNCTION__, error.localizedDescription);
+        return NO;
+    }
+
+    return YES;
+}
+
+@end
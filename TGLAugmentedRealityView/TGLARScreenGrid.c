@@ -0,0 +1,280 @@
+//
+//  TGLARScreenGrid.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARScreenGrid.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int TGLARScreenGridReserve(void **buffer, size_t *capacity, size_t count, size_t size) {
+
+    if (count <= *capacity) return 1;
+
+    size_t newCapacity = (*capacity > 0) ? *capacity : 16;
+
+    while (newCapacity < count) newCapacity *= 2;
+
+    void *newBuffer = realloc(*buffer, newCapacity * size);
+
+    if (newBuffer == NULL) return 0;
+
+    *buffer = newBuffer;
+    *capacity = newCapacity;
+
+    return 1;
+}
+
+static int TGLARScreenGridCellRange(const TGLARScreenGrid *grid, float minX, float minY, float maxX, float maxY, uint32_t *col0, uint32_t *row0, uint32_t *col1, uint32_t *row1) {
+
+    if (grid->columns == 0 || grid->rows == 0) return 0;
+
+    float limitX = grid->columns * grid->cellSize;
+    float limitY = grid->rows * grid->cellSize;
+
+    if (maxX < 0.0f || maxY < 0.0f || minX >= limitX || minY >= limitY) return 0;
+
+    if (minX < 0.0f) minX = 0.0f;
+    if (minY < 0.0f) minY = 0.0f;
+
+    *col0 = (uint32_t)(minX / grid->cellSize);
+    *row0 = (uint32_t)(minY / grid->cellSize);
+    *col1 = (uint32_t)(maxX / grid->cellSize);
+    *row1 = (uint32_t)(maxY / grid->cellSize);
+
+    if (*col1 >= grid->columns) *col1 = grid->columns - 1;
+    if (*row1 >= grid->rows) *row1 = grid->rows - 1;
+
+    return 1;
+}
+
+void TGLARScreenGridInit(TGLARScreenGrid *grid, float cellSize) {
+
+    memset(grid, 0, sizeof(TGLARScreenGrid));
+
+    grid->cellSize = (cellSize > 0.0f) ? cellSize : 64.0f;
+}
+
+void TGLARScreenGridDestroy(TGLARScreenGrid *grid) {
+
+    free(grid->rects);
+    free(grid->cellStart);
+    free(grid->cellItems);
+    free(grid->stamps);
+    free(grid->distances);
+
+    TGLARScreenGridInit(grid, grid->cellSize);
+}
+
+int TGLARScreenGridBuild(TGLARScreenGrid *grid, float width, float height, const TGLARScreenRect *rects, uint32_t count) {
+
+    uint32_t columns = (width > 0.0f) ? (uint32_t)ceilf(width / grid->cellSize) : 0;
+    uint32_t rows = (height > 0.0f) ? (uint32_t)ceilf(height / grid->cellSize) : 0;
+    size_t cellCount = (size_t)columns * rows;
+
+    // Leave an empty grid behind if
+    // memory cannot be allocated
+    //
+    grid->rectCount = 0;
+    grid->columns = 0;
+    grid->rows = 0;
+
+    if (!TGLARScreenGridReserve((void **)&grid->rects, &grid->rectCapacity, count, sizeof(TGLARScreenRect))) return 0;
+    if (!TGLARScreenGridReserve((void **)&grid->cellStart, &grid->cellCapacity, cellCount + 1, sizeof(uint32_t))) return 0;
+
+    if (count > grid->stampCapacity) {
+
+        if (!TGLARScreenGridReserve((void **)&grid->stamps, &grid->stampCapacity, count, sizeof(uint32_t))) return 0;
+
+        memset(grid->stamps, 0, grid->stampCapacity * sizeof(uint32_t));
+
+        grid->stamp = 0;
+    }
+
+    if (count > 0) memcpy(grid->rects, rects, count * sizeof(TGLARScreenRect));
+
+    grid->rectCount = count;
+    grid->columns = columns;
+    grid->rows = rows;
+
+    // Count references per cell and turn the
+    // counts into end offsets of each cell
+    //
+    memset(grid->cellStart, 0, (cellCount + 1) * sizeof(uint32_t));
+
+    size_t itemCount = 0;
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        const TGLARScreenRect *r = &rects[idx];
+        uint32_t col0, row0, col1, row1;
+
+        if (!TGLARScreenGridCellRange(grid, r->x, r->y, r->x + r->width, r->y + r->height, &col0, &row0, &col1, &row1)) continue;
+
+        for (uint32_t row = row0; row <= row1; row++) {
+
+            for (uint32_t col = col0; col <= col1; col++) grid->cellStart[row * columns + col]++;
+        }
+
+        itemCount += (size_t)(col1 - col0 + 1) * (row1 - row0 + 1);
+    }
+
+    for (size_t cell = 1; cell < cellCount; cell++) grid->cellStart[cell] += grid->cellStart[cell - 1];
+
+    grid->cellStart[cellCount] = (uint32_t)itemCount;
+
+    if (!TGLARScreenGridReserve((void **)&grid->cellItems, &grid->itemCapacity, itemCount, sizeof(uint32_t))) {
+
+        grid->rectCount = 0;
+        grid->columns = 0;
+        grid->rows = 0;
+
+        return 0;
+    }
+
+    // Scatter indexes from front to back while moving
+    // the end offsets down to the start offsets. Each
+    // cell ends up listing its indexes back to front
+    //
+    for (uint32_t idx = count; idx-- > 0; ) {
+
+        const TGLARScreenRect *r = &rects[idx];
+        uint32_t col0, row0, col1, row1;
+
+        if (!TGLARScreenGridCellRange(grid, r->x, r->y, r->x + r->width, r->y + r->height, &col0, &row0, &col1, &row1)) continue;
+
+        for (uint32_t row = row0; row <= row1; row++) {
+
+            for (uint32_t col = col0; col <= col1; col++) grid->cellItems[--grid->cellStart[row * columns + col]] = idx;
+        }
+    }
+
+    return 1;
+}
+
+static uint32_t TGLARScreenGridNextStamp(TGLARScreenGrid *grid) {
+
+    if (++grid->stamp == 0) {
+
+        memset(grid->stamps, 0, grid->stampCapacity * sizeof(uint32_t));
+
+        grid->stamp = 1;
+    }
+
+    return grid->stamp;
+}
+
+size_t TGLARScreenGridCellPopulation(const TGLARScreenGrid *grid, float x, float y) {
+
+    uint32_t col0, row0, col1, row1;
+
+    if (!TGLARScreenGridCellRange(grid, x, y, x, y, &col0, &row0, &col1, &row1)) return 0;
+
+    size_t cell = (size_t)row0 * grid->columns + col0;
+
+    return grid->cellStart[cell + 1] - grid->cellStart[cell];
+}
+
+size_t TGLARScreenGridQueryPoint(TGLARScreenGrid *grid, float x, float y, uint32_t *results, size_t maxResults) {
+
+    uint32_t col0, row0, col1, row1;
+
+    if (maxResults == 0 || !TGLARScreenGridCellRange(grid, x, y, x, y, &col0, &row0, &col1, &row1)) return 0;
+
+    // A single cell holds all candidates. Walk it
+    // from its end to report front most ones first
+    //
+    size_t cell = (size_t)row0 * grid->columns + col0;
+    size_t count = 0;
+
+    for (uint32_t item = grid->cellStart[cell + 1]; item-- > grid->cellStart[cell] && count < maxResults; ) {
+
+        uint32_t idx = grid->cellItems[item];
+        const TGLARScreenRect *r = &grid->rects[idx];
+
+        if (x >= r->x && x < r->x + r->width && y >= r->y && y < r->y + r->height) results[count++] = idx;
+    }
+
+    return count;
+}
+
+size_t TGLARScreenGridQueryRadius(TGLARScreenGrid *grid, float x, float y, float radius, uint32_t *results, size_t maxResults) {
+
+    uint32_t col0, row0, col1, row1;
+
+    if (maxResults == 0 || !TGLARScreenGridCellRange(grid, x - radius, y - radius, x + radius, y + radius, &col0, &row0, &col1, &row1)) return 0;
+
+    if (!TGLARScreenGridReserve((void **)&grid->distances, &grid->distanceCapacity, maxResults, sizeof(float))) return 0;
+
+    uint32_t stamp = TGLARScreenGridNextStamp(grid);
+    float radius2 = radius * radius;
+    size_t count = 0;
+
+    for (uint32_t row = row0; row <= row1; row++) {
+
+        for (uint32_t col = col0; col <= col1; col++) {
+
+            size_t cell = (size_t)row * grid->columns + col;
+
+            for (uint32_t item = grid->cellStart[cell]; item < grid->cellStart[cell + 1]; item++) {
+
+                uint32_t idx = grid->cellItems[item];
+
+                // Rectangles spanning several cells
+                // are checked once per query only
+                //
+                if (grid->stamps[idx] == stamp) continue;
+
+                grid->stamps[idx] = stamp;
+
+                const TGLARScreenRect *r = &grid->rects[idx];
+
+                float dx = fmaxf(fmaxf(r->x - x, 0.0f), x - (r->x + r->width));
+                float dy = fmaxf(fmaxf(r->y - y, 0.0f), y - (r->y + r->height));
+                float distance2 = dx * dx + dy * dy;
+
+                if (distance2 > radius2) continue;
+                if (count == maxResults && distance2 >= grid->distances[count - 1]) continue;
+
+                // Insert into the sorted list of
+                // nearest rectangles found so far
+                //
+                size_t pos = (count < maxResults) ? count++ : count - 1;
+
+                while (pos > 0 && grid->distances[pos - 1] > distance2) {
+
+                    grid->distances[pos] = grid->distances[pos - 1];
+                    results[pos] = results[pos - 1];
+                    pos--;
+                }
+
+                grid->distances[pos] = distance2;
+                results[pos] = idx;
+            }
+        }
+    }
+
+    return count;
+}
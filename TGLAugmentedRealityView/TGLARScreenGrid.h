@@ -0,0 +1,126 @@
+//
+//  TGLARScreenGrid.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARScreenGrid_h
+#define TGLARScreenGrid_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// An axis-aligned screen rectangle in points.
+typedef struct {
+
+    float x;
+    float y;
+    float width;
+    float height;
+
+} TGLARScreenRect;
+
+/** A uniform grid indexing screen rectangles for point and radius queries.
+ *
+ * Rectangles are identified by their index in the array passed to
+ * @p TGLARScreenGridBuild. Higher indexes are considered to be in
+ * front of lower ones. Buffers are kept between builds, so rebuilding
+ * the grid for a stable number of rectangles does not allocate memory.
+ */
+typedef struct {
+
+    float cellSize;
+    uint32_t columns;
+    uint32_t rows;
+
+    TGLARScreenRect *rects;
+    uint32_t rectCount;
+    size_t rectCapacity;
+
+    uint32_t *cellStart;
+    size_t cellCapacity;
+
+    uint32_t *cellItems;
+    size_t itemCapacity;
+
+    uint32_t *stamps;
+    size_t stampCapacity;
+    uint32_t stamp;
+
+    float *distances;
+    size_t distanceCapacity;
+
+} TGLARScreenGrid;
+
+/// Initializes an empty grid with square cells of @p cellSize points.
+void TGLARScreenGridInit(TGLARScreenGrid *grid, float cellSize);
+
+/// Releases all memory held by the grid.
+void TGLARScreenGridDestroy(TGLARScreenGrid *grid);
+
+/** Rebuilds the grid for a new set of rectangles.
+ *
+ * @param grid The grid to rebuild.
+ * @param width Width of the indexed screen area. Rectangles are clipped to it.
+ * @param height Height of the indexed screen area. Rectangles are clipped to it.
+ * @param rects The rectangles ordered from back to front.
+ * @param count The number of rectangles.
+ *
+ * @return Non-zero on success, zero if memory could not be allocated. The grid is empty then.
+ */
+int TGLARScreenGridBuild(TGLARScreenGrid *grid, float width, float height, const TGLARScreenRect *rects, uint32_t count);
+
+/** Counts the rectangles overlapping the cell that contains a point.
+ *
+ * This is an upper bound of the number of results of @p TGLARScreenGridQueryPoint
+ * for the same point, so it can be used to size the result buffer.
+ */
+size_t TGLARScreenGridCellPopulation(const TGLARScreenGrid *grid, float x, float y);
+
+/** Finds the rectangles containing a point.
+ *
+ * @param results Receives the rectangle indexes ordered from front to back.
+ * @param maxResults The capacity of @p results.
+ *
+ * @return The number of indexes stored in @p results.
+ */
+size_t TGLARScreenGridQueryPoint(TGLARScreenGrid *grid, float x, float y, uint32_t *results, size_t maxResults);
+
+/** Finds the rectangles closest to a point within a radius.
+ *
+ * @param radius Maximum distance in points between the point and a rectangle's edge.
+ * @param results Receives the indexes of the nearest rectangles ordered by ascending distance.
+ * @param maxResults The capacity of @p results.
+ *
+ * @return The number of indexes stored in @p results.
+ */
+size_t TGLARScreenGridQueryRadius(TGLARScreenGrid *grid, float x, float y, float radius, uint32_t *results, size_t maxResults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARScreenGrid_h */
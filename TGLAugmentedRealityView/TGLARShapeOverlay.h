@@ -27,6 +27,7 @@
 #import <GLKit/GLKit.h>
 
 #import "TGLAROverlay.h"
+#import "TGLARShapeRenderer.h"
 
 /** An object to present 3D content in a @p TGLARView.
  *
@@ -47,26 +48,58 @@
 @property (nonatomic, weak, nullable) EAGLContext * context;
 /// The shape transformation matrix pre-multiplied to @p -viewMatrix.
 @property (nonatomic, assign) GLKMatrix4 transform;
-/// The shape's GLKKit rendering effect. @sa GLKBaseEffect for details.
-@property (nonatomic, readonly, nonnull) GLKBaseEffect *effect;
+/// The shape's color, lighting and texture. Its matrices are set by @p -draw. @sa TGLARShapeMaterial for details.
+@property (nonatomic, readonly, nonnull) TGLARShapeMaterial *material;
 
 /// The OpenGL ES view transformation to be applied. Set by the containing @p TGLARView.
 @property (nonatomic, assign) GLKMatrix4 viewMatrix;
 /// The OpenGL ES projection transformation to be applied. Set by the containing @p TGLARView.
 @property (nonatomic, assign) GLKMatrix4 projectionMatrix;
+/// The size of the OpenGL ES drawable in pixels. Set by the containing @p TGLARView.
+@property (nonatomic, assign) CGSize viewportSize;
+/// Scale applied to the shape's projected size when selecting a level of detail. Set by the containing @p TGLARView. Default is @p 1.0.
+@property (nonatomic, assign) float detailScale;
+/// The position the shape is drawn at, i.e. the overlay's target position. Set by the containing @p TGLARView.
+@property (nonatomic, assign) GLKVector3 targetPosition;
+/// The camera position in the coordinate system of @p -targetPosition. Set by the containing @p TGLARView.
+@property (nonatomic, assign) GLKVector3 cameraPosition;
+
+/** The shape transformation actually applied when drawing.
+ *
+ * Returns @p -transform by default. Subclasses may override this
+ * method to add per-frame transformations without having to modify
+ * @p -transform during drawing.
+ */
+@property (nonatomic, readonly) GLKMatrix4 drawingTransform;
+
+/// The modelview matrix derived from @p -targetPosition, @p -drawingTransform and @p -viewMatrix.
+@property (nonatomic, readonly) GLKMatrix4 modelviewMatrix;
+/// YES while @p -drawUsingConstantColor: draws the shape, so subclasses can skip preparing textures.
+@property (nonatomic, readonly) BOOL drawingConstantColor;
 
 /// Initialize an instance using the given OpenGL ES context.
 - (nullable instancetype)initWithContext:(nonnull EAGLContext *)context;
 
+/** Requests resources needed to draw the shape at the current matrices.
+ *
+ * E.g. texture levels matching the size on screen. @p -draw requests
+ * them as well, but a @p TGLARView calls this method before rendering
+ * offscreen, so the resources are resident for the first pass.
+ *
+ * The base class implementation does nothing.
+ */
+- (void)requestResources;
+
 /** Draws the shape using OpenGL ES.
  *
- * The method implementation initializes the transform property
- * of the @p -effect and calls its @p -prepareToDraw method.
+ * The method implementation sets the matrices of the @p -material
+ * and prepares the shape program shared by all shapes of the
+ * context's share group.
  *
  * Override this method in subclasses to customize the shape.
- * Unless the subclass takes care of setting up the effect as
+ * Unless the subclass takes care of preparing the program as
  * described above, the subcalls implementation @a must call
- * @p [super draw].
+ * @p [super draw] before drawing its geometry.
  *
  * @return YES if drawing succeeds. NO otherwise, e.g. if -context is no longer valid.
  */
@@ -74,7 +107,9 @@
 
 /** Draws the shape using OpenGL ES without any shading and texturing.
  *
- * The base class implementation simply calls @[self -draw].
+ * The base class implementation sets the @p -material to @p color
+ * without lighting and texture, and calls @p [self -draw] with
+ * @p -drawingConstantColor set to YES.
  *
  * This method is used internally to implement picking shapes
  * on an @p TGLARView.
@@ -25,12 +25,96 @@
 
 #import "TGLARShapeOverlay.h"
 
-@interface TGLARShapeOverlay ()
+#pragma mark - Program interface
 
-@property (nonatomic, strong) GLKTextureInfo *textureInfo;
+@interface TGLARShapeProgram : NSObject {
+
+@public
+    TGLARShapeRenderer _renderer;
+}
+
+@property (nonatomic, weak, readonly) EAGLContext *context;
+
+@end
+
+#pragma mark - Program implementation
+
+@implementation TGLARShapeProgram
+
+// Programs can be used by all contexts of a share group,
+// so a single one is shared by all shapes of the group
+// while any of them is alive
+//
++ (instancetype)sharedProgramWithContext:(EAGLContext *)context {
+
+    static NSMapTable<EAGLSharegroup *, TGLARShapeProgram *> *sharedPrograms = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+
+        sharedPrograms = [NSMapTable weakToWeakObjectsMapTable];
+    });
+
+    TGLARShapeProgram *program = [sharedPrograms objectForKey:context.sharegroup];
+
+    if (program.context.sharegroup == context.sharegroup) return program;
+
+    program = [[self alloc] initWithContext:context];
+
+    if (program) [sharedPrograms setObject:program forKey:context.sharegroup];
+
+    return program;
+}
+
+- (instancetype)initWithContext:(EAGLContext *)context {
+
+    self = [super init];
+
+    if (self) {
+
+        _context = context;
+
+        [EAGLContext setCurrentContext:context];
+
+        if (!TGLARShapeRendererInit(&_renderer)) {
+
+            NSLog(@"%s Shape program could not be built", __PRETTY_FUNCTION__);
+            return nil;
+        }
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    if (self.context) {
+
+        EAGLContext *currentContext = [EAGLContext currentContext];
+
+        [EAGLContext setCurrentContext:self.context];
+
+        TGLARShapeRendererDestroy(&_renderer);
+
+        [EAGLContext setCurrentContext:currentContext];
+    }
+}
+
+@end
+
+#pragma mark - Shape interface
+
+@interface TGLARShapeOverlay () {
+
+    TGLARShapeMaterial _material;
+}
+
+@property (nonatomic, strong) TGLARShapeProgram *program;
 
 @end
 
+#pragma mark - Shape implementation
+
 @implementation TGLARShapeOverlay
 
 - (instancetype)initWithContext:(EAGLContext *)context {
@@ -43,8 +127,13 @@
         
         [EAGLContext setCurrentContext:self.context];
         
-        _effect = [[GLKBaseEffect alloc] init];
+        _program = [TGLARShapeProgram sharedProgramWithContext:context];
         _transform = GLKMatrix4Identity;
+        _detailScale = 1.0;
+
+        TGLARShapeMaterialInit(&_material);
+
+        if (_program == nil) return nil;
     }
 
     return self;
@@ -60,27 +149,65 @@
     }
 }
 
+#pragma mark - Accessors
+
+- (TGLARShapeMaterial *)material {
+
+    return &_material;
+}
+
+- (GLKMatrix4)drawingTransform {
+
+    return self.transform;
+}
+
+- (GLKMatrix4)modelviewMatrix {
+
+    GLKVector3 targetPosition = self.targetPosition;
+    GLKMatrix4 positionMatrix = GLKMatrix4MakeTranslation(targetPosition.x, targetPosition.y, targetPosition.z);
+    GLKMatrix4 modelMatrix = GLKMatrix4Multiply(positionMatrix, self.drawingTransform);
+
+    return GLKMatrix4Multiply(self.viewMatrix, modelMatrix);
+}
+
 #pragma mark - Methods
 
+- (void)requestResources {
+
+}
+
 - (BOOL)draw {
     
     if (!self.context) return NO;
     
-    GLKVector3 targetPosition = self.overlay.targetPosition;
-    GLKMatrix4 positionMatrix = GLKMatrix4MakeTranslation(targetPosition.x, targetPosition.y, targetPosition.z);
-    GLKMatrix4 modelMatrix = GLKMatrix4Multiply(positionMatrix, self.transform);
-    
-    self.effect.transform.modelviewMatrix = GLKMatrix4Multiply(self.viewMatrix, modelMatrix);
-    self.effect.transform.projectionMatrix = self.projectionMatrix;
+    GLKMatrix4 modelviewMatrix = self.modelviewMatrix;
+    GLKMatrix4 projectionMatrix = self.projectionMatrix;
+
+    memcpy(_material.modelviewMatrix, modelviewMatrix.m, sizeof(_material.modelviewMatrix));
+    memcpy(_material.projectionMatrix, projectionMatrix.m, sizeof(_material.projectionMatrix));
 
-    [self.effect prepareToDraw];
+    TGLARShapeRendererPrepare(&self.program->_renderer, &_material);
     
     return YES;
 }
 
 - (BOOL)drawUsingConstantColor:(GLKVector4)color {
     
-    return [self draw];
+    TGLARShapeMaterial material = _material;
+
+    memcpy(_material.color, color.v, sizeof(_material.color));
+
+    _material.lighting = 0;
+    _material.textureMode = TGLARShapeTextureModeNone;
+
+    _drawingConstantColor = YES;
+
+    BOOL ok = [self draw];
+
+    _drawingConstantColor = NO;
+    _material = material;
+
+    return ok;
 }
 
 @end
@@ -0,0 +1,369 @@
+//
+//  TGLARShapeRenderer.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARShapeRenderer.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The program covers what the shapes used from
+// GLKBaseEffect: per vertex lighting by one
+// directional light and an optional texture
+//
+static const char *TGLARShapeVertexShader =
+    "attribute vec4 position;\n"
+    "attribute vec3 normal;\n"
+    "attribute vec2 texCoord;\n"
+    "uniform mat4 modelviewMatrix;\n"
+    "uniform mat4 projectionMatrix;\n"
+    "uniform mat3 normalMatrix;\n"
+    "uniform vec4 color;\n"
+    "uniform bool lighting;\n"
+    "uniform vec3 lightDirection;\n"
+    "uniform float ambientIntensity;\n"
+    "uniform float diffuseIntensity;\n"
+    "varying lowp vec4 vertexColor;\n"
+    "varying mediump vec2 vertexTexCoord;\n"
+    "void main() {\n"
+    "    vertexColor = color;\n"
+    "    if (lighting) {\n"
+    "        float diffuse = max(dot(normalize(normalMatrix * normal), lightDirection), 0.0);\n"
+    "        vertexColor.rgb = min(color.rgb * (ambientIntensity + diffuseIntensity * diffuse), 1.0);\n"
+    "    }\n"
+    "    vertexTexCoord = texCoord;\n"
+    "    gl_Position = projectionMatrix * (modelviewMatrix * position);\n"
+    "}\n";
+
+static const char *TGLARShapeFragmentShader =
+    "precision mediump float;\n"
+    "uniform sampler2D textureSampler;\n"
+    "uniform int textureMode;\n"
+    "varying lowp vec4 vertexColor;\n"
+    "varying mediump vec2 vertexTexCoord;\n"
+    "void main() {\n"
+    "    if (textureMode == 1) {\n"
+    "        gl_FragColor = texture2D(textureSampler, vertexTexCoord);\n"
+    "    } else if (textureMode == 2) {\n"
+    "        gl_FragColor = texture2D(textureSampler, vertexTexCoord) * vertexColor;\n"
+    "    } else {\n"
+    "        gl_FragColor = vertexColor;\n"
+    "    }\n"
+    "}\n";
+
+typedef struct {
+
+    float position[3];
+    float texCoord[2];
+    float normal[3];
+
+} TGLARShapeQuadVertex;
+
+static const TGLARShapeQuadVertex TGLARShapeQuadVertices[] = {
+
+    { { 0, +1, -1 }, { 1, 1 }, { 1, 0, 0 } },
+    { { 0, +1, +1 }, { 1, 0 }, { 1, 0, 0 } },
+    { { 0, -1, +1 }, { 0, 0 }, { 1, 0, 0 } },
+    { { 0, -1, -1 }, { 0, 1 }, { 1, 0, 0 } }
+};
+
+static const GLubyte TGLARShapeQuadIndices[] = { 0, 1, 2, 2, 3, 0 };
+
+static GLuint TGLARShapeCompileShader(GLenum type, const char *source) {
+
+    GLuint shader = glCreateShader(type);
+
+    if (shader == 0) return 0;
+
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint compiled = GL_FALSE;
+
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+
+    if (!compiled) {
+
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+static void TGLARShapeNormalMatrix(const float m[16], float normalMatrix[9]) {
+
+    // Inverse transpose of the upper 3x3 matrix, i.e. its
+    // cofactors divided by the determinant. Column major
+    //
+    float a00 = m[0], a10 = m[1], a20 = m[2];
+    float a01 = m[4], a11 = m[5], a21 = m[6];
+    float a02 = m[8], a12 = m[9], a22 = m[10];
+
+    float c00 = a11 * a22 - a12 * a21;
+    float c01 = a12 * a20 - a10 * a22;
+    float c02 = a10 * a21 - a11 * a20;
+    float c10 = a02 * a21 - a01 * a22;
+    float c11 = a00 * a22 - a02 * a20;
+    float c12 = a01 * a20 - a00 * a21;
+    float c20 = a01 * a12 - a02 * a11;
+    float c21 = a02 * a10 - a00 * a12;
+    float c22 = a00 * a11 - a01 * a10;
+
+    float determinant = a00 * c00 + a01 * c01 + a02 * c02;
+    float scale = (fabsf(determinant) > 1.0e-12f) ? 1.0f / determinant : 1.0f;
+
+    normalMatrix[0] = c00 * scale; normalMatrix[3] = c01 * scale; normalMatrix[6] = c02 * scale;
+    normalMatrix[1] = c10 * scale; normalMatrix[4] = c11 * scale; normalMatrix[7] = c12 * scale;
+    normalMatrix[2] = c20 * scale; normalMatrix[5] = c21 * scale; normalMatrix[8] = c22 * scale;
+}
+
+void TGLARShapeMaterialInit(TGLARShapeMaterial *material) {
+
+    memset(material, 0, sizeof(*material));
+
+    for (int idx = 0; idx < 16; idx += 5) {
+
+        material->modelviewMatrix[idx] = 1.0f;
+        material->projectionMatrix[idx] = 1.0f;
+    }
+
+    for (int idx = 0; idx < 4; idx++) material->color[idx] = 1.0f;
+
+    material->lightDirection[2] = 1.0f;
+    material->ambientIntensity = 1.0f;
+    material->textureMode = TGLARShapeTextureModeNone;
+}
+
+int TGLARShapeRendererInit(TGLARShapeRenderer *renderer) {
+
+    memset(renderer, 0, sizeof(*renderer));
+
+    GLuint vertexShader = TGLARShapeCompileShader(GL_VERTEX_SHADER, TGLARShapeVertexShader);
+    GLuint fragmentShader = TGLARShapeCompileShader(GL_FRAGMENT_SHADER, TGLARShapeFragmentShader);
+
+    GLuint program = (vertexShader && fragmentShader) ? glCreateProgram() : 0;
+
+    if (program) {
+
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+
+        glBindAttribLocation(program, TGLARShapeAttribPosition, "position");
+        glBindAttribLocation(program, TGLARShapeAttribNormal, "normal");
+        glBindAttribLocation(program, TGLARShapeAttribTexCoord, "texCoord");
+
+        glLinkProgram(program);
+    }
+
+    // Shaders are only needed until linked
+    //
+    if (vertexShader) glDeleteShader(vertexShader);
+    if (fragmentShader) glDeleteShader(fragmentShader);
+
+    if (program == 0) return 0;
+
+    GLint linked = GL_FALSE;
+
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+
+    if (!linked) {
+
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    renderer->program = program;
+
+    renderer->modelviewMatrix = glGetUniformLocation(program, "modelviewMatrix");
+    renderer->projectionMatrix = glGetUniformLocation(program, "projectionMatrix");
+    renderer->normalMatrix = glGetUniformLocation(program, "normalMatrix");
+    renderer->color = glGetUniformLocation(program, "color");
+    renderer->lighting = glGetUniformLocation(program, "lighting");
+    renderer->lightDirection = glGetUniformLocation(program, "lightDirection");
+    renderer->ambientIntensity = glGetUniformLocation(program, "ambientIntensity");
+    renderer->diffuseIntensity = glGetUniformLocation(program, "diffuseIntensity");
+    renderer->texture = glGetUniformLocation(program, "textureSampler");
+    renderer->textureMode = glGetUniformLocation(program, "textureMode");
+
+    return 1;
+}
+
+void TGLARShapeRendererDestroy(TGLARShapeRenderer *renderer) {
+
+    if (renderer->program) glDeleteProgram(renderer->program);
+
+    memset(renderer, 0, sizeof(*renderer));
+}
+
+void TGLARShapeRendererPrepare(const TGLARShapeRenderer *renderer, const TGLARShapeMaterial *material) {
+
+    float normalMatrix[9];
+
+    TGLARShapeNormalMatrix(material->modelviewMatrix, normalMatrix);
+
+    glUseProgram(renderer->program);
+
+    glUniformMatrix4fv(renderer->modelviewMatrix, 1, GL_FALSE, material->modelviewMatrix);
+    glUniformMatrix4fv(renderer->projectionMatrix, 1, GL_FALSE, material->projectionMatrix);
+    glUniformMatrix3fv(renderer->normalMatrix, 1, GL_FALSE, normalMatrix);
+    glUniform4fv(renderer->color, 1, material->color);
+    glUniform1i(renderer->lighting, material->lighting != 0);
+    glUniform3fv(renderer->lightDirection, 1, material->lightDirection);
+    glUniform1f(renderer->ambientIntensity, material->ambientIntensity);
+    glUniform1f(renderer->diffuseIntensity, material->diffuseIntensity);
+
+    // Without a texture name nothing is sampled
+    //
+    TGLARShapeTextureMode textureMode = material->texture ? material->textureMode : TGLARShapeTextureModeNone;
+
+    glUniform1i(renderer->textureMode, (GLint)textureMode);
+
+    if (textureMode != TGLARShapeTextureModeNone) {
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, material->texture);
+        glUniform1i(renderer->texture, 0);
+    }
+}
+
+int TGLARShapeGeometryInitQuad(TGLARShapeGeometry *geometry, float width, float height) {
+
+    memset(geometry, 0, sizeof(*geometry));
+
+    TGLARShapeQuadVertex vertices[4];
+
+    for (int idx = 0; idx < 4; idx++) {
+
+        vertices[idx] = TGLARShapeQuadVertices[idx];
+
+        vertices[idx].position[1] *= 0.5f * width;
+        vertices[idx].position[2] *= 0.5f * height;
+    }
+
+    glGenBuffers(1, &geometry->vertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, geometry->vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenBuffers(1, &geometry->indexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry->indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(TGLARShapeQuadIndices), TGLARShapeQuadIndices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    geometry->indexType = GL_UNSIGNED_BYTE;
+    geometry->indexSize = sizeof(GLubyte);
+    geometry->indexCount = sizeof(TGLARShapeQuadIndices) / sizeof(TGLARShapeQuadIndices[0]);
+
+    return geometry->vertexBuffer != 0 && geometry->indexBuffer != 0;
+}
+
+int TGLARShapeGeometryInitPackedMesh(TGLARShapeGeometry *geometry, const TGLARPackedMesh *mesh) {
+
+    memset(geometry, 0, sizeof(*geometry));
+
+    // 32 bit indices are only used if needed. All iOS
+    // devices support OES_element_index_uint
+    //
+    const void *indices = mesh->indices;
+    uint16_t *shortIndices = NULL;
+
+    geometry->indexType = GL_UNSIGNED_INT;
+    geometry->indexSize = sizeof(GLuint);
+
+    if (mesh->vertexCount <= UINT16_MAX + 1) {
+
+        shortIndices = malloc((mesh->indexCount ? mesh->indexCount : 1) * sizeof(uint16_t));
+
+        if (shortIndices == NULL) return 0;
+
+        for (uint32_t idx = 0; idx < mesh->indexCount; idx++) shortIndices[idx] = (uint16_t)mesh->indices[idx];
+
+        indices = shortIndices;
+
+        geometry->indexType = GL_UNSIGNED_SHORT;
+        geometry->indexSize = sizeof(GLushort);
+    }
+
+    glGenBuffers(1, &geometry->vertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, geometry->vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, mesh->vertexCount * sizeof(TGLARMeshVertex), mesh->vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenBuffers(1, &geometry->indexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry->indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->indexCount * geometry->indexSize, indices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    free(shortIndices);
+
+    geometry->indexCount = mesh->indexCount;
+    geometry->packed = 1;
+
+    return geometry->vertexBuffer != 0 && geometry->indexBuffer != 0;
+}
+
+void TGLARShapeGeometryDestroy(TGLARShapeGeometry *geometry) {
+
+    if (geometry->vertexBuffer) glDeleteBuffers(1, &geometry->vertexBuffer);
+    if (geometry->indexBuffer) glDeleteBuffers(1, &geometry->indexBuffer);
+
+    memset(geometry, 0, sizeof(*geometry));
+}
+
+void TGLARShapeGeometryDraw(const TGLARShapeGeometry *geometry, uint32_t firstIndex, uint32_t indexCount) {
+
+    if (firstIndex >= geometry->indexCount) return;
+
+    if (indexCount > geometry->indexCount - firstIndex) indexCount = geometry->indexCount - firstIndex;
+
+    glBindBuffer(GL_ARRAY_BUFFER, geometry->vertexBuffer);
+
+    glEnableVertexAttribArray(TGLARShapeAttribPosition);
+    glEnableVertexAttribArray(TGLARShapeAttribNormal);
+    glEnableVertexAttribArray(TGLARShapeAttribTexCoord);
+
+    if (geometry->packed) {
+
+        glVertexAttribPointer(TGLARShapeAttribPosition, 3, GL_SHORT, GL_TRUE, sizeof(TGLARMeshVertex), (const GLvoid *)offsetof(TGLARMeshVertex, position));
+        glVertexAttribPointer(TGLARShapeAttribNormal, 3, GL_BYTE, GL_TRUE, sizeof(TGLARMeshVertex), (const GLvoid *)offsetof(TGLARMeshVertex, normal));
+        glVertexAttribPointer(TGLARShapeAttribTexCoord, 2, GL_HALF_FLOAT_OES, GL_FALSE, sizeof(TGLARMeshVertex), (const GLvoid *)offsetof(TGLARMeshVertex, texCoord));
+
+    } else {
+
+        glVertexAttribPointer(TGLARShapeAttribPosition, 3, GL_FLOAT, GL_FALSE, sizeof(TGLARShapeQuadVertex), (const GLvoid *)offsetof(TGLARShapeQuadVertex, position));
+        glVertexAttribPointer(TGLARShapeAttribNormal, 3, GL_FLOAT, GL_FALSE, sizeof(TGLARShapeQuadVertex), (const GLvoid *)offsetof(TGLARShapeQuadVertex, normal));
+        glVertexAttribPointer(TGLARShapeAttribTexCoord, 2, GL_FLOAT, GL_FALSE, sizeof(TGLARShapeQuadVertex), (const GLvoid *)offsetof(TGLARShapeQuadVertex, texCoord));
+    }
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry->indexBuffer);
+
+    glDrawElements(GL_TRIANGLES, (GLsizei)indexCount, geometry->indexType, (const GLvoid *)(firstIndex * geometry->indexSize));
+
+    glDisableVertexAttribArray(TGLARShapeAttribTexCoord);
+    glDisableVertexAttribArray(TGLARShapeAttribNormal);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
@@ -0,0 +1,167 @@
+//
+//  TGLARShapeRenderer.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARShapeRenderer_h
+#define TGLARShapeRenderer_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__APPLE__)
+#include <OpenGLES/ES2/gl.h>
+#include <OpenGLES/ES2/glext.h>
+#else
+#include <GLES2/gl2.h>
+#include <GLES2/gl2ext.h>
+#endif
+
+#include "TGLARMeshProcessing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Vertex attribute locations used by the shape program.
+enum {
+
+    TGLARShapeAttribPosition = 0,
+    TGLARShapeAttribNormal = 1,
+    TGLARShapeAttribTexCoord = 2
+};
+
+/// How a shape's texture is combined with its color.
+typedef enum {
+
+    /// No texture, the (lit) color is drawn.
+    TGLARShapeTextureModeNone = 0,
+    /// The texture color is drawn as is.
+    TGLARShapeTextureModeReplace = 1,
+    /// The texture color is multiplied by the (lit) color.
+    TGLARShapeTextureModeModulate = 2
+
+} TGLARShapeTextureMode;
+
+/** Everything the shape program needs to draw one shape.
+ *
+ * Matrices are column major. With @p lighting enabled the color is
+ * scaled by @p ambientIntensity plus @p diffuseIntensity times the
+ * cosine between the vertex normal and @p lightDirection per vertex.
+ */
+typedef struct {
+
+    float modelviewMatrix[16];
+    float projectionMatrix[16];
+
+    float color[4];
+
+    int lighting;
+    /// Unit direction towards a directional light in eye coordinates.
+    float lightDirection[3];
+    float ambientIntensity;
+    float diffuseIntensity;
+
+    GLuint texture;
+    TGLARShapeTextureMode textureMode;
+
+} TGLARShapeMaterial;
+
+/// A linked shape program and its uniform locations.
+typedef struct {
+
+    GLuint program;
+
+    GLint modelviewMatrix;
+    GLint projectionMatrix;
+    GLint normalMatrix;
+    GLint color;
+    GLint lighting;
+    GLint lightDirection;
+    GLint ambientIntensity;
+    GLint diffuseIntensity;
+    GLint texture;
+    GLint textureMode;
+
+} TGLARShapeRenderer;
+
+/** Vertex and index buffers of a shape.
+ *
+ * Vertices are either unpacked floats of position, texture
+ * coordinate and normal, or @p TGLARMeshVertex of a packed mesh.
+ */
+typedef struct {
+
+    GLuint vertexBuffer;
+    GLuint indexBuffer;
+    GLenum indexType;
+    size_t indexSize;
+    uint32_t indexCount;
+    int packed;
+
+} TGLARShapeGeometry;
+
+/// Initializes a material with identity matrices, opaque white color, no lighting and no texture.
+void TGLARShapeMaterialInit(TGLARShapeMaterial *material);
+
+/** Compiles and links the shape program in the current context.
+ *
+ * @return Non-zero on success. Zero if the program could not be built, leaving @p renderer empty.
+ */
+int TGLARShapeRendererInit(TGLARShapeRenderer *renderer);
+
+/// Deletes the shape program. The renderer's context must be current.
+void TGLARShapeRendererDestroy(TGLARShapeRenderer *renderer);
+
+/// Uses the shape program and sets its uniforms from @p material.
+void TGLARShapeRendererPrepare(const TGLARShapeRenderer *renderer, const TGLARShapeMaterial *material);
+
+/** Creates a quad of @p width by @p height in the plane x = 0, facing +x, centered at the origin.
+ *
+ * @return Non-zero on success.
+ */
+int TGLARShapeGeometryInitQuad(TGLARShapeGeometry *geometry, float width, float height);
+
+/** Uploads the vertices and indices of all levels of detail of a packed mesh.
+ *
+ * 16 bit indices are used if the vertex count allows.
+ *
+ * @return Non-zero on success.
+ */
+int TGLARShapeGeometryInitPackedMesh(TGLARShapeGeometry *geometry, const TGLARPackedMesh *mesh);
+
+/// Deletes the geometry's buffers. The geometry's context must be current.
+void TGLARShapeGeometryDestroy(TGLARShapeGeometry *geometry);
+
+/** Draws triangles of the geometry with the prepared program.
+ *
+ * @param firstIndex Index of the first index to draw.
+ * @param indexCount Number of indices to draw.
+ */
+void TGLARShapeGeometryDraw(const TGLARShapeGeometry *geometry, uint32_t firstIndex, uint32_t indexCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARShapeRenderer_h */
@@ -0,0 +1,204 @@
+//
+//  TGLARSnapshot.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARSnapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TGLAR_SNAPSHOT_MAGIC 0x534c4754u
+
+typedef struct {
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entrySize;
+    uint32_t count;
+    TGLARSnapshotReference reference;
+    uint64_t checksum;
+
+} TGLARSnapshotHeader;
+
+static const uint64_t kTGLARSnapshotHashPrime = 0x100000001b3ULL;
+
+static int TGLARSnapshotEntryCompare(const void *a, const void *b) {
+
+    const TGLARSnapshotEntry *entry1 = a;
+    const TGLARSnapshotEntry *entry2 = b;
+
+    if (entry1->key < entry2->key) return -1;
+    if (entry1->key > entry2->key) return 1;
+
+    return 0;
+}
+
+// Entries are hashed a word at a time, which keeps validation
+// cheap for large snapshots. Entry hashes depend on the entry
+// index and are finalized before being summed, so the sum is
+// sensitive to changed and reordered entries alike
+//
+static uint64_t TGLARSnapshotEntryHash(const TGLARSnapshotEntry *entry, uint32_t index) {
+
+    const uint64_t *words = (const uint64_t *)entry;
+    uint64_t hash = TGLAR_SNAPSHOT_HASH_SEED ^ index;
+
+    for (size_t idx = 0; idx < sizeof(TGLARSnapshotEntry) / sizeof(uint64_t); idx++) {
+
+        hash ^= words[idx];
+        hash *= kTGLARSnapshotHashPrime;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+static uint64_t TGLARSnapshotChecksum(const TGLARSnapshotEntry *entries, uint32_t count, const TGLARSnapshotHeader *header) {
+
+    uint64_t checksum = TGLARSnapshotHash(header, offsetof(TGLARSnapshotHeader, checksum), TGLAR_SNAPSHOT_HASH_SEED);
+
+    for (uint32_t idx = 0; idx < count; idx++) checksum += TGLARSnapshotEntryHash(&entries[idx], idx);
+
+    return checksum;
+}
+
+uint64_t TGLARSnapshotHash(const void *bytes, size_t length, uint64_t hash) {
+
+    const uint8_t *data = bytes;
+
+    for (size_t idx = 0; idx < length; idx++) {
+
+        hash ^= data[idx];
+        hash *= kTGLARSnapshotHashPrime;
+    }
+
+    return hash;
+}
+
+size_t TGLARSnapshotSize(uint32_t count) {
+
+    return sizeof(TGLARSnapshotHeader) + (size_t)count * sizeof(TGLARSnapshotEntry);
+}
+
+void TGLARSnapshotSortEntries(TGLARSnapshotEntry *entries, uint32_t count) {
+
+    qsort(entries, count, sizeof(TGLARSnapshotEntry), TGLARSnapshotEntryCompare);
+}
+
+size_t TGLARSnapshotWrite(void *buffer, size_t capacity, const TGLARSnapshotEntry *entries, uint32_t count, TGLARSnapshotReference reference) {
+
+    size_t size = TGLARSnapshotSize(count);
+
+    if (capacity < size || ((uintptr_t)buffer % sizeof(uint64_t)) != 0) return 0;
+
+    TGLARSnapshotHeader *header = buffer;
+    TGLARSnapshotEntry *snapshotEntries = (TGLARSnapshotEntry *)(header + 1);
+
+    memset(header, 0, sizeof(TGLARSnapshotHeader));
+
+    header->magic = TGLAR_SNAPSHOT_MAGIC;
+    header->version = TGLAR_SNAPSHOT_VERSION;
+    header->entrySize = sizeof(TGLARSnapshotEntry);
+    header->count = count;
+
+    header->reference = reference;
+
+    if (count > 0) memcpy(snapshotEntries, entries, (size_t)count * sizeof(TGLARSnapshotEntry));
+
+    header->checksum = TGLARSnapshotChecksum(snapshotEntries, count, header);
+
+    return size;
+}
+
+TGLARSnapshotStatus TGLARSnapshotOpen(TGLARSnapshot *snapshot, const void *bytes, size_t length, const TGLARSnapshotReference *reference) {
+
+    memset(snapshot, 0, sizeof(TGLARSnapshot));
+
+    const TGLARSnapshotHeader *header = bytes;
+
+    if (bytes == NULL || length < sizeof(TGLARSnapshotHeader) || ((uintptr_t)bytes % sizeof(uint64_t)) != 0) return TGLARSnapshotStatusCorrupt;
+
+    if (header->magic != TGLAR_SNAPSHOT_MAGIC) return TGLARSnapshotStatusCorrupt;
+    if (header->version != TGLAR_SNAPSHOT_VERSION || header->entrySize != sizeof(TGLARSnapshotEntry)) return TGLARSnapshotStatusVersionMismatch;
+    if (length != TGLARSnapshotSize(header->count)) return TGLARSnapshotStatusCorrupt;
+
+    const TGLARSnapshotEntry *entries = (const TGLARSnapshotEntry *)(header + 1);
+
+    if (TGLARSnapshotChecksum(entries, header->count, header) != header->checksum) return TGLARSnapshotStatusCorrupt;
+
+    snapshot->entries = entries;
+    snapshot->count = header->count;
+
+    snapshot->reference = header->reference;
+
+    if (reference && memcmp(reference, &header->reference, sizeof(TGLARSnapshotReference)) != 0) return TGLARSnapshotStatusReferenceChanged;
+
+    return TGLARSnapshotStatusValid;
+}
+
+int TGLARSnapshotReplaceEntry(void *bytes, size_t length, uint32_t index, const TGLARSnapshotEntry *entry) {
+
+    TGLARSnapshotHeader *header = bytes;
+
+    if (bytes == NULL || length < sizeof(TGLARSnapshotHeader) || index >= header->count || length != TGLARSnapshotSize(header->count)) return 0;
+
+    TGLARSnapshotEntry *entries = (TGLARSnapshotEntry *)(header + 1);
+
+    // Keys must stay sorted for lookups
+    //
+    if (entries[index].key != entry->key) return 0;
+
+    header->checksum -= TGLARSnapshotEntryHash(&entries[index], index);
+
+    entries[index] = *entry;
+
+    header->checksum += TGLARSnapshotEntryHash(&entries[index], index);
+
+    return 1;
+}
+
+const TGLARSnapshotEntry *TGLARSnapshotFind(const TGLARSnapshot *snapshot, uint64_t key) {
+
+    uint32_t low = 0;
+    uint32_t high = snapshot->count;
+
+    while (low < high) {
+
+        uint32_t mid = low + (high - low) / 2;
+
+        if (snapshot->entries[mid].key < key) {
+
+            low = mid + 1;
+
+        } else {
+
+            high = mid;
+        }
+    }
+
+    return (low < snapshot->count && snapshot->entries[low].key == key) ? &snapshot->entries[low] : NULL;
+}
@@ -0,0 +1,162 @@
+//
+//  TGLARSnapshot.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARSnapshot_h
+#define TGLARSnapshot_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The current snapshot file format version.
+#define TGLAR_SNAPSHOT_VERSION 2
+
+/// Initial value for @p TGLARSnapshotHash.
+#define TGLAR_SNAPSHOT_HASH_SEED 0xcbf29ce484222325ULL
+
+/// The geographic coordinate snapshot positions are relative to.
+typedef struct {
+
+    /// Latitude in degrees.
+    double latitude;
+    /// Longitude in degrees.
+    double longitude;
+    /// Altitude in meters.
+    double altitude;
+
+} TGLARSnapshotReference;
+
+static inline TGLARSnapshotReference TGLARSnapshotReferenceMake(double latitude, double longitude, double altitude) {
+
+    TGLARSnapshotReference reference = { latitude, longitude, altitude };
+
+    return reference;
+}
+
+/// The result of validating a snapshot.
+typedef enum {
+
+    /// All entries are valid.
+    TGLARSnapshotStatusValid = 0,
+    /// The snapshot was taken for another reference, entry positions are stale.
+    TGLARSnapshotStatusReferenceChanged,
+    /// The snapshot was written in another format version.
+    TGLARSnapshotStatusVersionMismatch,
+    /// The snapshot is truncated, misaligned or its checksum does not match.
+    TGLARSnapshotStatusCorrupt
+
+} TGLARSnapshotStatus;
+
+/// Flags of a snapshot entry.
+enum {
+
+    TGLARSnapshotEntryHasPosition = 1 << 0,
+    TGLARSnapshotEntryHasCallout = 1 << 1,
+    TGLARSnapshotEntryRightAligned = 1 << 2
+};
+
+/// Derived state of a single overlay.
+typedef struct {
+
+    uint64_t key;
+    double position[3];
+    float calloutLength;
+    uint32_t flags;
+
+} TGLARSnapshotEntry;
+
+/** A read-only view of a snapshot in memory, e.g. a mapped file.
+ *
+ * A snapshot is a header followed by entries sorted by key. It is
+ * validated by checking the header and a checksum over all entries,
+ * without copying or parsing them. The checksum sums hashes of single
+ * entries, so entries can be replaced in place with
+ * @p TGLARSnapshotReplaceEntry. Snapshots use the native byte order and
+ * are meant as local caches, not as an exchange format.
+ */
+typedef struct {
+
+    const TGLARSnapshotEntry *entries;
+    uint32_t count;
+    TGLARSnapshotReference reference;
+
+} TGLARSnapshot;
+
+/// Returns the FNV-1a hash of some bytes, continuing from @p hash.
+uint64_t TGLARSnapshotHash(const void *bytes, size_t length, uint64_t hash);
+
+/// Returns the number of bytes needed to store a snapshot of @p count entries.
+size_t TGLARSnapshotSize(uint32_t count);
+
+/// Sorts entries by key as required by @p TGLARSnapshotWrite.
+void TGLARSnapshotSortEntries(TGLARSnapshotEntry *entries, uint32_t count);
+
+/** Serializes a snapshot.
+ *
+ * @param buffer Receives the snapshot. Must be aligned to 8 bytes.
+ * @param capacity The size of @p buffer.
+ * @param entries Entries sorted by @p TGLARSnapshotSortEntries.
+ * @param count The number of entries.
+ * @param reference The reference the entry positions are relative to.
+ *
+ * @return The number of bytes written, @p 0 if @p buffer is too small.
+ */
+size_t TGLARSnapshotWrite(void *buffer, size_t capacity, const TGLARSnapshotEntry *entries, uint32_t count, TGLARSnapshotReference reference);
+
+/** Validates a serialized snapshot and sets up @p snapshot to access it.
+ *
+ * @param bytes The serialized snapshot. Must be aligned to 8 bytes and stay valid while @p snapshot is used.
+ * @param length The size of @p bytes.
+ * @param reference The expected reference or @p NULL to accept any.
+ *
+ * @return The validation status. Entries are accessible for @p TGLARSnapshotStatusValid and @p TGLARSnapshotStatusReferenceChanged.
+ */
+TGLARSnapshotStatus TGLARSnapshotOpen(TGLARSnapshot *snapshot, const void *bytes, size_t length, const TGLARSnapshotReference *reference);
+
+/** Replaces an entry of a valid serialized snapshot and updates its checksum.
+ *
+ * Only the changed entry and the header are written, so a snapshot file
+ * mapped for writing is refreshed without rewriting it.
+ *
+ * @param bytes A serialized snapshot validated by @p TGLARSnapshotOpen.
+ * @param length The size of @p bytes.
+ * @param index The index of the entry to replace.
+ * @param entry The new entry. Its key must match the key of the replaced entry.
+ *
+ * @return Non-zero on success, zero if @p index is out of range or the keys differ.
+ */
+int TGLARSnapshotReplaceEntry(void *bytes, size_t length, uint32_t index, const TGLARSnapshotEntry *entry);
+
+/// Returns the entry for a key or @p NULL if there is none.
+const TGLARSnapshotEntry *TGLARSnapshotFind(const TGLARSnapshot *snapshot, uint64_t key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARSnapshot_h */
@@ -0,0 +1,107 @@
+//
+//  TGLARStateSnapshot.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+#import "TGLARFloatingOrigin.h"
+#import "TGLARSnapshot.h"
+
+/** Derived overlay state saved by a @p TGLARView to speed up the next start.
+ *
+ * A snapshot holds the world positions and the settled callout lengths
+ * and alignments of overlays implementing @p -[TGLAROverlay overlayIdentifier].
+ * Positions are only meaningful relative to the snapshot's @p -reference,
+ * callout state is independent of it.
+ *
+ * Snapshot files are memory-mapped and validated by a single checksum
+ * pass. Lookups binary search the mapped entries without parsing them.
+ * Files are mapped shared, so a snapshot refreshed in place by
+ * @p +writeEntries:count:reference:previousSnapshot:toURL:error: is
+ * seen by all snapshot objects mapping it.
+ *
+ * @sa -[TGLARView stateSnapshot]
+ */
+@interface TGLARStateSnapshot : NSObject
+
+/// The geographic reference the world positions in this snapshot are relative to.
+@property (nonatomic, readonly) TGLARSnapshotReference reference;
+/// The number of overlays in this snapshot.
+@property (nonatomic, readonly) NSUInteger count;
+
+/** Maps and validates a snapshot file.
+ *
+ * @param url The file URL of the snapshot.
+ *
+ * @return A snapshot or @p nil if the file is missing, corrupt or of another format version.
+ */
++ (nullable instancetype)snapshotWithContentsOfURL:(nonnull NSURL *)url;
+
+/// Returns the snapshot key of an overlay identifier.
++ (uint64_t)keyForIdentifier:(nonnull NSString *)identifier;
+
+/** Writes a snapshot file, unless its contents would not change.
+ *
+ * Entries of @p previousSnapshot not contained in @p entries are kept,
+ * so state of overlays not loaded at the moment is not lost. Their
+ * positions are dropped if @p previousSnapshot has another reference.
+ *
+ * If @p previousSnapshot was mapped from @p url, has the same reference
+ * and contains the same overlays, the file is refreshed in place: only
+ * changed entries and the header are written. Otherwise the file is
+ * replaced atomically. An interrupted in-place refresh leaves a file
+ * failing validation, which is treated like a missing snapshot.
+ *
+ * @param entries The entries to write. They are sorted in place.
+ * @param count The number of entries.
+ * @param reference The reference the entry positions are relative to.
+ * @param previousSnapshot The snapshot to refresh or @p nil.
+ * @param url The file URL to write to.
+ * @param error Receives an error if writing failed.
+ *
+ * @return The snapshot now contained in the file, @p nil if writing failed.
+ */
++ (nullable instancetype)writeEntries:(nonnull TGLARSnapshotEntry *)entries count:(NSUInteger)count reference:(TGLARSnapshotReference)reference previousSnapshot:(nullable TGLARStateSnapshot *)previousSnapshot toURL:(nonnull NSURL *)url error:(NSError * _Nullable * _Nullable)error;
+
+/** Looks up the world position of an overlay.
+ *
+ * @param position Receives the world position relative to @p -reference.
+ * @param identifier The overlay identifier.
+ *
+ * @return @p YES if the snapshot contains a position for @p identifier.
+ */
+- (BOOL)getWorldPosition:(nonnull TGLARWorldPosition *)position forIdentifier:(nonnull NSString *)identifier;
+
+/** Looks up the callout state of an overlay view.
+ *
+ * @param calloutLength Receives the settled callout length.
+ * @param rightAligned Receives the callout alignment.
+ * @param identifier The overlay identifier.
+ *
+ * @return @p YES if the snapshot contains callout state for @p identifier.
+ */
+- (BOOL)getCalloutLength:(nonnull CGFloat *)calloutLength rightAligned:(nonnull BOOL *)rightAligned forIdentifier:(nonnull NSString *)identifier;
+
+@end
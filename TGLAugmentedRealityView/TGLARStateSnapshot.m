@@ -0,0 +1,237 @@
+//
+//  TGLARStateSnapshot.m
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "TGLARStateSnapshot.h"
+
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <fcntl.h>
+#import <unistd.h>
+
+@interface TGLARStateSnapshot () {
+
+    TGLARSnapshot _snapshot;
+}
+
+@property (nonatomic, strong) NSData *data;
+@property (nonatomic, strong) NSURL *url;
+
+@end
+
+@implementation TGLARStateSnapshot
+
+// Maps a whole file shared, so in-place refreshes
+// are visible through all mappings of the file
+//
+static NSData *TGLARStateSnapshotMapFile(NSURL *url, BOOL writable) {
+
+    int fd = open(url.fileSystemRepresentation, writable ? O_RDWR : O_RDONLY);
+
+    if (fd < 0) return nil;
+
+    struct stat info;
+
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+
+        close(fd);
+        return nil;
+    }
+
+    size_t length = (size_t)info.st_size;
+    void *bytes = mmap(NULL, length, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (bytes == MAP_FAILED) return nil;
+
+    return [[NSData alloc] initWithBytesNoCopy:bytes length:length deallocator:^(void *bytes, NSUInteger length) {
+
+        munmap(bytes, length);
+    }];
+}
+
++ (instancetype)snapshotWithContentsOfURL:(NSURL *)url {
+
+    NSData *data = TGLARStateSnapshotMapFile(url, NO);
+
+    if (data == nil) return nil;
+
+    TGLARStateSnapshot *snapshot = [[self alloc] init];
+
+    // Callers decide whether the reference fits,
+    // so any reference is accepted here
+    //
+    if (TGLARSnapshotOpen(&snapshot->_snapshot, data.bytes, data.length, NULL) != TGLARSnapshotStatusValid) return nil;
+
+    snapshot.data = data;
+    snapshot.url = url;
+
+    return snapshot;
+}
+
++ (uint64_t)keyForIdentifier:(NSString *)identifier {
+
+    const char *string = identifier.UTF8String;
+
+    return TGLARSnapshotHash(string, strlen(string), TGLAR_SNAPSHOT_HASH_SEED);
+}
+
++ (instancetype)writeEntries:(TGLARSnapshotEntry *)entries count:(NSUInteger)count reference:(TGLARSnapshotReference)reference previousSnapshot:(TGLARStateSnapshot *)previousSnapshot toURL:(NSURL *)url error:(NSError **)error {
+
+    TGLARSnapshotSortEntries(entries, (uint32_t)count);
+
+    NSMutableData *mergedEntries = [NSMutableData dataWithBytes:entries length:count * sizeof(TGLARSnapshotEntry)];
+
+    BOOL sameReference = NO;
+
+    if (previousSnapshot) {
+
+        const TGLARSnapshot *previous = &previousSnapshot->_snapshot;
+
+        sameReference = (memcmp(&previous->reference, &reference, sizeof(reference)) == 0);
+
+        // Both entry lists are sorted, so a single
+        // merge pass finds the entries to keep
+        //
+        NSUInteger index = 0;
+
+        for (uint32_t idx = 0; idx < previous->count; idx++) {
+
+            TGLARSnapshotEntry entry = previous->entries[idx];
+
+            while (index < count && entries[index].key < entry.key) index++;
+
+            if (index < count && entries[index].key == entry.key) continue;
+
+            if (!sameReference) entry.flags &= ~TGLARSnapshotEntryHasPosition;
+
+            if (entry.flags != 0) [mergedEntries appendBytes:&entry length:sizeof(entry)];
+        }
+    }
+
+    uint32_t mergedCount = (uint32_t)(mergedEntries.length / sizeof(TGLARSnapshotEntry));
+
+    if (mergedCount > count) TGLARSnapshotSortEntries(mergedEntries.mutableBytes, mergedCount);
+
+    if (sameReference && [previousSnapshot.url isEqual:url] && [previousSnapshot refreshEntries:mergedEntries.bytes count:mergedCount]) return previousSnapshot;
+
+    NSMutableData *data = [NSMutableData dataWithLength:TGLARSnapshotSize(mergedCount)];
+
+    TGLARSnapshotWrite(data.mutableBytes, data.length, mergedEntries.bytes, mergedCount, reference);
+
+    NSData *existingData = TGLARStateSnapshotMapFile(url, NO);
+
+    if (![existingData isEqualToData:data] && ![data writeToURL:url options:NSDataWritingAtomic error:error]) return nil;
+
+    TGLARStateSnapshot *snapshot = [self snapshotWithContentsOfURL:url];
+
+    if (snapshot == nil && error) *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError userInfo:@{ NSURLErrorKey: url }];
+
+    return snapshot;
+}
+
+#pragma mark - Refresh
+
+- (BOOL)refreshEntries:(const TGLARSnapshotEntry *)entries count:(uint32_t)count {
+
+    if (count != _snapshot.count) return NO;
+
+    // In-place refreshes can't insert or remove
+    // entries, so the sorted keys must match
+    //
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        if (entries[idx].key != _snapshot.entries[idx].key) return NO;
+    }
+
+    NSData *data = TGLARStateSnapshotMapFile(self.url, YES);
+
+    // The file may have been replaced since it was mapped
+    //
+    TGLARSnapshot snapshot;
+
+    if (data == nil || TGLARSnapshotOpen(&snapshot, data.bytes, data.length, &_snapshot.reference) != TGLARSnapshotStatusValid || snapshot.count != count) return NO;
+
+    void *bytes = (void *)data.bytes;
+    BOOL changed = NO;
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        if (memcmp(&entries[idx], &snapshot.entries[idx], sizeof(TGLARSnapshotEntry)) == 0) continue;
+
+        if (!TGLARSnapshotReplaceEntry(bytes, data.length, idx, &entries[idx])) return NO;
+
+        changed = YES;
+    }
+
+    if (changed) msync(bytes, data.length, MS_ASYNC);
+
+    // Keep the mapping just validated, in case the
+    // file was replaced since this snapshot was mapped
+    //
+    _snapshot = snapshot;
+    self.data = data;
+
+    return YES;
+}
+
+#pragma mark - Accessors
+
+- (TGLARSnapshotReference)reference {
+
+    return _snapshot.reference;
+}
+
+- (NSUInteger)count {
+
+    return _snapshot.count;
+}
+
+#pragma mark - Lookup
+
+- (BOOL)getWorldPosition:(TGLARWorldPosition *)position forIdentifier:(NSString *)identifier {
+
+    const TGLARSnapshotEntry *entry = TGLARSnapshotFind(&_snapshot, [TGLARStateSnapshot keyForIdentifier:identifier]);
+
+    if (entry == NULL || !(entry->flags & TGLARSnapshotEntryHasPosition)) return NO;
+
+    *position = TGLARWorldPositionMake(entry->position[0], entry->position[1], entry->position[2]);
+
+    return YES;
+}
+
+- (BOOL)getCalloutLength:(CGFloat *)calloutLength rightAligned:(BOOL *)rightAligned forIdentifier:(NSString *)identifier {
+
+    const TGLARSnapshotEntry *entry = TGLARSnapshotFind(&_snapshot, [TGLARStateSnapshot keyForIdentifier:identifier]);
+
+    if (entry == NULL || !(entry->flags & TGLARSnapshotEntryHasCallout)) return NO;
+
+    *calloutLength = entry->calloutLength;
+    *rightAligned = (entry->flags & TGLARSnapshotEntryRightAligned) != 0;
+
+    return YES;
+}
+
+@end
@@ -0,0 +1,185 @@
+//
+//  TGLARTextureLevels.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTextureLevels.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+uint32_t TGLARTexturePowerOfTwo(uint32_t value, uint32_t maxValue) {
+
+    uint32_t pot = 1;
+
+    while (pot < value && pot < maxValue) pot <<= 1;
+
+    return (pot > maxValue && maxValue > 0) ? maxValue : pot;
+}
+
+uint32_t TGLARTextureLevelCount(uint32_t width, uint32_t height) {
+
+    uint32_t size = (width > height) ? width : height;
+    uint32_t count = 1;
+
+    while (size > 1) {
+
+        size >>= 1;
+        count++;
+    }
+
+    return count;
+}
+
+size_t TGLARTextureLevelBytes(uint32_t width, uint32_t height, uint32_t level) {
+
+    uint32_t w = width >> level;
+    uint32_t h = height >> level;
+
+    if (w == 0) w = 1;
+    if (h == 0) h = 1;
+
+    return (size_t)w * (size_t)h * 4;
+}
+
+size_t TGLARTextureChainBytes(uint32_t width, uint32_t height, uint32_t firstLevel) {
+
+    uint32_t levelCount = TGLARTextureLevelCount(width, height);
+    size_t bytes = 0;
+
+    for (uint32_t level = firstLevel; level < levelCount; level++) {
+
+        bytes += TGLARTextureLevelBytes(width, height, level);
+    }
+
+    return bytes;
+}
+
+uint32_t TGLARTextureLevelForProjectedSize(uint32_t width, uint32_t height, uint32_t levelCount, float projectedSize) {
+
+    if (levelCount == 0) return 0;
+    if (projectedSize <= 0.0f) return levelCount - 1;
+
+    uint32_t size = (width > height) ? width : height;
+
+    if (projectedSize >= (float)size) return 0;
+
+    // Pick the finest level that is still at least
+    // as large as the projected size, so magnification
+    // never kicks in due to level selection alone
+    //
+    float level = floorf(log2f((float)size / projectedSize));
+
+    if (level < 0.0f) return 0;
+    if (level >= (float)(levelCount - 1)) return levelCount - 1;
+
+    return (uint32_t)level;
+}
+
+void TGLARTextureDownsampleRGBA8(const uint8_t *src, uint32_t width, uint32_t height, uint8_t *dst) {
+
+    uint32_t dstWidth = (width > 1) ? width / 2 : 1;
+    uint32_t dstHeight = (height > 1) ? height / 2 : 1;
+
+    // Neighbour offsets collapse to the same
+    // pixel along a dimension of size 1
+    //
+    size_t dx = (width > 1) ? 4 : 0;
+    size_t dy = (height > 1) ? (size_t)width * 4 : 0;
+
+    for (uint32_t y = 0; y < dstHeight; y++) {
+
+        const uint8_t *row = src + (size_t)(2 * y) * width * 4;
+        uint8_t *out = dst + (size_t)y * dstWidth * 4;
+
+        for (uint32_t x = 0; x < dstWidth; x++) {
+
+            const uint8_t *p = row + (size_t)(2 * x) * 4;
+
+            for (uint32_t c = 0; c < 4; c++) {
+
+                unsigned sum = p[c] + p[c + dx] + p[c + dy] + p[c + dx + dy];
+
+                out[4 * x + c] = (uint8_t)((sum + 2) / 4);
+            }
+        }
+    }
+}
+
+static int TGLARTextureCompareProjectedSize(const void *a, const void *b) {
+
+    float sa = ((const TGLARTextureResidency *)a)->projectedSize;
+    float sb = ((const TGLARTextureResidency *)b)->projectedSize;
+
+    if (sa > sb) return -1;
+    if (sa < sb) return 1;
+
+    return 0;
+}
+
+size_t TGLARTextureResolveResidency(TGLARTextureResidency *entries, size_t count, size_t budget) {
+
+    size_t total = 0;
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        TGLARTextureResidency *entry = &entries[idx];
+
+        if (entry->levelCount == 0) entry->levelCount = TGLARTextureLevelCount(entry->width, entry->height);
+        if (entry->desiredLevel >= entry->levelCount) entry->desiredLevel = entry->levelCount - 1;
+
+        entry->residentLevel = entry->desiredLevel;
+
+        total += TGLARTextureChainBytes(entry->width, entry->height, entry->residentLevel);
+    }
+
+    if (total <= budget) return total;
+
+    qsort(entries, count, sizeof(TGLARTextureResidency), TGLARTextureCompareProjectedSize);
+
+    // Coarsen textures one level per pass, starting
+    // with the smallest ones on screen, until the
+    // budget is met or nothing can be dropped anymore
+    //
+    int dropped = 1;
+
+    while (total > budget && dropped) {
+
+        dropped = 0;
+
+        for (size_t idx = count; idx-- > 0 && total > budget; ) {
+
+            TGLARTextureResidency *entry = &entries[idx];
+
+            if (entry->residentLevel + 1 < entry->levelCount) {
+
+                total -= TGLARTextureLevelBytes(entry->width, entry->height, entry->residentLevel);
+                entry->residentLevel++;
+
+                dropped = 1;
+            }
+        }
+    }
+
+    return total;
+}
@@ -0,0 +1,114 @@
+//
+//  TGLARTextureLevels.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARTextureLevels_h
+#define TGLARTextureLevels_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Residency state of a single mipmapped texture.
+ *
+ * Used by @p TGLARTextureResolveResidency to decide which
+ * mipmap levels of a set of textures may stay in GPU memory.
+ *
+ * Level @p 0 is the full resolution base level, every further
+ * level halves width and height down to 1x1.
+ */
+typedef struct {
+
+    /// Base level width in pixels.
+    uint32_t width;
+    /// Base level height in pixels.
+    uint32_t height;
+    /// Number of levels in the complete mipmap chain.
+    uint32_t levelCount;
+    /// Finest level required by the current frame.
+    uint32_t desiredLevel;
+    /// Finest level granted by @p TGLARTextureResolveResidency.
+    uint32_t residentLevel;
+    /// Largest projected on-screen size in pixels, used to rank textures.
+    float projectedSize;
+    /// Opaque pointer identifying the texture to the caller.
+    void *owner;
+
+} TGLARTextureResidency;
+
+/// Returns the smallest power of two not less than @p value, clamped to @p maxValue.
+uint32_t TGLARTexturePowerOfTwo(uint32_t value, uint32_t maxValue);
+
+/// Returns the number of levels in a complete mipmap chain for a base level of the given size.
+uint32_t TGLARTextureLevelCount(uint32_t width, uint32_t height);
+
+/// Returns the size in bytes of an RGBA8 mipmap level.
+size_t TGLARTextureLevelBytes(uint32_t width, uint32_t height, uint32_t level);
+
+/// Returns the size in bytes of the RGBA8 mipmap chain from @p firstLevel down to 1x1.
+size_t TGLARTextureChainBytes(uint32_t width, uint32_t height, uint32_t firstLevel);
+
+/** Returns the finest mipmap level needed to show a texture at a projected size.
+ *
+ * @param width Base level width in pixels.
+ * @param height Base level height in pixels.
+ * @param levelCount Number of levels available.
+ * @param projectedSize Size of the textured shape on screen in pixels. Values
+ *        less than or equal to @p 0 select the coarsest level.
+ *
+ * @return A level index from @p 0 to @p levelCount-1.
+ */
+uint32_t TGLARTextureLevelForProjectedSize(uint32_t width, uint32_t height, uint32_t levelCount, float projectedSize);
+
+/** Computes the next mipmap level of an RGBA8 image using a 2x2 box filter.
+ *
+ * @param src Source pixels, @p width * @p height * 4 bytes.
+ * @param width Source width in pixels.
+ * @param height Source height in pixels.
+ * @param dst Destination buffer, large enough for @p MAX(width/2,1) * @p MAX(height/2,1) * 4 bytes.
+ */
+void TGLARTextureDownsampleRGBA8(const uint8_t *src, uint32_t width, uint32_t height, uint8_t *dst);
+
+/** Assigns resident levels to a set of textures under a memory budget.
+ *
+ * Every entry starts at its @p desiredLevel. While the total size
+ * exceeds @p budget, textures with the smallest @p projectedSize
+ * are coarsened one level at a time. The coarsest level of each
+ * texture always stays resident, so the result may still exceed
+ * the budget when there are too many textures.
+ *
+ * The array is reordered by descending @p projectedSize.
+ *
+ * @return The total number of bytes of the resident levels.
+ */
+size_t TGLARTextureResolveResidency(TGLARTextureResidency *entries, size_t count, size_t budget);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TGLARTextureLevels_h */
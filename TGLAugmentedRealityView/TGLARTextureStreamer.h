@@ -0,0 +1,117 @@
+//
+//  TGLARTextureStreamer.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <GLKit/GLKit.h>
+
+/** A mipmapped texture whose resident resolution is managed by a @p TGLARTextureStreamer.
+ *
+ * The texture holds the levels from @p -residentLevel down to 1x1,
+ * depending on the size of the shapes using it on screen and the
+ * streamer's memory budget. Levels are decoded on a background queue
+ * when a finer level is needed. Levels coarser than the resident one
+ * stay in CPU memory, so coarsening never decodes. A texture is only
+ * coarsened after its shapes needed less resolution for about a second,
+ * unless the memory budget is exceeded. Until the first upload @p -name
+ * is @p 0.
+ */
+@interface TGLARStreamedTexture : NSObject
+
+/// The OpenGL ES context the texture is created in.
+@property (nonatomic, weak, readonly, nullable) EAGLContext *context;
+
+/// The OpenGL ES texture name or @p 0 if no level is resident yet.
+@property (nonatomic, readonly) GLuint name;
+/// The OpenGL ES texture target.
+@property (nonatomic, readonly) GLenum target;
+
+/// Width of the full resolution level in pixels.
+@property (nonatomic, readonly) NSUInteger width;
+/// Height of the full resolution level in pixels.
+@property (nonatomic, readonly) NSUInteger height;
+/// The number of levels in the mipmap chain.
+@property (nonatomic, readonly) NSUInteger levelCount;
+/// The finest mipmap level currently uploaded to OpenGL ES.
+@property (nonatomic, readonly) NSUInteger residentLevel;
+
+/** Tells the texture the size of a shape using it on screen.
+ *
+ * Call this once per shape and frame before @p -[TGLARTextureStreamer updateResidency].
+ * The largest size requested during a frame determines the level to be made resident.
+ *
+ * @param projectedSize The larger side of the shape on screen in pixels.
+ */
+- (void)requestProjectedSize:(float)projectedSize;
+
+@end
+
+/** Decodes shape textures asynchronously and streams their mipmap levels.
+ *
+ * Textures created from the same image in the same context are shared.
+ * Once per frame @p -updateResidency selects the resolution of every
+ * texture from the projected shape sizes requested during the frame
+ * and uploads or drops mipmap levels to stay below @p -memoryBudget.
+ */
+@interface TGLARTextureStreamer : NSObject
+
+/// The streamer used by @p TGLARImageShape and @p TGLARView.
++ (nonnull instancetype)sharedStreamer;
+
+/// Maximum number of bytes of resident texture levels. Default is 32 MB.
+@property (nonatomic, assign) NSUInteger memoryBudget;
+/// Maximum width and height of decoded images. Larger images are scaled down. Default is @p 1024.
+@property (nonatomic, assign) NSUInteger maxTextureSize;
+/// Maximum number of textures re-uploaded by a single call to @p -updateResidency. Default is @p 4.
+@property (nonatomic, assign) NSUInteger maxUploadsPerUpdate;
+
+/** If set to YES, @p -updateResidency decodes and uploads all changed textures before returning. Default is @p NO.
+ *
+ * Use this for headless rendering, where results must not depend
+ * on background decodes finishing in time. Frame times are not
+ * bounded then.
+ */
+@property (nonatomic, assign) BOOL decodesSynchronously;
+
+/// Number of bytes of currently resident texture levels.
+@property (nonatomic, readonly) NSUInteger residentBytes;
+
+/** Returns a texture for an image, decoding it on a background queue if necessary.
+ *
+ * @param image The image to be decoded.
+ * @param context The OpenGL ES context to create the texture in.
+ *
+ * @return A possibly shared texture or @p nil if the image has no bitmap representation.
+ */
+- (nullable TGLARStreamedTexture *)textureWithImage:(nonnull UIImage *)image context:(nonnull EAGLContext *)context;
+
+/** Applies the projected sizes requested since the last call.
+ *
+ * Usually called once per frame after drawing all shapes. Each
+ * texture is uploaded with its own context made current, the
+ * context current before the call is restored afterwards.
+ */
+- (void)updateResidency;
+
+@end
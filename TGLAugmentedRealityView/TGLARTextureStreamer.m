@@ -0,0 +1,407 @@
+//
+//  TGLARTextureStreamer.m
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#import "TGLARTextureStreamer.h"
+#import "TGLARTextureLevels.h"
+
+// Textures are only coarsened after needing less resolution for
+// this many updates, so shapes leaving the view for a few frames
+// or sizes oscillating around a level boundary don't cause decodes
+// and pop-in
+//
+static const NSUInteger kTGLARTextureDemotionUpdates = 60;
+
+#pragma mark - Streamed texture implementation
+
+@interface TGLARStreamedTexture () {
+
+    float _requestedSize;
+    CGImageRef _image;
+    NSUInteger _demotionUpdates;
+}
+
+@property (nonatomic, weak) EAGLContext *context;
+
+@property (nonatomic, assign) NSUInteger width;
+@property (nonatomic, assign) NSUInteger height;
+@property (nonatomic, assign) NSUInteger levelCount;
+@property (nonatomic, assign) NSUInteger residentLevel;
+
+@property (nonatomic, copy) NSArray<NSData *> *levels;
+@property (nonatomic, assign) NSUInteger decodedLevel;
+@property (nonatomic, assign, getter=isDecoding) BOOL decoding;
+
+- (float)consumeRequestedSize;
+- (uint32_t)levelHoldingResidency:(uint32_t)desiredLevel;
+- (void)decodeFromLevel:(NSUInteger)firstLevel synchronously:(BOOL)synchronously;
+- (void)uploadFromLevel:(NSUInteger)firstLevel;
+
+@end
+
+static NSArray<NSData *> *TGLARStreamedTextureDecode(CGImageRef image, uint32_t width, uint32_t height, uint32_t levelCount) {
+
+    // Decode straight to the first level needed,
+    // so coarse levels never cost a full decode
+    //
+    NSMutableData *baseLevel = [NSMutableData dataWithLength:TGLARTextureLevelBytes(width, height, 0)];
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef bitmap = CGBitmapContextCreate(baseLevel.mutableBytes, width, height, 8, width * 4, colorSpace, kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big);
+
+    CGContextSetInterpolationQuality(bitmap, kCGInterpolationHigh);
+    CGContextDrawImage(bitmap, CGRectMake(0, 0, width, height), image);
+
+    CGContextRelease(bitmap);
+    CGColorSpaceRelease(colorSpace);
+
+    NSMutableArray<NSData *> *levels = [NSMutableArray arrayWithCapacity:levelCount];
+
+    [levels addObject:baseLevel];
+
+    for (uint32_t level = 1; level < levelCount; level++) {
+
+        NSData *previous = levels[level - 1];
+        NSMutableData *next = [NSMutableData dataWithLength:TGLARTextureLevelBytes(width, height, level)];
+
+        TGLARTextureDownsampleRGBA8(previous.bytes, MAX(width >> (level - 1), 1), MAX(height >> (level - 1), 1), next.mutableBytes);
+
+        [levels addObject:next];
+    }
+
+    return levels;
+}
+
+@implementation TGLARStreamedTexture
+
+- (instancetype)initWithImage:(CGImageRef)image context:(EAGLContext *)context maxTextureSize:(NSUInteger)maxTextureSize {
+
+    self = [super init];
+
+    if (self) {
+
+        _context = context;
+        _target = GL_TEXTURE_2D;
+
+        _image = CGImageRetain(image);
+
+        // Scale to power of two dimensions, since GL ES 2
+        // does not support mipmaps on other texture sizes
+        //
+        _width = TGLARTexturePowerOfTwo((uint32_t)CGImageGetWidth(image), (uint32_t)maxTextureSize);
+        _height = TGLARTexturePowerOfTwo((uint32_t)CGImageGetHeight(image), (uint32_t)maxTextureSize);
+        _levelCount = TGLARTextureLevelCount((uint32_t)_width, (uint32_t)_height);
+        _residentLevel = _levelCount;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    if (self.context && _name) {
+
+        EAGLContext *currentContext = [EAGLContext currentContext];
+
+        if (currentContext != self.context) [EAGLContext setCurrentContext:self.context];
+
+        glDeleteTextures(1, &_name);
+        _name = 0;
+
+        if ([EAGLContext currentContext] != currentContext) [EAGLContext setCurrentContext:currentContext];
+    }
+
+    CGImageRelease(_image);
+}
+
+#pragma mark - Methods
+
+- (void)requestProjectedSize:(float)projectedSize {
+
+    _requestedSize = MAX(_requestedSize, projectedSize);
+}
+
+#pragma mark - Helpers
+
+- (float)consumeRequestedSize {
+
+    float requestedSize = _requestedSize;
+
+    _requestedSize = 0.0;
+
+    return requestedSize;
+}
+
+- (uint32_t)levelHoldingResidency:(uint32_t)desiredLevel {
+
+    if (_name == 0 || desiredLevel <= self.residentLevel) {
+
+        _demotionUpdates = 0;
+
+        return desiredLevel;
+    }
+
+    if (++_demotionUpdates < kTGLARTextureDemotionUpdates) return (uint32_t)self.residentLevel;
+
+    _demotionUpdates = 0;
+
+    return desiredLevel;
+}
+
+- (void)decodeFromLevel:(NSUInteger)firstLevel synchronously:(BOOL)synchronously {
+
+    uint32_t width = (uint32_t)MAX(self.width >> firstLevel, 1);
+    uint32_t height = (uint32_t)MAX(self.height >> firstLevel, 1);
+    uint32_t levelCount = (uint32_t)(self.levelCount - firstLevel);
+
+    if (synchronously) {
+
+        self.levels = TGLARStreamedTextureDecode(_image, width, height, levelCount);
+        self.decodedLevel = firstLevel;
+
+        return;
+    }
+
+    CGImageRef image = CGImageRetain(_image);
+    __weak TGLARStreamedTexture *weakTexture = self;
+
+    self.decoding = YES;
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+
+        NSArray<NSData *> *levels = TGLARStreamedTextureDecode(image, width, height, levelCount);
+
+        CGImageRelease(image);
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+
+            TGLARStreamedTexture *texture = weakTexture;
+
+            if (texture == nil) return;
+
+            texture.levels = levels;
+            texture.decodedLevel = firstLevel;
+            texture.decoding = NO;
+        });
+    });
+}
+
+- (void)uploadFromLevel:(NSUInteger)firstLevel {
+
+    // A GL ES 2 texture has no base level parameter,
+    // so levels are always respecified into a fresh
+    // texture to keep the mipmap chain complete
+    //
+    if (_name) glDeleteTextures(1, &_name);
+
+    glGenTextures(1, &_name);
+    glBindTexture(GL_TEXTURE_2D, _name);
+
+    for (NSUInteger level = firstLevel; level < self.levelCount; level++) {
+
+        GLsizei width = (GLsizei)MAX(self.width >> level, 1);
+        GLsizei height = (GLsizei)MAX(self.height >> level, 1);
+
+        glTexImage2D(GL_TEXTURE_2D, (GLint)(level - firstLevel), GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, self.levels[level - self.decodedLevel].bytes);
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    self.residentLevel = firstLevel;
+
+    // Only the levels below the uploaded base level are kept,
+    // about a third of its size, so coarsening never decodes
+    //
+    NSUInteger keptLevel = firstLevel + 1;
+
+    if (keptLevel < self.levelCount) {
+
+        self.levels = [self.levels subarrayWithRange:NSMakeRange(keptLevel - self.decodedLevel, self.levelCount - keptLevel)];
+        self.decodedLevel = keptLevel;
+
+    } else {
+
+        self.levels = nil;
+    }
+}
+
+@end
+
+#pragma mark - Streamer implementation
+
+@interface TGLARTextureStreamer ()
+
+@property (nonatomic, strong) NSHashTable<TGLARStreamedTexture *> *textures;
+@property (nonatomic, strong) NSMapTable<UIImage *, TGLARStreamedTexture *> *imageTextures;
+
+@property (nonatomic, strong) NSMutableData *residencyBuffer;
+
+@property (nonatomic, assign) NSUInteger residentBytes;
+
+@end
+
+@implementation TGLARTextureStreamer
+
++ (instancetype)sharedStreamer {
+
+    static TGLARTextureStreamer *sharedStreamer = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+
+        sharedStreamer = [[TGLARTextureStreamer alloc] init];
+    });
+
+    return sharedStreamer;
+}
+
+- (instancetype)init {
+
+    self = [super init];
+
+    if (self) {
+
+        _memoryBudget = 32 * 1024 * 1024;
+        _maxTextureSize = 1024;
+        _maxUploadsPerUpdate = 4;
+
+        _textures = [NSHashTable weakObjectsHashTable];
+        _imageTextures = [NSMapTable weakToWeakObjectsMapTable];
+
+        _residencyBuffer = [NSMutableData data];
+    }
+
+    return self;
+}
+
+#pragma mark - Methods
+
+- (TGLARStreamedTexture *)textureWithImage:(UIImage *)image context:(EAGLContext *)context {
+
+    TGLARStreamedTexture *texture = [self.imageTextures objectForKey:image];
+
+    if (texture && texture.context == context) return texture;
+
+    CGImageRef cgImage = image.CGImage;
+
+    if (cgImage == NULL) return nil;
+
+    texture = [[TGLARStreamedTexture alloc] initWithImage:cgImage context:context maxTextureSize:self.maxTextureSize];
+
+    [self.textures addObject:texture];
+    [self.imageTextures setObject:texture forKey:image];
+
+    return texture;
+}
+
+- (void)updateResidency {
+
+    // Collect textures with their desired
+    // levels for the current frame
+    //
+    NSUInteger count = 0;
+
+    [self.residencyBuffer setLength:self.textures.count * sizeof(TGLARTextureResidency)];
+
+    TGLARTextureResidency *entries = self.residencyBuffer.mutableBytes;
+
+    for (TGLARStreamedTexture *texture in self.textures) {
+
+        float projectedSize = [texture consumeRequestedSize];
+
+        if (texture.context == nil) continue;
+
+        TGLARTextureResidency *entry = &entries[count++];
+
+        entry->width = (uint32_t)texture.width;
+        entry->height = (uint32_t)texture.height;
+        entry->levelCount = (uint32_t)texture.levelCount;
+        entry->desiredLevel = TGLARTextureLevelForProjectedSize(entry->width, entry->height, entry->levelCount, projectedSize);
+
+        // Offscreen renderings must not depend on earlier frames
+        //
+        if (!self.decodesSynchronously) entry->desiredLevel = [texture levelHoldingResidency:entry->desiredLevel];
+
+        entry->residentLevel = entry->desiredLevel;
+        entry->projectedSize = projectedSize;
+        entry->owner = (__bridge void *)texture;
+    }
+
+    TGLARTextureResolveResidency(entries, count, self.memoryBudget);
+
+    // Decode missing levels and upload changed textures,
+    // limiting the number of uploads to bound frame time
+    //
+    EAGLContext *currentContext = [EAGLContext currentContext];
+
+    NSUInteger uploads = 0;
+    NSUInteger residentBytes = 0;
+
+    for (NSUInteger idx = 0; idx < count; idx++) {
+
+        TGLARTextureResidency *entry = &entries[idx];
+        TGLARStreamedTexture *texture = (__bridge TGLARStreamedTexture *)entry->owner;
+
+        if (texture.residentLevel != entry->residentLevel) {
+
+            // Synchronous decoding makes every texture
+            // resident within this call, as needed for
+            // reproducible offscreen renderings
+            //
+            if (self.decodesSynchronously && !(texture.levels && texture.decodedLevel <= entry->residentLevel)) {
+
+                [texture decodeFromLevel:entry->residentLevel synchronously:YES];
+            }
+
+            if (texture.levels && texture.decodedLevel <= entry->residentLevel) {
+
+                if (uploads < self.maxUploadsPerUpdate || self.decodesSynchronously) {
+
+                    if ([EAGLContext currentContext] != texture.context) [EAGLContext setCurrentContext:texture.context];
+
+                    [texture uploadFromLevel:entry->residentLevel];
+
+                    uploads++;
+                }
+
+            } else if (!texture.isDecoding) {
+
+                [texture decodeFromLevel:entry->residentLevel synchronously:NO];
+            }
+        }
+
+        if (texture.name) residentBytes += TGLARTextureChainBytes(entry->width, entry->height, (uint32_t)texture.residentLevel);
+    }
+
+    if ([EAGLContext currentContext] != currentContext) [EAGLContext setCurrentContext:currentContext];
+
+    self.residentBytes = residentBytes;
+}
+
+@end
@@ -27,7 +27,10 @@
 #import <GLKit/GLKit.h>
 
 #import "TGLARCompass.h"
+#import "TGLARRadarView.h"
 #import "TGLAROverlay.h"
+#import "TGLARStateSnapshot.h"
+#import "TGLARLiveUpdates.h"
 
 @class TGLARView;
 
@@ -171,6 +174,8 @@
 
 /// An object conforming to @p TGLARCompass protocol receiving heading updates while the device moves. Default is @p nil.
 @property (nonatomic, weak, nullable) IBOutlet id<TGLARCompass> compass;
+/// A radar view receiving overlay positions and culling results while the device moves. Its range is the far clipping distance. Default is @p nil.
+@property (nonatomic, weak, nullable) IBOutlet TGLARRadarView *radar;
 /// The object that acts as the delegate of this AR view. Default is @p nil.
 @property (nonatomic, weak, nullable) IBOutlet id<TGLARViewDelegate> delegate;
 /// The object that acts as the data source of this AR view. Default is @p nil.
@@ -216,9 +221,147 @@
  */
 @property (nonatomic, assign) CGSize positionOffset;
 
+/** Camera position in meters relative to the world reference point. Default is @p (0,0,0).
+ *
+ * Overlays implementing @p -[TGLAROverlay worldPosition] are placed relative
+ * to a floating origin near the camera. Moving the camera only changes the
+ * view transformation, until it gets farther than @p -rebaseDistance away
+ * from the origin. Then the origin is moved to the camera and the overlay
+ * target positions are recomputed.
+ *
+ * @sa @p -floatingOrigin
+ */
+@property (nonatomic, assign) TGLARWorldPosition cameraWorldPosition;
+
+/// Maximum camera distance in meters from @p -floatingOrigin before overlay positions are rebased. Default is @p 500.0.
+@property (nonatomic, assign) double rebaseDistance;
+
+/// The world position overlay target positions are currently relative to.
+@property (nonatomic, readonly) TGLARWorldPosition floatingOrigin;
+
+/** If set to YES, overlay quality is lowered while frames take longer than @p -targetFrameTime or miss display refreshes. Default is @p YES.
+ *
+ * Quality is lowered step by step, by limiting the number of overlay views
+ * shown, selecting coarser shape details, adjusting callout lengths and
+ * updating the compass less often, and finally by halving the frame rate.
+ */
+@property (nonatomic, assign, getter=isAdaptingQuality) BOOL adaptiveQuality;
+/// The frame time in seconds to be held by adapting quality, e.g. @p 1/30 to save battery. Also sets the frame rate at full quality. Default is @p 1/60.
+@property (nonatomic, assign) NSTimeInterval targetFrameTime;
+/// The current quality level, @p 0 being full quality.
+@property (nonatomic, readonly) NSUInteger qualityLevel;
+
+/** Derived overlay state of a previous run restored by @p -reloadData. Default is @p nil.
+ *
+ * Views of overlays found in the snapshot by their @p -[TGLAROverlay overlayIdentifier]
+ * appear with their settled callout length and alignment instead of
+ * starting from defaults.
+ *
+ * @sa -writeStateSnapshotToURL:reference:error:
+ */
+@property (nonatomic, strong, nullable) TGLARStateSnapshot *stateSnapshot;
+
+/** Position samples of moving overlays applied every frame. Default is @p nil.
+ *
+ * Overlays with samples are moved to their positions interpolated or
+ * extrapolated to the time the frame is displayed. Their live positions
+ * take precedence over @p -[TGLAROverlay worldPosition] and any target
+ * position set by the data source. Tracks are data source indexes. They
+ * keep their state across @p -reloadData, unless the overlay count drops
+ * below their index.
+ */
+@property (nonatomic, strong, nullable) TGLARLiveUpdates *liveUpdates;
+
+/// The camera rotation derived from the latest device attitude. Useful to record poses for @p -renderShapesWithCameraTransform:width:height:renderTime:.
+@property (nonatomic, readonly) GLKMatrix4 cameraTransform;
+
 /// Returns the OpenGL ES context used to draw overlay shapes.
 - (nonnull EAGLContext *)renderContext;
 
+/** Renders the overlay shapes into an offscreen framebuffer.
+ *
+ * Rendering neither needs the camera preview nor an on-screen GL view,
+ * so this method can be used for image comparison and performance
+ * tests. The current user offsets, interface orientation and field of
+ * view are applied. Pending mesh loads and live updates are applied,
+ * and texture levels for the pose are requested before drawing. Shapes
+ * whose textures are still being decoded are not drawn, unless
+ * @p -[TGLARTextureStreamer decodesSynchronously] is set. The
+ * framebuffer is kept for further images of the same size.
+ *
+ * @param cameraTransform The camera rotation to render with, e.g. a recorded @p -cameraTransform.
+ * @param width Image width in pixels.
+ * @param height Image height in pixels.
+ * @param renderTime If not @p NULL receives the time in seconds spent drawing, including GPU execution.
+ *
+ * @return RGBA8 pixels with the top row first or nil if the framebuffer cannot be created.
+ */
+- (nullable NSData *)renderShapesWithCameraTransform:(GLKMatrix4)cameraTransform width:(NSUInteger)width height:(NSUInteger)height renderTime:(nullable NSTimeInterval *)renderTime;
+
+/** Converts a world position to a target position relative to the current floating origin.
+ *
+ * Use this for overlays not implementing @p -[TGLAROverlay worldPosition]
+ * which have to follow the camera, e.g. a shape at the user's location.
+ *
+ * @param position The X/Y/Z world position in meters.
+ *
+ * @return The position relative to @p -floatingOrigin.
+ */
+- (GLKVector3)targetPositionForWorldPosition:(TGLARWorldPosition)position;
+
+/** Returns the visible overlay views close to a point, nearest first.
+ *
+ * @param point A point in the receiver's coordinate system.
+ * @param radius Maximum distance in points between @p point and a view's frame.
+ * @param maxCount Maximum number of views to return.
+ *
+ * @return An array of @p TGLARViewOverlay objects ordered by ascending distance.
+ */
+- (nonnull NSArray<TGLARViewOverlay *> *)viewOverlaysNearPoint:(CGPoint)point radius:(CGFloat)radius maxCount:(NSUInteger)maxCount;
+
+/** Reads the world positions of all overlays implementing @p -[TGLAROverlay worldPosition] again.
+ *
+ * World positions are read once by @p -reloadData and kept by the view.
+ * Call this method after changing the world positions of many overlays,
+ * or use @p -setWorldPosition:forOverlayAtIndex: for single overlays.
+ */
+- (void)reloadWorldPositions;
+
+/** Moves an overlay implementing @p -[TGLAROverlay worldPosition].
+ *
+ * The view's copy of the world position is updated, the overlay itself
+ * is not changed. Other overlays are ignored.
+ *
+ * @param position The new world position.
+ * @param index The index of the overlay in the data source.
+ */
+- (void)setWorldPosition:(TGLARWorldPosition)position forOverlayAtIndex:(NSInteger)index;
+
+/** Returns the position an overlay is drawn at, relative to @p -floatingOrigin.
+ *
+ * @param index The index of the overlay in the data source.
+ *
+ * @return The target position or a zero vector if there is no such overlay.
+ */
+- (GLKVector3)targetPositionOfOverlayAtIndex:(NSInteger)index;
+
+/** Saves the derived state of the current overlays to a snapshot file.
+ *
+ * World positions and the current callout state of overlays implementing
+ * @p -[TGLAROverlay overlayIdentifier] are written. State of overlays kept
+ * in @p -stateSnapshot but not loaded at the moment is preserved. If
+ * @p -stateSnapshot was read from @p url for the same reference and the
+ * same overlays, only changed entries are rewritten in place. On success
+ * @p -stateSnapshot is set to the snapshot now contained in the file.
+ *
+ * @param url The file URL of the snapshot.
+ * @param reference The geographic reference overlay world positions are relative to.
+ * @param error Receives an error if writing failed.
+ *
+ * @return @p YES on success.
+ */
+- (BOOL)writeStateSnapshotToURL:(nonnull NSURL *)url reference:(TGLARSnapshotReference)reference error:(NSError * _Nullable * _Nullable)error;
+
 /// Starts the video preview and rendering of the overlays.
 - (void)start;
 /// Stops the video preview and rendering of the overlays.
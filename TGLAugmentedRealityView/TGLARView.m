@@ -27,8 +27,13 @@
 #import "TGLAROverlay.h"
 #import "TGLARViewOverlay.h"
 #import "TGLARShapeOverlay.h"
+#import "TGLARMeshShape.h"
 #import "TGLAROverlayContainerView.h"
 #import "TGLARCompassView.h"
+#import "TGLARTextureStreamer.h"
+#import "TGLARFramebuffer.h"
+#import "TGLARRenderBackend.h"
+#import "TGLARFrameGovernor.h"
 
 #import <CoreMotion/CoreMotion.h>
 #import <AVFoundation/AVFoundation.h>
@@ -46,6 +51,30 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
     
     GLKMatrix4 _viewMatrix;
     GLKMatrix4 _projectionMatrix;
+
+    GLKVector3 _cameraPosition;
+
+    // Overlay positions live in contiguous buffers indexed
+    // like -overlays, world overlays first, so rebasing is
+    // a single pass over the world positions
+    //
+    NSMutableData *_worldPositions;
+    NSMutableData *_targetPositions;
+    NSUInteger _worldCount;
+
+    NSMutableData *_overlayIndexes;
+    NSMutableData *_viewTargetIndexes;
+    NSMutableData *_shapeTargetIndexes;
+
+    NSMutableData *_radarViewIndexes;
+    NSMutableData *_radarFlags;
+    CFTimeInterval _displayTimestamp;
+    CFTimeInterval _linkTimestamp;
+    CFTimeInterval _displayInterval;
+
+    TGLARFrameGovernor _governor;
+    TGLARQualitySettings _qualitySettings;
+    NSUInteger _frameCount;
 }
 
 @property (nonatomic, strong) CMMotionManager *motionManager;
@@ -68,14 +97,39 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
 @property (nonatomic, assign) CGFloat verticalFovPortrait;
 @property (nonatomic, assign) CGFloat verticalFovLandscape;
 
+@property (nonatomic, readonly) CGFloat farClippingDistance;
+
 @property (nonatomic, strong) NSArray<TGLARShapeOverlay *> *overlayShapes;
+@property (nonatomic, strong) NSArray<id<TGLAROverlay>> *overlays;
+
+@property (nonatomic, strong) TGLARFramebuffer *pickFramebuffer;
+@property (nonatomic, strong) TGLARFramebuffer *offscreenFramebuffer;
 
 @property (nonatomic, strong) UITapGestureRecognizer *tapRecognizer;
 @property (nonatomic, strong) UIPanGestureRecognizer *panRecognizer;
 @property (nonatomic, strong) UIPinchGestureRecognizer *pinchRecognizer;
 
+- (BOOL)bindOffscreenFramebufferWithWidth:(GLsizei)width height:(GLsizei)height;
+
 @end
 
+// Offscreen frames are rendered through the
+// same backend interface as on other platforms
+//
+static int TGLARViewMakeCurrent(void *context) {
+
+    TGLARView *view = (__bridge TGLARView *)context;
+
+    return [EAGLContext setCurrentContext:view.renderContext];
+}
+
+static int TGLARViewBindOffscreenTarget(void *context, uint32_t width, uint32_t height) {
+
+    TGLARView *view = (__bridge TGLARView *)context;
+
+    return [view bindOffscreenFramebufferWithWidth:(GLsizei)width height:(GLsizei)height];
+}
+
 #pragma mark - ARView implementation
 
 @implementation TGLARView
@@ -112,6 +166,25 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
     self.fovScalePortrait = 1.0;
     self.fovScaleLandscape = 1.0;
 
+    _rebaseDistance = 500.0;
+
+    _adaptiveQuality = YES;
+    _targetFrameTime = 1.0 / 60.0;
+
+    TGLARFrameGovernorInit(&_governor, _targetFrameTime);
+
+    _qualitySettings = TGLARQualitySettingsForLevel(_governor.level);
+
+    _worldPositions = [NSMutableData data];
+    _targetPositions = [NSMutableData data];
+
+    _overlayIndexes = [NSMutableData data];
+    _viewTargetIndexes = [NSMutableData data];
+    _shapeTargetIndexes = [NSMutableData data];
+
+    _radarViewIndexes = [NSMutableData data];
+    _radarFlags = [NSMutableData data];
+
     // Make camera preview in background
     //
     self.captureView = [[UIView alloc] initWithFrame:self.bounds];
@@ -265,6 +338,33 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
     [self updateProjectionMatrix];
 }
 
+- (void)setAdaptiveQuality:(BOOL)adaptiveQuality {
+
+    if (adaptiveQuality == _adaptiveQuality) return;
+
+    _adaptiveQuality = adaptiveQuality;
+
+    TGLARFrameGovernorInit(&_governor, self.targetFrameTime);
+
+    [self applyQualitySettings];
+}
+
+- (void)setTargetFrameTime:(NSTimeInterval)targetFrameTime {
+
+    if (targetFrameTime == _targetFrameTime) return;
+
+    _targetFrameTime = targetFrameTime;
+
+    TGLARFrameGovernorInit(&_governor, targetFrameTime);
+
+    [self applyQualitySettings];
+}
+
+- (NSUInteger)qualityLevel {
+
+    return _governor.level;
+}
+
 - (CGFloat)maxZoomFactor {
     
     return self.captureDevice.activeFormat.videoMaxZoomFactor;
@@ -319,6 +419,27 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
     }
 }
 
+- (void)setCameraWorldPosition:(TGLARWorldPosition)position {
+
+    _cameraWorldPosition = position;
+
+    if (TGLARFloatingOriginShouldRebase(self.floatingOrigin, position, self.rebaseDistance)) {
+
+        _floatingOrigin = position;
+
+        [self rebaseOverlayPositions];
+    }
+
+    [self updateUserTransformation];
+}
+
+- (void)setLiveUpdates:(TGLARLiveUpdates *)liveUpdates {
+
+    _liveUpdates = liveUpdates;
+
+    [liveUpdates setTrackCount:_overlayIndexes.length / sizeof(NSInteger)];
+}
+
 #pragma mark - Actions
 
 - (IBAction)handleTapGesture:(UITapGestureRecognizer *)recognizer {
@@ -462,36 +583,283 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
 	[self stopCameraPreview];
 }
 
+- (GLKVector3)targetPositionForWorldPosition:(TGLARWorldPosition)position {
+
+    GLKVector3 targetPosition;
+
+    TGLARFloatingOriginRebase(&position, 1, self.floatingOrigin, targetPosition.v);
+
+    return targetPosition;
+}
+
+- (NSArray<TGLARViewOverlay *> *)viewOverlaysNearPoint:(CGPoint)point radius:(CGFloat)radius maxCount:(NSUInteger)maxCount {
+
+    CGPoint containerPoint = [self.containerView convertPoint:point fromView:self];
+
+    return [self.containerView overlayViewsNearPoint:containerPoint radius:radius maxCount:maxCount];
+}
+
+- (void)reloadWorldPositions {
+
+    TGLARWorldPosition *worldPositions = _worldPositions.mutableBytes;
+
+    for (NSUInteger idx = 0; idx < _worldCount; idx++) {
+
+        worldPositions[idx] = [self.overlays[idx] worldPosition];
+    }
+
+    [self rebaseOverlayPositions];
+}
+
+- (void)rebaseOverlayPositions {
+
+    TGLARFloatingOriginRebase(_worldPositions.bytes, _worldCount, self.floatingOrigin, (float *)_targetPositions.mutableBytes);
+}
+
+- (void)setWorldPosition:(TGLARWorldPosition)position forOverlayAtIndex:(NSInteger)index {
+
+    NSInteger overlayIndex = [self overlayIndexForIndex:index];
+
+    if (overlayIndex < 0 || (NSUInteger)overlayIndex >= _worldCount) return;
+
+    TGLARWorldPosition *worldPositions = _worldPositions.mutableBytes;
+    GLKVector3 *targetPositions = _targetPositions.mutableBytes;
+
+    worldPositions[overlayIndex] = position;
+
+    TGLARFloatingOriginRebase(&position, 1, self.floatingOrigin, targetPositions[overlayIndex].v);
+}
+
+- (GLKVector3)targetPositionOfOverlayAtIndex:(NSInteger)index {
+
+    NSInteger overlayIndex = [self overlayIndexForIndex:index];
+
+    if (overlayIndex < 0) return GLKVector3Make(0.0, 0.0, 0.0);
+    if ((NSUInteger)overlayIndex >= _worldCount) return [self.overlays[overlayIndex] targetPosition];
+
+    const GLKVector3 *targetPositions = _targetPositions.bytes;
+
+    return targetPositions[overlayIndex];
+}
+
 - (void)reloadData {
 
     NSMutableArray<TGLARViewOverlay *> *overlayViews = [NSMutableArray array];
     NSMutableArray<TGLARShapeOverlay *> *overlayShapes = [NSMutableArray array];
+    NSMutableArray<id<TGLAROverlay>> *worldOverlays = [NSMutableArray array];
+    NSMutableArray<id<TGLAROverlay>> *localOverlays = [NSMutableArray array];
+
+    NSInteger count = MAX([self.dataSource numberOfOverlaysInARView:self], 0);
+
+    // Data source indexes map to overlay indexes, -1 if nil.
+    // Overlays without world position are numbered -2, -3, ...
+    // until the number of world overlays is known
+    //
+    [_overlayIndexes setLength:count * sizeof(NSInteger)];
+
+    NSInteger *overlayIndexes = _overlayIndexes.mutableBytes;
 
-    NSInteger count = [self.dataSource numberOfOverlaysInARView:self];
-    
     for (NSInteger index = 0; index < count; index++) {
         
         id<TGLAROverlay> overlay = [self.dataSource arView:self overlayAtIndex:index];
-        
+
+        if (overlay == nil) {
+
+            overlayIndexes[index] = -1;
+
+        } else if ([overlay respondsToSelector:@selector(worldPosition)]) {
+
+            overlayIndexes[index] = worldOverlays.count;
+
+            [worldOverlays addObject:overlay];
+
+        } else {
+
+            overlayIndexes[index] = -2 - (NSInteger)localOverlays.count;
+
+            [localOverlays addObject:overlay];
+        }
+    }
+
+    for (NSInteger index = 0; index < count; index++) {
+
+        if (overlayIndexes[index] < -1) overlayIndexes[index] = (NSInteger)worldOverlays.count - 2 - overlayIndexes[index];
+    }
+
+    NSArray<id<TGLAROverlay>> *overlays = [worldOverlays arrayByAddingObjectsFromArray:localOverlays];
+    NSUInteger overlayCount = overlays.count;
+
+    [_worldPositions setLength:worldOverlays.count * sizeof(TGLARWorldPosition)];
+    [_targetPositions setLength:overlayCount * sizeof(GLKVector3)];
+
+    // Radar entries refer to the container's culling
+    // results by overlay view index, -1 if not a view,
+    // views and shapes to their target positions
+    //
+    [_radarViewIndexes setLength:overlayCount * sizeof(NSInteger)];
+    [_radarFlags setLength:overlayCount * sizeof(uint8_t)];
+    [_viewTargetIndexes setLength:overlayCount * sizeof(NSUInteger)];
+    [_shapeTargetIndexes setLength:overlayCount * sizeof(NSUInteger)];
+
+    NSInteger *radarViewIndexes = _radarViewIndexes.mutableBytes;
+    NSUInteger *viewTargetIndexes = _viewTargetIndexes.mutableBytes;
+    NSUInteger *shapeTargetIndexes = _shapeTargetIndexes.mutableBytes;
+
+    for (NSUInteger idx = 0; idx < overlayCount; idx++) {
+
+        id<TGLAROverlay> overlay = overlays[idx];
+
+        radarViewIndexes[idx] = -1;
+
         if ([overlay respondsToSelector:@selector(overlayView)]) {
             
             TGLARViewOverlay *view = overlay.overlayView;
 
-            if (view) [overlayViews addObject:view];
+            if (view) {
+
+                radarViewIndexes[idx] = overlayViews.count;
+                viewTargetIndexes[overlayViews.count] = idx;
+
+                [overlayViews addObject:view];
+            }
         }
         
         if ([overlay respondsToSelector:@selector(overlayShape)]) {
 
             TGLARShapeOverlay *shape = overlay.overlayShape;
             
-            if (shape) [overlayShapes addObject:shape];
+            if (shape) {
+
+                shapeTargetIndexes[overlayShapes.count] = idx;
+
+                [overlayShapes addObject:shape];
+            }
         }
     }
     
+    self.overlays = overlays;
+    _worldCount = worldOverlays.count;
+
+    [self.liveUpdates setTrackCount:count];
+
+    [self reloadWorldPositions];
+    [self refreshLocalTargetPositions];
+
+    [self restoreViewStateFromSnapshot:overlayViews];
+
     self.overlayShapes = overlayShapes;
+
+    self.containerView.targetPositions = _targetPositions.bytes;
+    self.containerView.targetIndexes = _viewTargetIndexes.bytes;
     self.containerView.overlayViews = overlayViews;
 }
 
+#pragma mark - State snapshot
+
+- (void)restoreViewStateFromSnapshot:(NSArray<TGLARViewOverlay *> *)overlayViews {
+
+    if (self.stateSnapshot == nil) return;
+
+    for (TGLARViewOverlay *view in overlayViews) {
+
+        id<TGLAROverlay> overlay = view.overlay;
+
+        // Views already shown keep their live state
+        //
+        if (view.superview || ![overlay respondsToSelector:@selector(overlayIdentifier)]) continue;
+
+        NSString *identifier = overlay.overlayIdentifier;
+
+        CGFloat calloutLength;
+        BOOL rightAligned;
+
+        if (identifier && [self.stateSnapshot getCalloutLength:&calloutLength rightAligned:&rightAligned forIdentifier:identifier]) {
+
+            // Hidden views keep the restored state
+            // until the container shows them
+            //
+            view.calloutLength = calloutLength;
+            view.rightAligned = rightAligned;
+            view.calloutSettled = YES;
+            view.hidden = YES;
+        }
+    }
+}
+
+- (BOOL)writeStateSnapshotToURL:(NSURL *)url reference:(TGLARSnapshotReference)reference error:(NSError **)error {
+
+    NSUInteger count = self.overlays.count;
+
+    NSMutableData *entryData = [NSMutableData dataWithLength:MAX(count, 1) * sizeof(TGLARSnapshotEntry)];
+
+    TGLARSnapshotEntry *entries = entryData.mutableBytes;
+    NSUInteger entryCount = 0;
+
+    // World positions are read from the buffer, which
+    // holds live positions the overlays don't know of
+    //
+    const TGLARWorldPosition *worldPositions = _worldPositions.bytes;
+
+    for (NSUInteger idx = 0; idx < count; idx++) {
+
+        id<TGLAROverlay> overlay = self.overlays[idx];
+        NSString *identifier = [overlay respondsToSelector:@selector(overlayIdentifier)] ? overlay.overlayIdentifier : nil;
+
+        if (identifier == nil) continue;
+
+        TGLARSnapshotEntry entry = { 0 };
+
+        entry.key = [TGLARStateSnapshot keyForIdentifier:identifier];
+
+        if (idx < _worldCount) {
+
+            TGLARWorldPosition position = worldPositions[idx];
+
+            entry.position[0] = position.x;
+            entry.position[1] = position.y;
+            entry.position[2] = position.z;
+            entry.flags |= TGLARSnapshotEntryHasPosition;
+        }
+
+        TGLARViewOverlay *view = [overlay respondsToSelector:@selector(overlayView)] ? overlay.overlayView : nil;
+
+        // Only callouts laid out on screen or still holding
+        // restored state have settled, others keep the state
+        // saved before
+        //
+        CGFloat calloutLength = 0.0;
+        BOOL rightAligned = NO;
+
+        if (view && (!view.hidden || view.calloutSettled)) {
+
+            calloutLength = view.calloutLength;
+            rightAligned = view.rightAligned;
+
+        } else if (view) {
+
+            [self.stateSnapshot getCalloutLength:&calloutLength rightAligned:&rightAligned forIdentifier:identifier];
+        }
+
+        if (calloutLength > 0.0) {
+
+            entry.calloutLength = calloutLength;
+            entry.flags |= TGLARSnapshotEntryHasCallout;
+
+            if (rightAligned) entry.flags |= TGLARSnapshotEntryRightAligned;
+        }
+
+        entries[entryCount++] = entry;
+    }
+
+    TGLARStateSnapshot *snapshot = [TGLARStateSnapshot writeEntries:entries count:entryCount reference:reference previousSnapshot:self.stateSnapshot toURL:url error:error];
+
+    if (snapshot == nil) return NO;
+
+    self.stateSnapshot = snapshot;
+
+    return YES;
+}
+
 #pragma mark - Camera handling
 
 - (void)startCameraPreview {
@@ -593,8 +961,12 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
     
 	self.displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(onDisplayLink:)];
 
-	[self.displayLink setFrameInterval:1];
+	[self.displayLink setFrameInterval:[self displayFrameInterval]];
 	[self.displayLink addToRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+
+    // No interval is known for the first frame
+    //
+    _linkTimestamp = 0.0;
 }
 
 - (void)stopDisplayLink {
@@ -615,6 +987,17 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
         _cameraTransform = GLKMatrix4Make(r.m11, r.m21, r.m31, 0.0, r.m12, r.m22, r.m32, 0.0, r.m13, r.m23, r.m33, 0.0, 0.0, 0.0, 0.0, 1.0);
     }
 
+    // The frame being drawn is shown
+    // at the next display refresh
+    //
+    _displayTimestamp = self.displayLink.timestamp + self.displayLink.duration * self.displayLink.frameInterval;
+
+    // Late or skipped callbacks show refreshes missed for
+    // any reason, including GPU load the CPU time misses
+    //
+    _displayInterval = (_linkTimestamp > 0.0) ? self.displayLink.timestamp - _linkTimestamp : 0.0;
+    _linkTimestamp = self.displayLink.timestamp;
+
     // Trigger -glkView:drawInRect:
     //
     [self.renderView setNeedsDisplay];
@@ -622,19 +1005,27 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
 
 - (void)glkView:(GLKView *)view drawInRect:(CGRect)rect {
     
+    CFTimeInterval frameStart = CACurrentMediaTime();
+
+    [self refreshLocalTargetPositions];
+
+    if (self.liveUpdates) [self updateLiveOverlays];
+
     // Compute modelview and projection matrices
     // and use them to transform GL overlay shapes
     // as well as overlay views and compass
     //
-    GLKMatrix4 cameraMatrix = GLKMatrix4Multiply(_cameraTransform, _userTransformation);
-
-    _viewMatrix = GLKMatrix4Multiply(_deviceTransform, cameraMatrix);
+    _viewMatrix = [self viewMatrixWithCameraTransform:_cameraTransform];
     
-    [self drawShapes:NO];
+    CGSize viewportSize = CGSizeMake(self.renderView.drawableWidth, self.renderView.drawableHeight);
+
+    [self drawShapes:NO withViewMatrix:_viewMatrix projectionMatrix:_projectionMatrix viewportSize:viewportSize];
+
+    [[TGLARTextureStreamer sharedStreamer] updateResidency];
 
     self.containerView.overlayTransformation = GLKMatrix4Multiply(_projectionMatrix, _viewMatrix);
 
-    if (self.compass) {
+    if (self.compass && (_frameCount % _qualitySettings.compassInterval) == 0) {
         
         bool inverted;
         
@@ -660,9 +1051,152 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
             [self.compass setHeadingAngle:northAngle];
         }
     }
+
+    // Overlay view layout is part of the frame cost
+    //
+    [self.containerView layoutIfNeeded];
+
+    // The radar reuses this frame's culling results
+    //
+    if (self.radar) [self updateRadar];
+
+    _frameCount++;
+
+    // Redraws not triggered by the display link have no interval
+    //
+    CFTimeInterval displayInterval = _displayInterval;
+
+    _displayInterval = 0.0;
+
+    if (self.isAdaptingQuality && TGLARFrameGovernorUpdate(&_governor, CACurrentMediaTime() - frameStart, displayInterval) != 0) {
+
+        [self applyQualitySettings];
+    }
+}
+
+- (void)applyQualitySettings {
+
+    _qualitySettings = TGLARQualitySettingsForLevel(_governor.level);
+
+    self.containerView.maxVisibleOverlays = (_qualitySettings.maxVisibleLabels == UINT32_MAX) ? NSUIntegerMax : _qualitySettings.maxVisibleLabels;
+    self.containerView.calloutUpdateInterval = _qualitySettings.calloutInterval;
+
+    [self.displayLink setFrameInterval:[self displayFrameInterval]];
+}
+
+- (NSInteger)displayFrameInterval {
+
+    // The frame interval follows the target frame time,
+    // e.g. every other refresh for 1/30 s at 60 Hz
+    //
+    NSInteger framesPerSecond = 60;
+
+    if (@available(iOS 10.3, *)) framesPerSecond = MAX(UIScreen.mainScreen.maximumFramesPerSecond, 1);
+
+    return TGLARFrameGovernorFrameInterval(&_governor, _governor.level, 1.0 / (double)framesPerSecond);
+}
+
+- (void)updateRadar {
+
+    NSUInteger count = self.overlays.count;
+
+    const GLKVector3 *targetPositions = _targetPositions.bytes;
+    uint8_t *radarFlags = _radarFlags.mutableBytes;
+    const NSInteger *radarViewIndexes = _radarViewIndexes.bytes;
+
+    // Reuse the overlay views' culling results
+    // from the container's last layout pass
+    //
+    const uint8_t *visibleFlags = self.containerView.visibleFlags;
+
+    GLKMatrix4 overlayTransformation = GLKMatrix4Multiply(_projectionMatrix, _viewMatrix);
+
+    for (NSUInteger idx = 0; idx < count; idx++) {
+
+        if (radarViewIndexes[idx] >= 0) {
+
+            radarFlags[idx] = visibleFlags ? visibleFlags[radarViewIndexes[idx]] : 0;
+
+        } else {
+
+            // Overlays with a shape only are visible
+            // if their target is inside the frustum
+            //
+            GLKVector4 homoVector = GLKMatrix4MultiplyVector4(overlayTransformation, GLKVector4MakeWithVector3(targetPositions[idx], 1.0));
+
+            radarFlags[idx] = (homoVector.w > 0.0 && fabsf(homoVector.x) <= homoVector.w && fabsf(homoVector.y) <= homoVector.w && homoVector.z <= homoVector.w);
+        }
+    }
+
+    [self.radar updateWithPositions:targetPositions visibleFlags:radarFlags count:count viewMatrix:_viewMatrix range:self.farClippingDistance];
+}
+
+- (void)refreshLocalTargetPositions {
+
+    // Overlays without world position may move
+    // their target positions at any time
+    //
+    NSArray<id<TGLAROverlay>> *overlays = self.overlays;
+    NSUInteger count = overlays.count;
+
+    GLKVector3 *targetPositions = _targetPositions.mutableBytes;
+
+    for (NSUInteger idx = _worldCount; idx < count; idx++) {
+
+        targetPositions[idx] = [overlays[idx] targetPosition];
+    }
+}
+
+- (void)updateLiveOverlays {
+
+    NSUInteger count = _overlayIndexes.length / sizeof(NSInteger);
+
+    const NSInteger *overlayIndexes = _overlayIndexes.bytes;
+    TGLARWorldPosition *worldPositions = _worldPositions.mutableBytes;
+    GLKVector3 *targetPositions = _targetPositions.mutableBytes;
+
+    NSUInteger worldCount = _worldCount;
+    TGLARWorldPosition floatingOrigin = self.floatingOrigin;
+
+    // Without a display link, e.g. while rendering
+    // on demand, positions are shown immediately
+    //
+    CFTimeInterval time = self.displayLink ? _displayTimestamp : CACurrentMediaTime();
+
+    [self.liveUpdates advanceToTime:time usingBlock:^(NSUInteger track, TGLARWorldPosition position) {
+
+        NSInteger index = (track < count) ? overlayIndexes[track] : -1;
+
+        if (index < 0) return;
+
+        // Keep the world position, so rebasing and
+        // snapshots don't fall back to a stale one
+        //
+        if ((NSUInteger)index < worldCount) worldPositions[index] = position;
+
+        TGLARFloatingOriginRebase(&position, 1, floatingOrigin, targetPositions[index].v);
+    }];
+}
+
+- (void)prepareShapesWithViewMatrix:(GLKMatrix4)viewMatrix projectionMatrix:(GLKMatrix4)projectionMatrix viewportSize:(CGSize)viewportSize {
+
+    const GLKVector3 *targetPositions = _targetPositions.bytes;
+    const NSUInteger *shapeTargetIndexes = _shapeTargetIndexes.bytes;
+
+    for (NSInteger idx = 0; idx < self.overlayShapes.count; idx++) {
+
+        TGLARShapeOverlay *shape = self.overlayShapes[idx];
+
+        shape.targetPosition = targetPositions[shapeTargetIndexes[idx]];
+        shape.cameraPosition = _cameraPosition;
+        shape.viewMatrix = viewMatrix;
+        shape.projectionMatrix = projectionMatrix;
+        shape.viewportSize = viewportSize;
+        shape.detailScale = _qualitySettings.detailScale;
+    }
 }
 
-- (void)drawShapes:(BOOL)picking {
+- (void)drawShapes:(BOOL)picking withViewMatrix:(GLKMatrix4)viewMatrix projectionMatrix:(GLKMatrix4)projectionMatrix viewportSize:(CGSize)viewportSize {
     
     glEnable(GL_DEPTH_TEST);
     glEnable(GL_CULL_FACE);
@@ -678,13 +1212,12 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
 
     glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
     
+    [self prepareShapesWithViewMatrix:viewMatrix projectionMatrix:projectionMatrix viewportSize:viewportSize];
+
     for (NSInteger idx = 0; idx < self.overlayShapes.count; idx++) {
         
         TGLARShapeOverlay *shape = self.overlayShapes[idx];
         
-        shape.viewMatrix = _viewMatrix;
-        shape.projectionMatrix = _projectionMatrix;
-        
         if (picking) {
 
             // TODO: idx > 254
@@ -706,51 +1239,30 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
     
     [EAGLContext setCurrentContext:self.renderContext];
 
-    NSInteger height = self.renderView.drawableHeight;
-    NSInteger width = self.renderView.drawableWidth;
-
-    GLuint framebuffer;
-
-    glGenFramebuffers(1, &framebuffer);
-    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    GLsizei height = (GLsizei)self.renderView.drawableHeight;
+    GLsizei width = (GLsizei)self.renderView.drawableWidth;
 
-    GLuint colorRenderbuffer;
+    // Keep the pick buffer between taps and
+    // only recreate it when the size changes
+    //
+    if (self.pickFramebuffer.width != width || self.pickFramebuffer.height != height) {
 
-    glGenRenderbuffers(1, &colorRenderbuffer);
-    glBindRenderbuffer(GL_RENDERBUFFER, colorRenderbuffer);
+        self.pickFramebuffer = [[TGLARFramebuffer alloc] initWithContext:self.renderContext width:width height:height];
+    }
 
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES, (GLsizei)width, (GLsizei)height);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRenderbuffer);
+    if (self.pickFramebuffer == nil) return nil;
     
-    GLuint depthRenderbuffer;
+    [self.pickFramebuffer bind];
 
-    glGenRenderbuffers(1, &depthRenderbuffer);
-    glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
-
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, (GLsizei)width, (GLsizei)height);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
-
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-
-    if (status != GL_FRAMEBUFFER_COMPLETE) {
-
-        NSLog(@"Framebuffer status: %x", (int)status);
-        return nil;
-    }
+    [self drawShapes:YES withViewMatrix:_viewMatrix projectionMatrix:_projectionMatrix viewportSize:CGSizeMake(width, height)];
     
-    [self drawShapes:YES];
-    
-    Byte pixelColor[4] = {0,};
+    GLubyte pixelColor[4] = {0,};
     CGFloat scale = UIScreen.mainScreen.scale;
 
-    glReadPixels(point.x * scale, (height - (point.y * scale)), 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixelColor);
+    [self.pickFramebuffer readPixelAtX:point.x * scale y:(height - (point.y * scale)) into:pixelColor];
 
     //NSLog(@"%s Pixel color @ %@: %x %x %x %x", __PRETTY_FUNCTION__, NSStringFromCGPoint(point), pixelColor[0], pixelColor[1], pixelColor[2], pixelColor[3]);
     
-    glDeleteRenderbuffers(1, &depthRenderbuffer);
-    glDeleteRenderbuffers(1, &colorRenderbuffer);
-    glDeleteFramebuffers(1, &framebuffer);
-    
     [self.renderView bindDrawable];
 
     NSInteger idx = pixelColor[0];
@@ -758,6 +1270,72 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
     return (idx > 0 && idx <= self.overlayShapes.count) ? self.overlayShapes[idx-1] : nil;
 }
 
+#pragma mark - Offscreen rendering
+
+- (NSData *)renderShapesWithCameraTransform:(GLKMatrix4)cameraTransform width:(NSUInteger)width height:(NSUInteger)height renderTime:(NSTimeInterval *)renderTime {
+
+    if (width == 0 || height == 0) return nil;
+
+    TGLARRenderBackend backend = { (__bridge void *)self, TGLARViewMakeCurrent, TGLARViewBindOffscreenTarget };
+
+    [EAGLContext setCurrentContext:self.renderContext];
+
+    // Everything the frame depends on is resolved
+    // first, so a single pass draws it completely
+    //
+    [TGLARMesh waitForPendingLoadsWithContext:self.renderContext];
+
+    [self refreshLocalTargetPositions];
+
+    if (self.liveUpdates) [self updateLiveOverlays];
+
+    GLKMatrix4 viewMatrix = [self viewMatrixWithCameraTransform:cameraTransform];
+    GLKMatrix4 projectionMatrix = [self projectionMatrixWithAspect:(CGFloat)width / (CGFloat)height];
+    CGSize viewportSize = CGSizeMake(width, height);
+
+    [self prepareShapesWithViewMatrix:viewMatrix projectionMatrix:projectionMatrix viewportSize:viewportSize];
+
+    for (TGLARShapeOverlay *shape in self.overlayShapes) [shape requestResources];
+
+    [[TGLARTextureStreamer sharedStreamer] updateResidency];
+
+    if (!TGLARRenderBackendBegin(&backend, (uint32_t)width, (uint32_t)height)) return nil;
+
+    CFTimeInterval start = CACurrentMediaTime();
+
+    [self drawShapes:NO withViewMatrix:viewMatrix projectionMatrix:projectionMatrix viewportSize:viewportSize];
+
+    // Wait for the GPU to finish, so the
+    // measured time includes actual drawing
+    //
+    glFinish();
+
+    if (renderTime) *renderTime = CACurrentMediaTime() - start;
+
+    NSMutableData *pixels = [NSMutableData dataWithLength:width * height * 4];
+
+    TGLARRenderBackendReadPixels(&backend, (uint32_t)width, (uint32_t)height, pixels.mutableBytes);
+
+    if (self.renderView.window) [self.renderView bindDrawable];
+
+    return pixels;
+}
+
+- (BOOL)bindOffscreenFramebufferWithWidth:(GLsizei)width height:(GLsizei)height {
+
+    // Replaying poses renders many images of
+    // one size, so the framebuffer is reused
+    //
+    if (self.offscreenFramebuffer.width != width || self.offscreenFramebuffer.height != height) {
+
+        self.offscreenFramebuffer = [[TGLARFramebuffer alloc] initWithContext:self.renderContext width:width height:height];
+    }
+
+    [self.offscreenFramebuffer bind];
+
+    return (self.offscreenFramebuffer != nil);
+}
+
 #pragma mark - Projection matrix handling
 
 - (void)computeFovFromCameraFormat {
@@ -804,21 +1382,43 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
 
 - (void)updateProjectionMatrix {
     
+    _projectionMatrix = [self projectionMatrixWithAspect:self.bounds.size.width / self.bounds.size.height];
+}
+
+- (GLKMatrix4)projectionMatrixWithAspect:(CGFloat)aspect {
+
     // Initialize camera & projection matrix
     //
     CGFloat fovy = self.effectiveVerticalFov;
-    CGFloat aspect = self.bounds.size.width / self.bounds.size.height;
     
     CGFloat near = ([self.delegate respondsToSelector:@selector(arViewShapeOverlayNearClippingDistance:)]) ? [self.delegate arViewShapeOverlayNearClippingDistance:self] : 1.0;
-    CGFloat far = ([self.delegate respondsToSelector:@selector(arViewShapeOverlayFarClippingDistance:)]) ? [self.delegate arViewShapeOverlayFarClippingDistance:self] : 10000.0;
     
-    _projectionMatrix = GLKMatrix4MakePerspective(GLKMathDegreesToRadians(fovy), aspect, near, far);
+    return GLKMatrix4MakePerspective(GLKMathDegreesToRadians(fovy), aspect, near, self.farClippingDistance);
+}
+
+- (CGFloat)farClippingDistance {
+
+    return ([self.delegate respondsToSelector:@selector(arViewShapeOverlayFarClippingDistance:)]) ? [self.delegate arViewShapeOverlayFarClippingDistance:self] : 10000.0;
+}
+
+- (GLKMatrix4)viewMatrixWithCameraTransform:(GLKMatrix4)cameraTransform {
+
+    GLKMatrix4 cameraMatrix = GLKMatrix4Multiply(cameraTransform, _userTransformation);
+
+    return GLKMatrix4Multiply(_deviceTransform, cameraMatrix);
 }
 
 - (void)updateUserTransformation {
     
+    // Camera movement relative to the floating origin
+    // is small enough to be kept in single precision
+    //
+    GLKVector3 cameraOffset = [self targetPositionForWorldPosition:self.cameraWorldPosition];
+
+    _cameraPosition = GLKVector3Make(self.positionOffset.width + cameraOffset.x, self.positionOffset.height + cameraOffset.y, self.heightOffset + cameraOffset.z);
+
     GLKMatrix4 rotation = GLKMatrix4MakeRotation(self.headingOffset / 180.0 * M_PI, 0.0, 0.0, 1.0);
-    GLKMatrix4 translation = GLKMatrix4MakeTranslation(-self.positionOffset.width, -self.positionOffset.height, -self.heightOffset);
+    GLKMatrix4 translation = GLKMatrix4MakeTranslation(-self.positionOffset.width - cameraOffset.x, -self.positionOffset.height - cameraOffset.y, -self.heightOffset - cameraOffset.z);
     
     _userTransformation = GLKMatrix4Multiply(rotation, translation);
 }
@@ -841,6 +1441,15 @@ static const CGFloat kFOVARViewLensAdjustmentFactor = 0.05;
 
 #pragma mark - Helpers
 
+- (NSInteger)overlayIndexForIndex:(NSInteger)index {
+
+    if (index < 0 || (NSUInteger)index >= _overlayIndexes.length / sizeof(NSInteger)) return -1;
+
+    const NSInteger *overlayIndexes = _overlayIndexes.bytes;
+
+    return overlayIndexes[index];
+}
+
 - (CGFloat)effectiveVerticalFov {
     
     if (UIInterfaceOrientationIsPortrait(self.interfaceOrientation)) {
@@ -62,5 +62,7 @@
 
 /// Private property. For internal use only
 @property (nonatomic, assign) GLKVector3 viewPosition;
+/// Private property. For internal use only
+@property (nonatomic, assign) BOOL calloutSettled;
 
 @end
@@ -0,0 +1,138 @@
+//
+//  PlaceSearchIndexBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "PlaceSearchIndex.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const char *const kWords[] = {
+
+    "alte", "bahnhof", "berg", "brücke", "burg", "dom", "feld", "garten", "hafen", "haus",
+    "hof", "kirche", "markt", "mühle", "neue", "park", "platz", "schloss", "see", "stadt",
+    "straße", "tor", "turm", "wald", "weg", "zoo", "am", "an", "st", "museum",
+    "apotheke", "bäckerei", "café", "hotel", "schule", "rathaus", "post", "bank", "kino", "theater"
+};
+
+static const size_t kWordCount = sizeof(kWords) / sizeof(kWords[0]);
+
+static double randomDouble(double min, double max) {
+
+    return min + (max - min) * (double)rand() / (double)RAND_MAX;
+}
+
+// Measures queries of the offline search over a generated
+// catalogue of 1M places in Germany, clustered in cities
+// like real points of interest. Fails if any query takes
+// longer than the 10 ms target
+//
+int main(void) {
+
+    const uint32_t count = 1000000;
+    const size_t maxResults = 50;
+    const int repeats = 20;
+
+    PlaceSearchResult results[50];
+    PlaceSearchIndex index;
+
+    PlaceSearchIndexInit(&index, 0.01);
+
+    srand(1);
+
+    double start = TGLARTestNow();
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        char name[96];
+        int words = 1 + rand() % 3;
+
+        snprintf(name, sizeof(name), "%s", kWords[rand() % kWordCount]);
+
+        for (int word = 1; word < words; word++) {
+
+            size_t length = strlen(name);
+
+            snprintf(name + length, sizeof(name) - length, " %s", kWords[rand() % kWordCount]);
+        }
+
+        size_t length = strlen(name);
+
+        snprintf(name + length, sizeof(name) - length, " %u", idx % 1000);
+
+        double cityLatitude = 47.5 + (double)(idx % 97) / 97.0 * 7.0;
+        double cityLongitude = 6.5 + (double)(idx % 89) / 89.0 * 8.0;
+
+        PlaceSearchIndexAdd(&index, name, cityLatitude + randomDouble(-0.1, 0.1), cityLongitude + randomDouble(-0.15, 0.15));
+    }
+
+    double added = TGLARTestNow() - start;
+
+    start = TGLARTestNow();
+
+    if (!PlaceSearchIndexBuild(&index)) {
+
+        printf("index could not be built\n");
+        return 1;
+    }
+
+    printf("places %u: add %8.1f ms, build %8.1f ms\n", count, added * 1.0e3, (TGLARTestNow() - start) * 1.0e3);
+
+    const char *queries[] = { "", "a", "st", "park", "bahnhof", "schloss see", "platz 12", "muhle", "cafe 999", "theater 1", "qxz" };
+
+    double overall = 0.0;
+
+    for (size_t query = 0; query < sizeof(queries) / sizeof(queries[0]); query++) {
+
+        double worst = 0.0;
+        double sum = 0.0;
+        size_t found = 0;
+
+        for (int repeat = 0; repeat < repeats; repeat++) {
+
+            double latitude = randomDouble(47.5, 54.5);
+            double longitude = randomDouble(6.5, 14.5);
+
+            start = TGLARTestNow();
+
+            found += PlaceSearchIndexQuery(&index, queries[query], latitude, longitude, results, maxResults);
+
+            double time = TGLARTestNow() - start;
+
+            worst = fmax(worst, time);
+            sum += time;
+        }
+
+        overall = fmax(overall, worst);
+
+        printf("query %-14s mean %8.3f ms, max %8.3f ms (%zu results)\n", queries[query], sum / repeats * 1.0e3, worst * 1.0e3, found / (size_t)repeats);
+    }
+
+    printf("slowest query %.3f ms, target 10 ms\n", overall * 1.0e3);
+
+    PlaceSearchIndexDestroy(&index);
+
+    return (overall > 0.010) ? 1 : 0;
+}
@@ -0,0 +1,260 @@
+//
+//  PlaceSearchIndexTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "PlaceSearchIndex.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const char *const kWords[] = {
+
+    "alte", "bahnhof", "berg", "brücke", "burg", "dom", "feld", "garten", "hafen", "haus",
+    "hof", "kirche", "markt", "mühle", "neue", "park", "platz", "schloss", "see", "stadt",
+    "straße", "tor", "turm", "wald", "weg", "zoo", "am", "an", "st", "museum"
+};
+
+static const size_t kWordCount = sizeof(kWords) / sizeof(kWords[0]);
+
+static double randomDouble(double min, double max) {
+
+    return min + (max - min) * (double)rand() / (double)RAND_MAX;
+}
+
+static void randomName(char *name, size_t capacity) {
+
+    int words = 1 + rand() % 3;
+
+    name[0] = '\0';
+
+    for (int idx = 0; idx < words; idx++) {
+
+        if (idx > 0) strncat(name, " ", capacity - strlen(name) - 1);
+
+        strncat(name, kWords[rand() % kWordCount], capacity - strlen(name) - 1);
+    }
+
+    char number[16];
+
+    snprintf(number, sizeof(number), " %d", rand() % 100);
+    strncat(name, number, capacity - strlen(name) - 1);
+}
+
+// Folding as documented, restricted to the characters
+// used by the generated names
+//
+static void foldName(const char *name, char *folded, size_t capacity) {
+
+    size_t length = 0;
+
+    for (const unsigned char *s = (const unsigned char *)name; *s && length + 3 < capacity; s++) {
+
+        if (*s == 0xC3 && s[1] == 0xBC) { folded[length++] = 'u'; s++; }
+        else if (*s == 0xC3 && s[1] == 0x9F) { folded[length++] = 's'; folded[length++] = 's'; s++; }
+        else folded[length++] = (char)*s;
+    }
+
+    folded[length] = '\0';
+}
+
+static int nameMatches(const char *folded, const char *query) {
+
+    if (query[0] == '\0') return 1;
+
+    if (strlen(query) > 2) return strstr(folded, query) != NULL;
+
+    // Short queries match word prefixes only
+    //
+    for (const char *word = folded; word; word = strchr(word, ' ') ? strchr(word, ' ') + 1 : NULL) {
+
+        if (strncmp(word, query, strlen(query)) == 0) return 1;
+    }
+
+    return 0;
+}
+
+static int compareDoubles(const void *a, const void *b) {
+
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+
+    return (da > db) - (da < db);
+}
+
+static void testQueriesMatchBruteForce(void) {
+
+    const uint32_t count = 20000;
+    const size_t maxResults = 25;
+
+    char (*folded)[64] = malloc(count * sizeof(*folded));
+    double *distances = malloc(count * sizeof(double));
+    PlaceSearchResult results[25];
+    PlaceSearchIndex index;
+
+    PlaceSearchIndexInit(&index, 0.01);
+
+    srand(32);
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        char name[64];
+
+        randomName(name, sizeof(name));
+        foldName(name, folded[idx], sizeof(folded[idx]));
+
+        // Dense clusters around a few cities
+        // and a sparse rest of the region
+        //
+        double latitude = (idx % 4 == 0) ? randomDouble(47.0, 55.0) : 52.5 + randomDouble(-0.2, 0.2) * (idx % 3 == 0 ? -8.0 : 1.0);
+        double longitude = (idx % 4 == 0) ? randomDouble(6.0, 15.0) : 13.4 + randomDouble(-0.3, 0.3) * (idx % 3 == 0 ? -5.0 : 1.0);
+
+        TGLAR_EXPECT(PlaceSearchIndexAdd(&index, name, latitude, longitude));
+    }
+
+    TGLAR_EXPECT(PlaceSearchIndexBuild(&index));
+    TGLAR_EXPECT(!PlaceSearchIndexAdd(&index, "too late", 0.0, 0.0));
+
+    const char *queries[] = { "", "a", "st", "s", "zoo", "berg", "platz 1", "ss", "muhle", "straße", "stra", "schloss see", "xyz", "m 7" };
+
+    for (size_t query = 0; query < sizeof(queries) / sizeof(queries[0]); query++) {
+
+        char foldedQuery[64];
+
+        foldName(queries[query], foldedQuery, sizeof(foldedQuery));
+
+        for (int location = 0; location < 10; location++) {
+
+            double latitude = randomDouble(47.0, 55.0);
+            double longitude = randomDouble(6.0, 15.0);
+
+            if (location % 2) {
+
+                latitude = 52.5 + randomDouble(-0.1, 0.1);
+                longitude = 13.4 + randomDouble(-0.1, 0.1);
+            }
+
+            size_t found = PlaceSearchIndexQuery(&index, queries[query], latitude, longitude, results, maxResults);
+            size_t matching = 0;
+
+            for (uint32_t idx = 0; idx < count; idx++) {
+
+                if (!nameMatches(folded[idx], foldedQuery)) continue;
+
+                double entryLatitude, entryLongitude;
+
+                PlaceSearchIndexCoordinate(&index, idx, &entryLatitude, &entryLongitude);
+
+                distances[matching++] = PlaceSearchIndexDistance(latitude, longitude, entryLatitude, entryLongitude);
+            }
+
+            qsort(distances, matching, sizeof(double), compareDoubles);
+
+            // The nearest matching places are found in order,
+            // ties may be reported in either order
+            //
+            TGLAR_EXPECT(found == (matching < maxResults ? matching : maxResults));
+
+            for (size_t idx = 0; idx < found; idx++) {
+
+                TGLAR_EXPECT(nameMatches(folded[results[idx].entry], foldedQuery));
+                TGLAR_EXPECT_NEAR(results[idx].distance, distances[idx], 1.0e-6);
+            }
+        }
+    }
+
+    PlaceSearchIndexDestroy(&index);
+
+    free(folded);
+    free(distances);
+}
+
+static void testFolding(void) {
+
+    PlaceSearchIndex index;
+    PlaceSearchResult results[4];
+
+    PlaceSearchIndexInit(&index, 0.01);
+
+    TGLAR_EXPECT(PlaceSearchIndexAdd(&index, "Schloß Schönbrunn", 48.185833, 16.312222));
+    TGLAR_EXPECT(PlaceSearchIndexAdd(&index, "Sacré-Coeur", 48.886705, 2.343104));
+    TGLAR_EXPECT(PlaceSearchIndexAdd(&index, "  Tower   Bridge ", 51.505455, -0.075356));
+    TGLAR_EXPECT(PlaceSearchIndexBuild(&index));
+
+    // Case, diacritics and punctuation are ignored,
+    // runs of separators become a single space
+    //
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "SCHLOSS", 48.0, 16.0, results, 4) == 1 && results[0].entry == 0);
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "schonbrunn", 48.0, 16.0, results, 4) == 1 && results[0].entry == 0);
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "sacre coeur", 48.0, 2.0, results, 4) == 1 && results[0].entry == 1);
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "tower bridge", 51.0, 0.0, results, 4) == 1 && results[0].entry == 2);
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "br", 51.0, 0.0, results, 4) == 1 && results[0].entry == 2);
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "ow", 51.0, 0.0, results, 4) == 0);
+
+    TGLAR_EXPECT(strcmp(PlaceSearchIndexName(&index, 1), "Sacré-Coeur") == 0);
+
+    PlaceSearchIndexDestroy(&index);
+}
+
+static void testEmptyAndUnbuiltIndex(void) {
+
+    PlaceSearchIndex index;
+    PlaceSearchResult results[4];
+
+    PlaceSearchIndexInit(&index, 0.01);
+
+    TGLAR_EXPECT(PlaceSearchIndexAdd(&index, "Marienplatz", 48.137154, 11.576124));
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "marien", 48.0, 11.0, results, 4) == 0);
+    TGLAR_EXPECT(PlaceSearchIndexBuild(&index));
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "marien", 48.0, 11.0, results, 0) == 0);
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, NULL, 48.0, 11.0, results, 4) == 1);
+
+    PlaceSearchIndexDestroy(&index);
+
+    PlaceSearchIndexInit(&index, 0.01);
+
+    TGLAR_EXPECT(PlaceSearchIndexBuild(&index));
+    TGLAR_EXPECT(PlaceSearchIndexQuery(&index, "", 48.0, 11.0, results, 4) == 0);
+
+    PlaceSearchIndexDestroy(&index);
+}
+
+static void testDistance(void) {
+
+    // Berlin Brandenburger Tor to München Marienplatz
+    //
+    TGLAR_EXPECT_NEAR(PlaceSearchIndexDistance(52.516275, 13.377704, 48.137154, 11.576124), 504.4e3, 1.0e3);
+    TGLAR_EXPECT_NEAR(PlaceSearchIndexDistance(0.0, 179.9, 0.0, -179.9), 22.24e3, 0.1e3);
+    TGLAR_EXPECT(PlaceSearchIndexDistance(10.0, 10.0, 10.0, 10.0) == 0.0);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testQueriesMatchBruteForce);
+    TGLAR_RUN(testFolding);
+    TGLAR_RUN(testEmptyAndUnbuiltIndex);
+    TGLAR_RUN(testDistance);
+
+    return TGLAR_RESULT();
+}
@@ -0,0 +1,76 @@
+//
+//  TGLARFloatingOriginBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARFloatingOrigin.h"
+
+#include <stdlib.h>
+
+// Measures the cost of moving the floating origin,
+// i.e. rebasing the view's contiguous world position
+// buffer into single precision target positions
+//
+static void benchmarkRebase(size_t count, int repeats) {
+
+    TGLARWorldPosition *positions = malloc(count * sizeof(TGLARWorldPosition));
+    float *targetPositions = malloc(3 * count * sizeof(float));
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        positions[idx] = TGLARWorldPositionMake(5200000.0 + (double)(idx % 1000), 1300000.0 + (double)(idx / 1000), (double)(idx % 7));
+    }
+
+    TGLARWorldPosition origin = TGLARWorldPositionMake(5200500.0, 1300500.0, 0.0);
+
+    double best = INFINITY;
+    float checksum = 0.0f;
+
+    for (int repeat = 0; repeat < repeats; repeat++) {
+
+        origin.x += 1.0;
+
+        double start = TGLARTestNow();
+
+        TGLARFloatingOriginRebase(positions, count, origin, targetPositions);
+
+        best = fmin(best, TGLARTestNow() - start);
+        checksum += targetPositions[3 * (count / 2)];
+    }
+
+    printf("rebase %8zu positions: %8.3f ms, %6.2f ns per position (checksum %g)\n", count, best * 1.0e3, best * 1.0e9 / (double)count, checksum);
+
+    free(positions);
+    free(targetPositions);
+}
+
+int main(void) {
+
+    benchmarkRebase(1000, 200);
+    benchmarkRebase(10000, 100);
+    benchmarkRebase(100000, 50);
+    benchmarkRebase(1000000, 10);
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+//
+//  TGLARFloatingOriginTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARFloatingOrigin.h"
+#include "TGLARBillboard.h"
+
+#include <stdlib.h>
+
+static void testDistanceAndThreshold(void) {
+
+    TGLARWorldPosition a = TGLARWorldPositionMake(1.0, 2.0, 3.0);
+    TGLARWorldPosition b = TGLARWorldPositionMake(4.0, 6.0, 3.0);
+
+    TGLAR_EXPECT_NEAR(TGLARWorldPositionDistance(a, b), 5.0, 1.0e-12);
+
+    TGLAR_EXPECT(!TGLARFloatingOriginShouldRebase(a, b, 5.0));
+    TGLAR_EXPECT(TGLARFloatingOriginShouldRebase(a, b, 4.999));
+}
+
+static void testRebasePrecision(void) {
+
+    // Positions on the order of the earth radius,
+    // where a float has a resolution of half a meter
+    //
+    enum { count = 1000 };
+
+    TGLARWorldPosition positions[count];
+    float targetPositions[3 * count];
+
+    TGLARWorldPosition origin = TGLARWorldPositionMake(6378137.25, -4510023.5, 812.125);
+
+    for (int idx = 0; idx < count; idx++) {
+
+        positions[idx] = TGLARWorldPositionMake(origin.x + 0.001 * idx, origin.y - 0.37 * idx, origin.z + 0.0005 * idx);
+    }
+
+    TGLARFloatingOriginRebase(positions, count, origin, targetPositions);
+
+    double maxError = 0.0;
+    double maxNaiveError = 0.0;
+
+    for (int idx = 0; idx < count; idx++) {
+
+        double expected[3] = { positions[idx].x - origin.x, positions[idx].y - origin.y, positions[idx].z - origin.z };
+
+        // Subtracting in single precision loses
+        // everything below the float resolution
+        //
+        float naive[3] = { (float)positions[idx].x - (float)origin.x, (float)positions[idx].y - (float)origin.y, (float)positions[idx].z - (float)origin.z };
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            maxError = fmax(maxError, fabs(targetPositions[3 * idx + axis] - expected[axis]));
+            maxNaiveError = fmax(maxNaiveError, fabs(naive[axis] - expected[axis]));
+        }
+    }
+
+    // Sub-millimeter near the origin, while
+    // naive subtraction is off by decimeters
+    //
+    TGLAR_EXPECT(maxError < 1.0e-4);
+    TGLAR_EXPECT(maxNaiveError > 0.1);
+}
+
+static void testRebaseMatchesSinglePosition(void) {
+
+    TGLARWorldPosition origin = TGLARWorldPositionMake(1000.0, 2000.0, 0.0);
+    TGLARWorldPosition positions[3] = { { 1000.0, 2000.0, 0.0 }, { 1500.0, 1500.0, 10.0 }, { -1.0e6, 3.0e6, -5.0 } };
+
+    float batch[9];
+
+    TGLARFloatingOriginRebase(positions, 3, origin, batch);
+
+    for (int idx = 0; idx < 3; idx++) {
+
+        float single[3];
+
+        TGLARFloatingOriginRebase(&positions[idx], 1, origin, single);
+
+        TGLAR_EXPECT(single[0] == batch[3 * idx] && single[1] == batch[3 * idx + 1] && single[2] == batch[3 * idx + 2]);
+    }
+
+    TGLAR_EXPECT(batch[0] == 0.0f && batch[1] == 0.0f && batch[2] == 0.0f);
+    TGLAR_EXPECT(batch[3] == 500.0f && batch[4] == -500.0f && batch[5] == 10.0f);
+}
+
+static void expectBillboardFaces(const float matrix[16], const float position[3], const float camera[3]) {
+
+    float toCamera[3] = { camera[0] - position[0], camera[1] - position[1], camera[2] - position[2] };
+    float length = sqrtf(toCamera[0] * toCamera[0] + toCamera[1] * toCamera[1] + toCamera[2] * toCamera[2]);
+
+    // Look axis towards the camera
+    //
+    TGLAR_EXPECT_NEAR((matrix[0] * toCamera[0] + matrix[1] * toCamera[1] + matrix[2] * toCamera[2]) / length, 1.0, 1.0e-5);
+
+    // Right axis horizontal, up axis upwards
+    //
+    TGLAR_EXPECT_NEAR(matrix[6], 0.0, 1.0e-6);
+    TGLAR_EXPECT(matrix[10] >= 0.0f);
+
+    // Orthonormal rotation without translation
+    //
+    for (int a = 0; a < 3; a++) {
+
+        for (int b = 0; b < 3; b++) {
+
+            float dot = matrix[4 * a] * matrix[4 * b] + matrix[4 * a + 1] * matrix[4 * b + 1] + matrix[4 * a + 2] * matrix[4 * b + 2];
+
+            TGLAR_EXPECT_NEAR(dot, (a == b) ? 1.0 : 0.0, 1.0e-5);
+        }
+    }
+
+    TGLAR_EXPECT(matrix[12] == 0.0f && matrix[13] == 0.0f && matrix[14] == 0.0f && matrix[15] == 1.0f);
+}
+
+static void testBillboardFacesCameraAfterRebase(void) {
+
+    // The camera moved 400 m from the floating origin,
+    // less than the rebase distance, so it is not at
+    // the origin of the rebased positions
+    //
+    TGLARWorldPosition origin = TGLARWorldPositionMake(5200000.0, 1300000.0, 0.0);
+    TGLARWorldPosition camera = TGLARWorldPositionMake(origin.x + 240.0, origin.y - 320.0, 1.6);
+    TGLARWorldPosition billboard = TGLARWorldPositionMake(origin.x + 300.0, origin.y - 250.0, 0.0);
+
+    TGLAR_EXPECT(!TGLARFloatingOriginShouldRebase(origin, camera, 500.0));
+
+    float cameraOffset[3];
+    float targetPosition[3];
+
+    TGLARFloatingOriginRebase(&camera, 1, origin, cameraOffset);
+    TGLARFloatingOriginRebase(&billboard, 1, origin, targetPosition);
+
+    float matrix[16];
+
+    TGLARBillboardMatrix(targetPosition, cameraOffset, matrix);
+
+    expectBillboardFaces(matrix, targetPosition, cameraOffset);
+
+    // Assuming the camera at the origin turns
+    // the billboard away from the actual camera
+    //
+    float zero[3] = { 0.0f, 0.0f, 0.0f };
+    float wrong[16];
+
+    TGLARBillboardMatrix(targetPosition, zero, wrong);
+
+    float toCamera[3] = { cameraOffset[0] - targetPosition[0], cameraOffset[1] - targetPosition[1], cameraOffset[2] - targetPosition[2] };
+    float length = sqrtf(toCamera[0] * toCamera[0] + toCamera[1] * toCamera[1] + toCamera[2] * toCamera[2]);
+
+    TGLAR_EXPECT((wrong[0] * toCamera[0] + wrong[1] * toCamera[1] + wrong[2] * toCamera[2]) / length < 0.5f);
+}
+
+static void testBillboardDegenerateCases(void) {
+
+    float position[3] = { 10.0f, 20.0f, 0.0f };
+    float above[3] = { 10.0f, 20.0f, 100.0f };
+    float matrix[16];
+
+    TGLARBillboardMatrix(position, above, matrix);
+
+    TGLAR_EXPECT_NEAR(matrix[2], 1.0, 1.0e-6);
+
+    for (int idx = 0; idx < 16; idx++) TGLAR_EXPECT(isfinite(matrix[idx]));
+
+    TGLARBillboardMatrix(position, position, matrix);
+
+    for (int idx = 0; idx < 16; idx++) TGLAR_EXPECT(isfinite(matrix[idx]));
+}
+
+static void testBillboardsAroundCamera(void) {
+
+    srand(27);
+
+    for (int idx = 0; idx < 1000; idx++) {
+
+        float camera[3] = { (float)(rand() % 1000) - 500.0f, (float)(rand() % 1000) - 500.0f, 1.6f };
+        float position[3] = { (float)(rand() % 20000) - 10000.0f, (float)(rand() % 20000) - 10000.0f, (float)(rand() % 200) - 100.0f };
+        float matrix[16];
+
+        TGLARBillboardMatrix(position, camera, matrix);
+
+        expectBillboardFaces(matrix, position, camera);
+    }
+}
+
+int main(void) {
+
+    TGLAR_RUN(testDistanceAndThreshold);
+    TGLAR_RUN(testRebasePrecision);
+    TGLAR_RUN(testRebaseMatchesSinglePosition);
+    TGLAR_RUN(testBillboardFacesCameraAfterRebase);
+    TGLAR_RUN(testBillboardDegenerateCases);
+    TGLAR_RUN(testBillboardsAroundCamera);
+
+    return TGLAR_RESULT();
+}
@@ -0,0 +1,312 @@
+//
+//  TGLARFrameArenaTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARFrameArena.h"
+#include "TGLAROverlayLayout.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The test is linked with --wrap for the allocation
+// functions, so every heap call of the cores is counted
+//
+void *__real_malloc(size_t size);
+void *__real_realloc(void *pointer, size_t size);
+void *__real_calloc(size_t count, size_t size);
+
+void *__wrap_malloc(size_t size);
+void *__wrap_realloc(void *pointer, size_t size);
+void *__wrap_calloc(size_t count, size_t size);
+
+static size_t allocationCount = 0;
+static int failAllocations = 0;
+
+void *__wrap_malloc(size_t size) {
+
+    allocationCount++;
+
+    return failAllocations ? NULL : __real_malloc(size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size) {
+
+    allocationCount++;
+
+    return failAllocations ? NULL : __real_realloc(pointer, size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+
+    allocationCount++;
+
+    return failAllocations ? NULL : __real_calloc(count, size);
+}
+
+// Runs the layout pass of the overlay container,
+// with fixed callout sizes instead of UIKit views,
+// over a ring of overlays swaying with the frame
+//
+static int layoutFrame(TGLAROverlayLayout *layout, uint32_t count, uint32_t frame) {
+
+    TGLAROverlayLayoutReset(layout);
+
+    float *positions = TGLARFrameArenaAlloc(&layout->arena, 3 * (count ? count : 1) * sizeof(float), __alignof__(float));
+    uint8_t *visibleFlags = TGLARFrameArenaAlloc(&layout->arena, count ? count : 1, 1);
+
+    if (positions == NULL || visibleFlags == NULL) return 0;
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        float angle = 0.2f * sinf(0.05f * frame) + 6.2831853f * idx / count;
+        float distance = 10.0f + (float)((idx * 7919) % 100);
+
+        positions[3 * idx + 0] = distance * cosf(angle);
+        positions[3 * idx + 1] = distance * sinf(angle);
+        positions[3 * idx + 2] = (float)(idx % 5);
+    }
+
+    // Perspective projection looking down the x axis
+    //
+    float transformation[16] = {
+        0.0f, 0.0f, 1.0001f, 1.0f,
+        -1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.5f, 0.0f, 0.0f,
+        0.0f, 0.0f, -0.2f, 0.0f
+    };
+
+    if (!TGLAROverlayLayoutProject(layout, positions, count, transformation, count - count / 10, visibleFlags)) return 0;
+
+    for (uint32_t idx = 0; idx < layout->visibleCount; idx++) {
+
+        TGLAROverlayLayoutPlace(layout, idx, 750.0f, 400.0f, 0.0f, 0.0f, 120.0f + (float)(idx % 3), 40.0f, idx % 2, 0);
+    }
+
+    return TGLAROverlayLayoutFinish(layout, 750.0f, 400.0f);
+}
+
+static void testLayoutPass(void) {
+
+    TGLAROverlayLayout layout;
+
+    TGLAROverlayLayoutInit(&layout, 64.0f);
+
+    TGLAR_EXPECT(layoutFrame(&layout, 1000, 0));
+
+    // Visible overlays are sorted back to front, the
+    // farthest ones are culled beyond the limit
+    //
+    TGLAR_EXPECT(layout.visibleCount > 0 && layout.visibleCount <= 900);
+
+    for (uint32_t idx = 1; idx < layout.visibleCount; idx++) {
+
+        TGLAR_EXPECT(layout.items[idx - 1].viewPosition[2] >= layout.items[idx].viewPosition[2]);
+    }
+
+    for (uint32_t idx = 0; idx < layout.visibleCount; idx++) {
+
+        const TGLAROverlayLayoutItem *item = &layout.items[idx];
+
+        TGLAR_EXPECT(item->unitLength < 2.0f && item->viewPosition[2] <= 1.0f);
+        TGLAR_EXPECT(memcmp(item->viewPosition, layout.viewPositions + 3 * item->index, sizeof(item->viewPosition)) == 0);
+
+        // Anchors sit at the projected position, right
+        // aligned rectangles extend to the left
+        //
+        float anchorX = roundf(0.5f * (item->viewPosition[0] + 1.0f) * 750.0f);
+        float anchorY = roundf(0.5f * (1.0f - item->viewPosition[1]) * 400.0f);
+
+        TGLAR_EXPECT(layout.rects[idx].x == ((idx % 2) ? anchorX - layout.rects[idx].width : anchorX));
+        TGLAR_EXPECT(layout.rects[idx].y == anchorY - 40.0f);
+    }
+
+    // Hit tests report the front most rectangle
+    // at the corner of an on screen one
+    //
+    uint32_t onScreen = layout.visibleCount;
+
+    while (onScreen-- > 0 && (layout.rects[onScreen].x < 0.0f || layout.rects[onScreen].x + layout.rects[onScreen].width > 750.0f || layout.rects[onScreen].y < 0.0f));
+
+    TGLAR_EXPECT(onScreen < layout.visibleCount);
+
+    float hitX = layout.rects[onScreen].x + 1.0f;
+    float hitY = layout.rects[onScreen].y + 1.0f;
+    uint32_t hit;
+
+    TGLAR_EXPECT(TGLARScreenGridQueryPoint(&layout.grid, hitX, hitY, &hit, 1) == 1);
+    TGLAR_EXPECT(hit >= onScreen);
+
+    for (uint32_t idx = hit + 1; idx < layout.visibleCount; idx++) {
+
+        const TGLARScreenRect *r = &layout.rects[idx];
+
+        TGLAR_EXPECT(!(hitX >= r->x && hitX < r->x + r->width && hitY >= r->y && hitY < r->y + r->height));
+    }
+
+    TGLAROverlayLayoutDestroy(&layout);
+}
+
+static void testSteadyStateDoesNotAllocate(void) {
+
+    TGLAROverlayLayout layout;
+
+    TGLAROverlayLayoutInit(&layout, 64.0f);
+
+    // Warm-up over a full sway grows the arena
+    // and grid buffers
+    //
+    for (uint32_t frame = 0; frame < 126; frame++) TGLAR_EXPECT(layoutFrame(&layout, 2000, frame));
+
+    allocationCount = 0;
+
+    // The visible set changes every frame,
+    // but the memory needed stays bounded
+    //
+    for (uint32_t frame = 126; frame < 1126; frame++) TGLAR_EXPECT(layoutFrame(&layout, 2000 - frame % 500, frame));
+
+    TGLAR_EXPECT(allocationCount == 0);
+
+    TGLAROverlayLayoutDestroy(&layout);
+}
+
+static void testSpikeAllocatesOnce(void) {
+
+    TGLAROverlayLayout layout;
+
+    TGLAROverlayLayoutInit(&layout, 64.0f);
+
+    // A still scene, so only the overlay count varies
+    //
+    for (uint32_t frame = 0; frame < 3; frame++) layoutFrame(&layout, 100, 0);
+
+    allocationCount = 0;
+
+    for (uint32_t frame = 3; frame < 10; frame++) layoutFrame(&layout, 100, 0);
+
+    TGLAR_EXPECT(allocationCount == 0);
+
+    // A larger frame overflows, the next reset grows
+    // the block once, then the larger size is steady
+    //
+    layoutFrame(&layout, 5000, 0);
+    layoutFrame(&layout, 5000, 0);
+
+    TGLAR_EXPECT(allocationCount > 0);
+    TGLAR_EXPECT(layout.arena.capacity >= 5000 * sizeof(TGLAROverlayLayoutItem));
+
+    allocationCount = 0;
+
+    for (uint32_t frame = 12; frame < 100; frame++) layoutFrame(&layout, 5000, 0);
+
+    TGLAR_EXPECT(allocationCount == 0);
+
+    TGLAROverlayLayoutDestroy(&layout);
+}
+
+static void testAlignmentAndOverflow(void) {
+
+    TGLARFrameArena arena;
+
+    TGLARFrameArenaInit(&arena, 64);
+    TGLARFrameArenaReset(&arena);
+
+    unsigned char *a = TGLARFrameArenaAlloc(&arena, 3, 1);
+    double *b = TGLARFrameArenaAlloc(&arena, sizeof(double), __alignof__(double));
+    unsigned char *c = TGLARFrameArenaAlloc(&arena, 1000, 16);
+
+    TGLAR_EXPECT(a != NULL && b != NULL && c != NULL);
+    TGLAR_EXPECT(((uintptr_t)b % __alignof__(double)) == 0);
+    TGLAR_EXPECT(((uintptr_t)c % 16) == 0);
+    TGLAR_EXPECT(arena.overflow != NULL);
+
+    // Overflow memory is fully usable
+    //
+    for (int idx = 0; idx < 1000; idx++) c[idx] = (unsigned char)idx;
+
+    *b = 1.5;
+
+    TGLARFrameArenaReset(&arena);
+
+    TGLAR_EXPECT(arena.overflow == NULL);
+    TGLAR_EXPECT(arena.capacity >= 3 + sizeof(double) + 1000);
+
+    TGLARFrameArenaDestroy(&arena);
+}
+
+static void testFailedBuildLeavesEmptyGrid(void) {
+
+    TGLARScreenGrid grid;
+    TGLARScreenRect rects[2] = { { 10.0f, 10.0f, 100.0f, 50.0f }, { 50.0f, 20.0f, 100.0f, 50.0f } };
+    uint32_t results[4];
+
+    TGLARScreenGridInit(&grid, 64.0f);
+
+    TGLAR_EXPECT(TGLARScreenGridBuild(&grid, 320.0f, 480.0f, rects, 2));
+    TGLAR_EXPECT(TGLARScreenGridQueryPoint(&grid, 60.0f, 30.0f, results, 4) == 2);
+
+    // Out of memory for a larger screen, so hit
+    // tests must not see the previous frame
+    //
+    failAllocations = 1;
+
+    TGLAR_EXPECT(!TGLARScreenGridBuild(&grid, 3200.0f, 4800.0f, rects, 2));
+
+    failAllocations = 0;
+
+    TGLAR_EXPECT(TGLARScreenGridQueryPoint(&grid, 60.0f, 30.0f, results, 4) == 0);
+
+    TGLARScreenGridDestroy(&grid);
+}
+
+static void testFailedAllocReturnsNull(void) {
+
+    TGLARFrameArena arena;
+
+    TGLARFrameArenaInit(&arena, 64);
+
+    failAllocations = 1;
+
+    TGLAR_EXPECT(TGLARFrameArenaAlloc(&arena, 32, 8) != NULL);
+    TGLAR_EXPECT(TGLARFrameArenaAlloc(&arena, 4096, 8) == NULL);
+
+    failAllocations = 0;
+
+    TGLARFrameArenaReset(&arena);
+    TGLARFrameArenaDestroy(&arena);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testLayoutPass);
+    TGLAR_RUN(testSteadyStateDoesNotAllocate);
+    TGLAR_RUN(testSpikeAllocatesOnce);
+    TGLAR_RUN(testAlignmentAndOverflow);
+    TGLAR_RUN(testFailedBuildLeavesEmptyGrid);
+    TGLAR_RUN(testFailedAllocReturnsNull);
+
+    return TGLAR_RESULT();
+}
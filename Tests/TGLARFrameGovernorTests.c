@@ -0,0 +1,229 @@
+//
+//  TGLARFrameGovernorTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARFrameGovernor.h"
+
+static const double kRefreshPeriod = 1.0 / 60.0;
+
+// A synthetic scene whose CPU and GPU cost shrink with
+// the quality level. The display shows a frame at the
+// first refresh after both are done, so a GPU bound
+// frame shows up in the display interval only
+//
+typedef struct {
+
+    double cpuTime[TGLAR_QUALITY_LEVELS];
+    double gpuTime[TGLAR_QUALITY_LEVELS];
+
+} SceneLoad;
+
+static double displayInterval(const TGLARFrameGovernor *governor, double cpuTime, double gpuTime) {
+
+    uint32_t interval = TGLARFrameGovernorFrameInterval(governor, governor->level, kRefreshPeriod);
+    double cost = fmax(cpuTime, gpuTime);
+    double refreshes = ceil(cost / kRefreshPeriod - 1.0e-9);
+
+    return kRefreshPeriod * fmax(refreshes, interval);
+}
+
+// Runs a trace and returns the number of level changes
+//
+static uint32_t runTrace(TGLARFrameGovernor *governor, const SceneLoad *load, uint32_t frames) {
+
+    uint32_t changes = 0;
+
+    for (uint32_t frame = 0; frame < frames; frame++) {
+
+        double cpuTime = load->cpuTime[governor->level];
+        double gpuTime = load->gpuTime[governor->level];
+
+        if (TGLARFrameGovernorUpdate(governor, cpuTime, displayInterval(governor, cpuTime, gpuTime)) != 0) changes++;
+    }
+
+    return changes;
+}
+
+static void testLightLoadKeepsFullQuality(void) {
+
+    TGLARFrameGovernor governor;
+    SceneLoad load = { { 0.004, 0.004, 0.004, 0.004, 0.004, 0.004 }, { 0.006, 0.006, 0.006, 0.006, 0.006, 0.006 } };
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    TGLAR_EXPECT(runTrace(&governor, &load, 3000) == 0);
+    TGLAR_EXPECT(governor.level == 0);
+}
+
+static void testCpuLoadDegradesUntilBudgetHolds(void) {
+
+    TGLARFrameGovernor governor;
+    SceneLoad load = { { 0.030, 0.024, 0.019, 0.014, 0.012, 0.010 }, { 0.005, 0.005, 0.005, 0.005, 0.005, 0.005 } };
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    runTrace(&governor, &load, 600);
+
+    // Level 3 is the first to fit into 1/60 s
+    //
+    TGLAR_EXPECT(governor.level == 3);
+
+    // and stays, as level 2 is not cheap enough to return to
+    //
+    TGLAR_EXPECT(runTrace(&governor, &load, 3000) == 0);
+}
+
+static void testGpuLoadIsSeenThroughDisplayInterval(void) {
+
+    TGLARFrameGovernor governor;
+
+    // CPU time alone always looks fine, the GPU is the
+    // bottleneck and refreshes are missed at levels 0 - 1
+    //
+    SceneLoad load = { { 0.003, 0.003, 0.003, 0.003, 0.003, 0.003 }, { 0.025, 0.020, 0.015, 0.012, 0.010, 0.008 } };
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    runTrace(&governor, &load, 600);
+
+    TGLAR_EXPECT(governor.level == 2);
+}
+
+static void testShortSpikeIsIgnored(void) {
+
+    TGLARFrameGovernor governor;
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    for (uint32_t frame = 0; frame < 1000; frame++) {
+
+        // A single hitch of 4 refreshes every 100 frames
+        //
+        int spike = (frame % 100 == 50);
+        double cpuTime = spike ? 0.060 : 0.005;
+
+        TGLAR_EXPECT(TGLARFrameGovernorUpdate(&governor, cpuTime, spike ? 4.0 * kRefreshPeriod : kRefreshPeriod) == 0);
+    }
+
+    TGLAR_EXPECT(governor.level == 0);
+}
+
+static void testRecoversWhenLoadDrops(void) {
+
+    TGLARFrameGovernor governor;
+    SceneLoad heavy = { { 0.040, 0.030, 0.025, 0.020, 0.016, 0.012 }, { 0.005, 0.005, 0.005, 0.005, 0.005, 0.005 } };
+    SceneLoad light = { { 0.004, 0.004, 0.004, 0.004, 0.004, 0.004 }, { 0.004, 0.004, 0.004, 0.004, 0.004, 0.004 } };
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    runTrace(&governor, &heavy, 1000);
+
+    TGLAR_EXPECT(governor.level >= 4);
+
+    runTrace(&governor, &light, 2000);
+
+    TGLAR_EXPECT(governor.level == 0);
+}
+
+static void testBoundaryDoesNotOscillate(void) {
+
+    TGLARFrameGovernor governor;
+
+    // Level 2 fits, level 1 is just over budget while
+    // its cost right after switching looks cheap
+    //
+    SceneLoad load = { { 0.030, 0.0175, 0.009, 0.008, 0.007, 0.006 }, { 0.005, 0.005, 0.005, 0.005, 0.005, 0.005 } };
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    runTrace(&governor, &load, 600);
+
+    uint32_t changes = runTrace(&governor, &load, 6000);
+
+    // Each failed raise doubles the waiting period,
+    // so only a few attempts are made in 100 seconds
+    //
+    TGLAR_EXPECT(changes <= 12);
+    TGLAR_EXPECT(governor.level >= 1 && governor.level <= 2);
+}
+
+static void testBatteryTargetHalvesFrameRate(void) {
+
+    TGLARFrameGovernor governor;
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 30.0);
+
+    // Full quality already runs every other refresh
+    // at 60 Hz, every fourth one on a 120 Hz display
+    //
+    TGLAR_EXPECT(TGLARFrameGovernorFrameInterval(&governor, 0, 1.0 / 60.0) == 2);
+    TGLAR_EXPECT(TGLARFrameGovernorFrameInterval(&governor, 0, 1.0 / 120.0) == 4);
+    TGLAR_EXPECT(TGLARFrameGovernorFrameInterval(&governor, TGLAR_QUALITY_LEVELS - 1, 1.0 / 60.0) == 2 * TGLARQualitySettingsForLevel(TGLAR_QUALITY_LEVELS - 1).frameInterval);
+
+    // A 25 ms frame fits the 1/30 s budget at level 0
+    //
+    SceneLoad load = { { 0.025, 0.025, 0.025, 0.025, 0.025, 0.025 }, { 0.010, 0.010, 0.010, 0.010, 0.010, 0.010 } };
+
+    TGLAR_EXPECT(runTrace(&governor, &load, 3000) == 0);
+    TGLAR_EXPECT(governor.level == 0);
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    TGLAR_EXPECT(TGLARFrameGovernorFrameInterval(&governor, 0, 1.0 / 60.0) == 1);
+    TGLAR_EXPECT(TGLARFrameGovernorFrameInterval(&governor, 0, 1.0 / 120.0) == 2);
+    TGLAR_EXPECT(TGLARFrameGovernorFrameInterval(&governor, 0, 0.0) == 1);
+}
+
+static void testIntervalAfterChangeIsIgnored(void) {
+
+    TGLARFrameGovernor governor;
+
+    TGLARFrameGovernorInit(&governor, 1.0 / 60.0);
+
+    // A long gap before the first frame, e.g. after
+    // resuming, must not count as missed refreshes
+    //
+    TGLARFrameGovernorUpdate(&governor, 0.004, 2.0);
+
+    TGLAR_EXPECT_NEAR(governor.averageFrameTime, 0.004, 1.0e-12);
+
+    TGLARFrameGovernorUpdate(&governor, 0.004, 2.0 * kRefreshPeriod);
+
+    TGLAR_EXPECT(governor.averageFrameTime > 0.004);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testLightLoadKeepsFullQuality);
+    TGLAR_RUN(testCpuLoadDegradesUntilBudgetHolds);
+    TGLAR_RUN(testGpuLoadIsSeenThroughDisplayInterval);
+    TGLAR_RUN(testShortSpikeIsIgnored);
+    TGLAR_RUN(testRecoversWhenLoadDrops);
+    TGLAR_RUN(testBoundaryDoesNotOscillate);
+    TGLAR_RUN(testBatteryTargetHalvesFrameRate);
+    TGLAR_RUN(testIntervalAfterChangeIsIgnored);
+
+    return TGLAR_RESULT();
+}
@@ -0,0 +1,154 @@
+//
+//  TGLARLiveTracksBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARLiveTracks.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+
+    TGLARLiveQueue *queue;
+    uint32_t trackCount;
+    uint32_t count;
+    uint32_t pushed;
+
+} Producer;
+
+static void *produce(void *argument) {
+
+    Producer *producer = argument;
+    TGLARLiveSample sample;
+
+    memset(&sample, 0, sizeof(sample));
+
+    while (producer->pushed < producer->count) {
+
+        sample.track = producer->pushed % producer->trackCount;
+        sample.timestamp = 1.0e-3 * producer->pushed;
+        sample.position[0] = sample.timestamp * 10.0;
+        sample.velocity[0] = 10.0;
+
+        if (TGLARLiveQueuePush(producer->queue, &sample)) {
+
+            producer->pushed++;
+
+        } else {
+
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+// Measures the queue alone between two threads, and the
+// integrator draining it per frame as TGLARView does
+//
+static void benchmarkQueue(uint32_t count) {
+
+    TGLARLiveQueue queue;
+    Producer producer = { &queue, 1, count, 0 };
+    TGLARLiveSample *samples = malloc(1024 * sizeof(TGLARLiveSample));
+    pthread_t thread;
+
+    TGLARLiveQueueInit(&queue, 16384);
+
+    double start = TGLARTestNow();
+
+    pthread_create(&thread, NULL, produce, &producer);
+
+    for (uint32_t popped = 0; popped < count; ) {
+
+        uint32_t poppedCount = TGLARLiveQueuePop(&queue, samples, 1024);
+
+        popped += poppedCount;
+
+        if (poppedCount == 0) sched_yield();
+    }
+
+    pthread_join(thread, NULL);
+
+    double time = TGLARTestNow() - start;
+
+    printf("queue      %9u samples: %8.3f ms, %8.2f M samples/s\n", count, time * 1.0e3, count / time * 1.0e-6);
+
+    TGLARLiveQueueDestroy(&queue);
+    free(samples);
+}
+
+static void benchmarkIntegrator(uint32_t trackCount, uint32_t samplesPerFrame, int frames) {
+
+    TGLARLiveQueue queue;
+    TGLARLiveIntegrator integrator;
+    TGLARLiveSample sample;
+
+    TGLARLiveQueueInit(&queue, samplesPerFrame);
+    TGLARLiveIntegratorInit(&integrator);
+    TGLARLiveIntegratorSetTrackCount(&integrator, trackCount);
+
+    memset(&sample, 0, sizeof(sample));
+
+    double best = INFINITY;
+    uint32_t sequence = 0;
+
+    for (int frame = 0; frame < frames; frame++) {
+
+        for (uint32_t idx = 0; idx < samplesPerFrame; idx++, sequence++) {
+
+            sample.track = (uint32_t)(((uint64_t)sequence * 2654435761u) % trackCount);
+            sample.timestamp = 1.0e-6 * sequence;
+            sample.position[0] = (double)sequence;
+            sample.velocity[1] = 5.0;
+
+            TGLARLiveQueuePush(&queue, &sample);
+        }
+
+        double start = TGLARTestNow();
+
+        TGLARLiveIntegratorUpdate(&integrator, &queue, 1.0e-6 * sequence + 0.01);
+
+        best = fmin(best, TGLARTestNow() - start);
+    }
+
+    printf("integrator %9u tracks, %7u samples per frame: best %8.3f ms, %8.2f M samples/s\n", trackCount, samplesPerFrame, best * 1.0e3, samplesPerFrame / best * 1.0e-6);
+
+    TGLARLiveIntegratorDestroy(&integrator);
+    TGLARLiveQueueDestroy(&queue);
+}
+
+int main(void) {
+
+    benchmarkQueue(10000000);
+
+    benchmarkIntegrator(1000, 1000, 100);
+    benchmarkIntegrator(10000, 10000, 50);
+    benchmarkIntegrator(100000, 100000, 20);
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+//
+//  TGLARLiveTracksStressTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARLiveTracks.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Built with ThreadSanitizer, so data races between
+// producer and consumer fail the test as well
+//
+#define SAMPLE_COUNT 2000000
+#define TRACK_COUNT 64
+
+typedef struct {
+
+    TGLARLiveQueue *queue;
+    uint32_t count;
+    int retry;
+    uint64_t pushed;
+
+} Producer;
+
+static void makeSample(TGLARLiveSample *sample, uint32_t sequence) {
+
+    memset(sample, 0, sizeof(TGLARLiveSample));
+
+    sample->track = sequence % TRACK_COUNT;
+    sample->reserved = sequence;
+    sample->timestamp = (double)sequence;
+    sample->position[0] = (double)sequence;
+    sample->position[1] = -(double)sequence;
+    sample->position[2] = 0.5 * sequence;
+}
+
+static int isSample(const TGLARLiveSample *sample, uint32_t sequence) {
+
+    TGLARLiveSample expected;
+
+    makeSample(&expected, sequence);
+
+    return memcmp(sample, &expected, sizeof(TGLARLiveSample)) == 0;
+}
+
+static void *produce(void *argument) {
+
+    Producer *producer = argument;
+    TGLARLiveSample sample;
+
+    for (uint32_t sequence = 0; sequence < producer->count; sequence++) {
+
+        makeSample(&sample, sequence);
+
+        if (TGLARLiveQueuePush(producer->queue, &sample)) {
+
+            producer->pushed++;
+
+        } else if (producer->retry) {
+
+            sequence--;
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+// Every sample pushed is popped exactly once, in order
+// and intact, while the queue wraps around many times
+//
+static void testLossless(void) {
+
+    TGLARLiveQueue queue;
+    Producer producer = { &queue, SAMPLE_COUNT, 1, 0 };
+    TGLARLiveSample samples[100];
+    pthread_t thread;
+
+    TGLAR_EXPECT(TGLARLiveQueueInit(&queue, 256));
+    TGLAR_EXPECT(pthread_create(&thread, NULL, produce, &producer) == 0);
+
+    uint32_t expected = 0;
+    uint32_t failures = 0;
+
+    while (expected < SAMPLE_COUNT) {
+
+        // Odd batch sizes split pops at the wrap around
+        //
+        uint32_t count = TGLARLiveQueuePop(&queue, samples, 1 + expected % 97);
+
+        for (uint32_t idx = 0; idx < count; idx++) failures += !isSample(&samples[idx], expected++);
+
+        if (count == 0) sched_yield();
+    }
+
+    pthread_join(thread, NULL);
+
+    TGLAR_EXPECT(failures == 0);
+    TGLAR_EXPECT(producer.pushed == SAMPLE_COUNT);
+    TGLAR_EXPECT(TGLARLiveQueuePop(&queue, samples, 100) == 0);
+
+    TGLARLiveQueueDestroy(&queue);
+}
+
+// A slow consumer loses samples, but never sees them
+// out of order, and pushed plus dropped adds up
+//
+static void testDropping(void) {
+
+    TGLARLiveQueue queue;
+    Producer producer = { &queue, SAMPLE_COUNT, 0, 0 };
+    TGLARLiveSample samples[16];
+    pthread_t thread;
+
+    TGLAR_EXPECT(TGLARLiveQueueInit(&queue, 64));
+    TGLAR_EXPECT(pthread_create(&thread, NULL, produce, &producer) == 0);
+
+    uint64_t popped = 0;
+    uint32_t failures = 0;
+    int64_t previous = -1;
+    int done = 0;
+
+    while (!done) {
+
+        // Read the dropped count before popping, so all
+        // samples pushed before are popped afterwards
+        //
+        done = (TGLARLiveQueueDroppedCount(&queue) + popped == SAMPLE_COUNT);
+
+        uint32_t count = TGLARLiveQueuePop(&queue, samples, 16);
+
+        for (uint32_t idx = 0; idx < count; idx++) {
+
+            uint32_t sequence = samples[idx].reserved;
+
+            failures += ((int64_t)sequence <= previous) || !isSample(&samples[idx], sequence);
+            previous = sequence;
+        }
+
+        popped += count;
+
+        if (count > 0) done = 0;
+    }
+
+    pthread_join(thread, NULL);
+
+    popped += TGLARLiveQueuePop(&queue, samples, 16);
+
+    TGLAR_EXPECT(failures == 0);
+    TGLAR_EXPECT(popped == producer.pushed);
+    TGLAR_EXPECT(popped + TGLARLiveQueueDroppedCount(&queue) == SAMPLE_COUNT);
+
+    TGLARLiveQueueDestroy(&queue);
+}
+
+// The integrator drains the queue per frame while the
+// producer pushes, and ends up at the latest samples
+//
+static void testIntegratorDraining(void) {
+
+    TGLARLiveQueue queue;
+    TGLARLiveIntegrator integrator;
+    Producer producer = { &queue, SAMPLE_COUNT / 4, 1, 0 };
+    pthread_t thread;
+
+    TGLAR_EXPECT(TGLARLiveQueueInit(&queue, 4096));
+    TGLAR_EXPECT(TGLARLiveIntegratorInit(&integrator));
+    TGLAR_EXPECT(TGLARLiveIntegratorSetTrackCount(&integrator, TRACK_COUNT));
+
+    integrator.smoothingTime = 0.0;
+
+    TGLAR_EXPECT(pthread_create(&thread, NULL, produce, &producer) == 0);
+
+    // Frames far ahead of the sample timestamps
+    // show the latest sample of each track
+    //
+    double time = (double)producer.count;
+
+    while (__atomic_load_n(&queue.head, __ATOMIC_ACQUIRE) < producer.count) {
+
+        TGLARLiveIntegratorUpdate(&integrator, &queue, time);
+    }
+
+    pthread_join(thread, NULL);
+
+    TGLAR_EXPECT(TGLARLiveIntegratorUpdate(&integrator, &queue, time) == TRACK_COUNT);
+
+    for (uint32_t track = 0; track < TRACK_COUNT; track++) {
+
+        uint32_t sequence = (producer.count - 1) - (producer.count - 1 - track) % TRACK_COUNT;
+
+        TGLAR_EXPECT(integrator.tracks[track].latest.reserved == sequence);
+        TGLAR_EXPECT(integrator.tracks[track].output[0] == (double)sequence);
+    }
+
+    TGLARLiveIntegratorDestroy(&integrator);
+    TGLARLiveQueueDestroy(&queue);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testLossless);
+    TGLAR_RUN(testDropping);
+    TGLAR_RUN(testIntegratorDraining);
+
+    return TGLAR_RESULT();
+}
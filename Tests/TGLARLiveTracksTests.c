@@ -0,0 +1,255 @@
+//
+//  TGLARLiveTracksTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARLiveTracks.h"
+
+#include <string.h>
+
+// Samples move along x only, so expected
+// positions can be worked out by hand
+//
+static void pushSample(TGLARLiveQueue *queue, uint32_t track, double timestamp, double position, double velocity) {
+
+    TGLARLiveSample sample;
+
+    memset(&sample, 0, sizeof(sample));
+
+    sample.track = track;
+    sample.timestamp = timestamp;
+    sample.position[0] = position;
+    sample.velocity[0] = velocity;
+
+    TGLAR_EXPECT(TGLARLiveQueuePush(queue, &sample));
+}
+
+static double positionAt(TGLARLiveIntegrator *integrator, TGLARLiveQueue *queue, uint32_t track, double time) {
+
+    TGLARLiveIntegratorUpdate(integrator, queue, time);
+
+    TGLAR_EXPECT(integrator->tracks[track].outputValid);
+    TGLAR_EXPECT_NEAR(integrator->tracks[track].output[1], 0.0, 1.0e-12);
+    TGLAR_EXPECT_NEAR(integrator->tracks[track].output[2], 0.0, 1.0e-12);
+
+    return integrator->tracks[track].output[0];
+}
+
+static void setUp(TGLARLiveIntegrator *integrator, TGLARLiveQueue *queue, uint32_t trackCount) {
+
+    TGLAR_EXPECT(TGLARLiveQueueInit(queue, 64));
+    TGLAR_EXPECT(TGLARLiveIntegratorInit(integrator));
+    TGLAR_EXPECT(TGLARLiveIntegratorSetTrackCount(integrator, trackCount));
+}
+
+static void tearDown(TGLARLiveIntegrator *integrator, TGLARLiveQueue *queue) {
+
+    TGLARLiveIntegratorDestroy(integrator);
+    TGLARLiveQueueDestroy(queue);
+}
+
+static void testHermiteInterpolation(void) {
+
+    TGLARLiveIntegrator integrator;
+    TGLARLiveQueue queue;
+
+    setUp(&integrator, &queue, 1);
+
+    // Starting at 2 m/s and stopping at x = 1
+    // after a second. With s = t the Hermite
+    // basis gives x = 3s² - 2s³ + 2(s³ - 2s² + s)
+    //
+    pushSample(&queue, 0, 0.0, 0.0, 2.0);
+    pushSample(&queue, 0, 1.0, 1.0, 0.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 0.0), 0.0, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 0.25), 0.4375, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 0.5), 0.75, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 0.75), 0.9375, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.0), 1.0, 1.0e-12);
+
+    // Times before the previous sample hold its position
+    //
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, -0.5), 0.0, 1.0e-12);
+
+    tearDown(&integrator, &queue);
+}
+
+static void testExtrapolationIsClamped(void) {
+
+    TGLARLiveIntegrator integrator;
+    TGLARLiveQueue queue;
+
+    setUp(&integrator, &queue, 1);
+
+    integrator.maxExtrapolation = 0.5;
+
+    pushSample(&queue, 0, 1.0, 3.0, 2.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 0.5), 3.0, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.25), 3.5, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.5), 4.0, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 10.0), 4.0, 1.0e-12);
+
+    tearDown(&integrator, &queue);
+}
+
+static void testInterpolationDelay(void) {
+
+    TGLARLiveIntegrator integrator;
+    TGLARLiveQueue queue;
+
+    setUp(&integrator, &queue, 1);
+
+    integrator.interpolationDelay = 0.5;
+
+    // Without the delay, a render time of 1 s would
+    // show the latest sample instead of the midpoint
+    //
+    pushSample(&queue, 0, 0.0, 0.0, 2.0);
+    pushSample(&queue, 0, 1.0, 1.0, 0.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.0), 0.75, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.5), 1.0, 1.0e-12);
+
+    // The latest sample does not move,
+    // so extrapolation stays put
+    //
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 3.0), 1.0, 1.0e-12);
+
+    tearDown(&integrator, &queue);
+}
+
+static void testCorrectionIsSmoothed(void) {
+
+    TGLARLiveIntegrator integrator;
+    TGLARLiveQueue queue;
+
+    setUp(&integrator, &queue, 1);
+
+    pushSample(&queue, 0, 0.0, 0.0, 1.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.0), 1.0, 1.0e-12);
+
+    // The new sample puts the track 1 m ahead of the
+    // position shown last. The difference decays with
+    // exp(-t / smoothingTime) from that frame on
+    //
+    pushSample(&queue, 0, 1.0, 2.0, 1.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.0), 1.0, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.2), 2.2 - exp(-1.0), 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.4), 2.4 - exp(-2.0), 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 2.0), 3.0 - exp(-5.0), 1.0e-12);
+
+    // Once negligible, the offset is dropped
+    //
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 2.6), 3.0, 1.0e-12);
+    TGLAR_EXPECT(integrator.tracks[0].offset[0] == 0.0);
+
+    // Without smoothing the track follows the new path at once
+    //
+    integrator.smoothingTime = 0.0;
+
+    pushSample(&queue, 0, 2.0, 5.0, 0.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 2.6), 5.0, 1.0e-12);
+
+    tearDown(&integrator, &queue);
+}
+
+static void testLargeCorrectionSnaps(void) {
+
+    TGLARLiveIntegrator integrator;
+    TGLARLiveQueue queue;
+
+    setUp(&integrator, &queue, 2);
+
+    integrator.snapDistance = 0.5;
+
+    pushSample(&queue, 0, 0.0, 0.0, 1.0);
+    pushSample(&queue, 1, 0.0, 0.0, 1.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.0), 1.0, 1.0e-12);
+
+    // Track 0 is corrected by 1 m and jumps,
+    // track 1 by 0.25 m and is blended
+    //
+    pushSample(&queue, 0, 1.0, 2.0, 1.0);
+    pushSample(&queue, 1, 1.0, 1.25, 1.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.0), 2.0, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 1, 1.0), 1.0, 1.0e-12);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.2), 2.2, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 1, 1.2), 1.45 - 0.25 * exp(-1.0), 1.0e-12);
+
+    tearDown(&integrator, &queue);
+}
+
+static void testOutOfOrderSamplesAreIgnored(void) {
+
+    TGLARLiveIntegrator integrator;
+    TGLARLiveQueue queue;
+
+    setUp(&integrator, &queue, 1);
+
+    pushSample(&queue, 0, 0.0, 0.0, 1.0);
+    pushSample(&queue, 0, 1.0, 1.0, 1.0);
+
+    // Older and repeated timestamps arrive late
+    //
+    pushSample(&queue, 0, 0.5, 100.0, 0.0);
+    pushSample(&queue, 0, 1.0, 50.0, 0.0);
+
+    TGLAR_EXPECT(TGLARLiveIntegratorUpdate(&integrator, &queue, 1.0) == 1);
+    TGLAR_EXPECT(integrator.activeTracks[0] == 0);
+
+    TGLAR_EXPECT(integrator.tracks[0].previous.timestamp == 0.0);
+    TGLAR_EXPECT(integrator.tracks[0].latest.timestamp == 1.0);
+    TGLAR_EXPECT(integrator.tracks[0].latest.position[0] == 1.0);
+
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 0.5), 0.5, 1.0e-12);
+    TGLAR_EXPECT_NEAR(positionAt(&integrator, &queue, 0, 1.5), 1.5, 1.0e-12);
+
+    // Samples for unknown tracks are dropped
+    //
+    pushSample(&queue, 3, 2.0, 7.0, 0.0);
+
+    TGLAR_EXPECT(TGLARLiveIntegratorUpdate(&integrator, &queue, 2.0) == 1);
+
+    tearDown(&integrator, &queue);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testHermiteInterpolation);
+    TGLAR_RUN(testExtrapolationIsClamped);
+    TGLAR_RUN(testInterpolationDelay);
+    TGLAR_RUN(testCorrectionIsSmoothed);
+    TGLAR_RUN(testLargeCorrectionSnaps);
+    TGLAR_RUN(testOutOfOrderSamplesAreIgnored);
+
+    return TGLAR_RESULT();
+}
@@ -0,0 +1,156 @@
+//
+//  TGLARMeshProcessingBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARMeshProcessing.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Writes an OBJ sphere of stacks x slices quads, as
+// TGLARMesh loads it from a file
+//
+static char *sphereOBJ(uint32_t stacks, uint32_t slices) {
+
+    size_t capacity = (size_t)(stacks + 1) * (slices + 1) * 160 + (size_t)stacks * slices * 80 + 1;
+    char *text = malloc(capacity);
+    size_t length = 0;
+
+    for (uint32_t stack = 0; stack <= stacks; stack++) {
+
+        float phi = (float)M_PI * stack / stacks;
+
+        for (uint32_t slice = 0; slice <= slices; slice++) {
+
+            float theta = 2.0f * (float)M_PI * slice / slices;
+            float x = sinf(phi) * cosf(theta), y = cosf(phi), z = sinf(phi) * sinf(theta);
+
+            length += (size_t)snprintf(text + length, capacity - length, "v %f %f %f\nvn %f %f %f\nvt %f %f\n", x, y, z, x, y, z, (float)slice / slices, (float)stack / stacks);
+        }
+    }
+
+    for (uint32_t stack = 0; stack < stacks; stack++) {
+
+        for (uint32_t slice = 0; slice < slices; slice++) {
+
+            uint32_t v00 = stack * (slices + 1) + slice + 1, v01 = v00 + 1, v10 = v00 + slices + 1, v11 = v10 + 1;
+
+            length += (size_t)snprintf(text + length, capacity - length, "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n", v00, v00, v00, v10, v10, v10, v11, v11, v11, v01, v01, v01);
+        }
+    }
+
+    return text;
+}
+
+static void shuffleTriangles(uint32_t *indices, uint32_t indexCount) {
+
+    for (uint32_t idx = indexCount / 3 - 1; idx > 0; idx--) {
+
+        uint32_t other = (uint32_t)rand() % (idx + 1);
+        uint32_t swap[3];
+
+        memcpy(swap, indices + 3 * idx, sizeof(swap));
+        memcpy(indices + 3 * idx, indices + 3 * other, sizeof(swap));
+        memcpy(indices + 3 * other, swap, sizeof(swap));
+    }
+}
+
+// Measures the stages TGLARMesh runs in the background
+// when loading a mesh: parsing, cache and overdraw
+// optimization, simplification and the whole build
+//
+static void benchmarkMesh(uint32_t stacks, uint32_t slices) {
+
+    char *text = sphereOBJ(stacks, slices);
+    TGLARMeshData mesh;
+    TGLARPackedMesh packed;
+
+    TGLARMeshDataInit(&mesh);
+
+    double start = TGLARTestNow();
+
+    TGLARMeshParseOBJ(&mesh, text);
+
+    double parse = TGLARTestNow() - start;
+
+    uint32_t triangleCount = mesh.indexCount / 3;
+
+    // Exported meshes are often in arbitrary order
+    //
+    shuffleTriangles(mesh.indices, mesh.indexCount);
+
+    float shuffledACMR = TGLARMeshACMR(mesh.indices, mesh.indexCount, mesh.vertexCount, TGLAR_MESH_CACHE_SIZE);
+
+    uint32_t *indices = malloc(mesh.indexCount * sizeof(uint32_t));
+
+    memcpy(indices, mesh.indices, mesh.indexCount * sizeof(uint32_t));
+
+    start = TGLARTestNow();
+
+    TGLARMeshOptimizeVertexCache(indices, mesh.indexCount, mesh.vertexCount);
+
+    double cache = TGLARTestNow() - start;
+
+    float optimizedACMR = TGLARMeshACMR(indices, mesh.indexCount, mesh.vertexCount, TGLAR_MESH_CACHE_SIZE);
+
+    start = TGLARTestNow();
+
+    TGLARMeshOptimizeOverdraw(indices, mesh.indexCount, mesh.positions, mesh.vertexCount);
+
+    double overdraw = TGLARTestNow() - start;
+
+    uint32_t *simplified = malloc(mesh.indexCount * sizeof(uint32_t));
+
+    start = TGLARTestNow();
+
+    uint32_t simplifiedCount = TGLARMeshSimplify(simplified, indices, mesh.indexCount, mesh.positions, mesh.vertexCount, 2.0f / 32.0f);
+
+    double simplify = TGLARTestNow() - start;
+
+    start = TGLARTestNow();
+
+    TGLARPackedMeshBuild(&packed, &mesh);
+
+    double build = TGLARTestNow() - start;
+
+    printf("mesh %8u triangles: parse %8.3f ms, cache %8.3f ms (ACMR %.2f -> %.2f), overdraw %8.3f ms, simplify %8.3f ms (%u triangles), build %8.3f ms (%u levels), %6.1f ns per triangle\n",
+           triangleCount, parse * 1.0e3, cache * 1.0e3, shuffledACMR, optimizedACMR, overdraw * 1.0e3, simplify * 1.0e3, simplifiedCount / 3, build * 1.0e3, packed.lodCount, (parse + build) * 1.0e9 / triangleCount);
+
+    TGLARPackedMeshDestroy(&packed);
+    TGLARMeshDataDestroy(&mesh);
+
+    free(simplified);
+    free(indices);
+    free(text);
+}
+
+int main(void) {
+
+    benchmarkMesh(50, 100);
+    benchmarkMesh(160, 320);
+    benchmarkMesh(500, 1000);
+
+    return 0;
+}
@@ -0,0 +1,416 @@
+//
+//  TGLARMeshProcessingTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARMeshProcessing.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Builds a wavy grid of n x n quads with unit spacing
+//
+static int makeGrid(TGLARMeshData *mesh, uint32_t n) {
+
+    TGLARMeshDataInit(mesh);
+
+    mesh->vertexCount = (n + 1) * (n + 1);
+    mesh->indexCount = 6 * n * n;
+
+    mesh->positions = malloc(3 * mesh->vertexCount * sizeof(float));
+    mesh->normals = malloc(3 * mesh->vertexCount * sizeof(float));
+    mesh->texCoords = malloc(2 * mesh->vertexCount * sizeof(float));
+    mesh->indices = malloc(mesh->indexCount * sizeof(uint32_t));
+
+    if (!mesh->positions || !mesh->normals || !mesh->texCoords || !mesh->indices) return 0;
+
+    for (uint32_t y = 0; y <= n; y++) {
+
+        for (uint32_t x = 0; x <= n; x++) {
+
+            uint32_t vertex = y * (n + 1) + x;
+
+            mesh->positions[3 * vertex + 0] = (float)x;
+            mesh->positions[3 * vertex + 1] = (float)y;
+            mesh->positions[3 * vertex + 2] = 0.5f * sinf(0.3f * x) * cosf(0.2f * y);
+            mesh->normals[3 * vertex + 0] = 0.0f;
+            mesh->normals[3 * vertex + 1] = 0.0f;
+            mesh->normals[3 * vertex + 2] = 1.0f;
+            mesh->texCoords[2 * vertex + 0] = (float)x / n;
+            mesh->texCoords[2 * vertex + 1] = (float)y / n;
+        }
+    }
+
+    uint32_t *index = mesh->indices;
+
+    for (uint32_t y = 0; y < n; y++) {
+
+        for (uint32_t x = 0; x < n; x++) {
+
+            uint32_t v00 = y * (n + 1) + x, v10 = v00 + 1, v01 = v00 + n + 1, v11 = v01 + 1;
+
+            *index++ = v00; *index++ = v10; *index++ = v11;
+            *index++ = v00; *index++ = v11; *index++ = v01;
+        }
+    }
+
+    return 1;
+}
+
+static void shuffleTriangles(uint32_t *indices, uint32_t indexCount) {
+
+    uint32_t triangleCount = indexCount / 3;
+
+    for (uint32_t idx = triangleCount - 1; idx > 0; idx--) {
+
+        uint32_t other = (uint32_t)rand() % (idx + 1);
+        uint32_t swap[3];
+
+        memcpy(swap, indices + 3 * idx, sizeof(swap));
+        memcpy(indices + 3 * idx, indices + 3 * other, sizeof(swap));
+        memcpy(indices + 3 * other, swap, sizeof(swap));
+    }
+}
+
+static int compareTriangles(const void *a, const void *b) {
+
+    const uint32_t *triangle1 = a;
+    const uint32_t *triangle2 = b;
+
+    for (int idx = 0; idx < 3; idx++) {
+
+        if (triangle1[idx] != triangle2[idx]) return (triangle1[idx] < triangle2[idx]) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+// Rotates triangles to start with their smallest index,
+// keeping the winding, and sorts them, so reordered
+// triangle lists compare equal
+//
+static uint32_t *canonicalTriangles(const uint32_t *indices, uint32_t indexCount) {
+
+    uint32_t *triangles = malloc(indexCount * sizeof(uint32_t));
+
+    for (uint32_t idx = 0; idx < indexCount; idx += 3) {
+
+        uint32_t first = 0;
+
+        if (indices[idx + 1] < indices[idx + first]) first = 1;
+        if (indices[idx + 2] < indices[idx + first]) first = 2;
+
+        for (uint32_t corner = 0; corner < 3; corner++) triangles[idx + corner] = indices[idx + (first + corner) % 3];
+    }
+
+    qsort(triangles, indexCount / 3, 3 * sizeof(uint32_t), compareTriangles);
+
+    return triangles;
+}
+
+static int compareFloat3(const void *a, const void *b) {
+
+    const float *value1 = a;
+    const float *value2 = b;
+
+    for (int idx = 0; idx < 3; idx++) {
+
+        if (value1[idx] != value2[idx]) return (value1[idx] < value2[idx]) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+static void testACMR(void) {
+
+    uint32_t separate[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint32_t repeated[] = { 0, 1, 2, 0, 1, 2, 0, 1, 2 };
+    uint32_t strip[] = { 0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4 };
+
+    TGLAR_EXPECT_NEAR(TGLARMeshACMR(separate, 9, 9, TGLAR_MESH_CACHE_SIZE), 3.0, 1.0e-6);
+    TGLAR_EXPECT_NEAR(TGLARMeshACMR(repeated, 9, 3, TGLAR_MESH_CACHE_SIZE), 1.0, 1.0e-6);
+    TGLAR_EXPECT_NEAR(TGLARMeshACMR(strip, 12, 6, TGLAR_MESH_CACHE_SIZE), 1.5, 1.0e-6);
+
+    // A FIFO cache of 3 entries evicts vertex 0 before it's reused
+    //
+    uint32_t evicted[] = { 0, 1, 2, 3, 4, 5, 0, 4, 5 };
+
+    TGLAR_EXPECT_NEAR(TGLARMeshACMR(evicted, 9, 6, 3), 7.0 / 3.0, 1.0e-6);
+    TGLAR_EXPECT_NEAR(TGLARMeshACMR(evicted, 9, 6, 6), 2.0, 1.0e-6);
+}
+
+static void testVertexCacheOrder(void) {
+
+    TGLARMeshData mesh;
+
+    srand(17);
+
+    TGLAR_EXPECT(makeGrid(&mesh, 100));
+
+    shuffleTriangles(mesh.indices, mesh.indexCount);
+
+    uint32_t *expected = canonicalTriangles(mesh.indices, mesh.indexCount);
+    float shuffled = TGLARMeshACMR(mesh.indices, mesh.indexCount, mesh.vertexCount, TGLAR_MESH_CACHE_SIZE);
+
+    TGLAR_EXPECT(TGLARMeshOptimizeVertexCache(mesh.indices, mesh.indexCount, mesh.vertexCount));
+
+    float optimized = TGLARMeshACMR(mesh.indices, mesh.indexCount, mesh.vertexCount, TGLAR_MESH_CACHE_SIZE);
+
+    // A grid has half as many vertices as triangles,
+    // which bounds the ACMR from below
+    //
+    TGLAR_EXPECT(shuffled > 2.0f);
+    TGLAR_EXPECT(optimized < 0.75f);
+    TGLAR_EXPECT(optimized >= 0.5f);
+
+    uint32_t *reordered = canonicalTriangles(mesh.indices, mesh.indexCount);
+
+    TGLAR_EXPECT(memcmp(expected, reordered, mesh.indexCount * sizeof(uint32_t)) == 0);
+
+    // Reducing overdraw only splits at cache flushes
+    //
+    TGLAR_EXPECT(TGLARMeshOptimizeOverdraw(mesh.indices, mesh.indexCount, mesh.positions, mesh.vertexCount));
+
+    float overdrawOptimized = TGLARMeshACMR(mesh.indices, mesh.indexCount, mesh.vertexCount, TGLAR_MESH_CACHE_SIZE);
+
+    TGLAR_EXPECT(overdrawOptimized < optimized * 1.05f);
+
+    free(reordered);
+    reordered = canonicalTriangles(mesh.indices, mesh.indexCount);
+
+    TGLAR_EXPECT(memcmp(expected, reordered, mesh.indexCount * sizeof(uint32_t)) == 0);
+
+    free(reordered);
+    free(expected);
+
+    TGLARMeshDataDestroy(&mesh);
+}
+
+static void testSimplify(void) {
+
+    TGLARMeshData mesh;
+
+    TGLAR_EXPECT(makeGrid(&mesh, 64));
+
+    uint32_t *destination = malloc(mesh.indexCount * sizeof(uint32_t));
+
+    // Cells smaller than the vertex spacing keep all triangles
+    //
+    uint32_t count = TGLARMeshSimplify(destination, mesh.indices, mesh.indexCount, mesh.positions, mesh.vertexCount, 0.5f);
+
+    TGLAR_EXPECT(count == mesh.indexCount);
+
+    uint32_t previousCount = count;
+
+    for (float cellSize = 2.0f; cellSize <= 32.0f; cellSize *= 2.0f) {
+
+        count = TGLARMeshSimplify(destination, mesh.indices, mesh.indexCount, mesh.positions, mesh.vertexCount, cellSize);
+
+        TGLAR_EXPECT(count % 3 == 0);
+        TGLAR_EXPECT(count > 0);
+        TGLAR_EXPECT(count < previousCount);
+
+        // Roughly two triangles per cell of the coarser grid
+        //
+        float cells = 64.0f / cellSize;
+
+        TGLAR_EXPECT(count / 3 <= 2.0f * (cells + 1.0f) * (cells + 1.0f));
+
+        for (uint32_t idx = 0; idx < count; idx += 3) {
+
+            TGLAR_EXPECT(destination[idx] < mesh.vertexCount && destination[idx + 1] < mesh.vertexCount && destination[idx + 2] < mesh.vertexCount);
+            TGLAR_EXPECT(destination[idx] != destination[idx + 1] && destination[idx + 1] != destination[idx + 2] && destination[idx] != destination[idx + 2]);
+        }
+
+        previousCount = count;
+    }
+
+    free(destination);
+
+    TGLARMeshDataDestroy(&mesh);
+}
+
+static void testPackedLevels(void) {
+
+    TGLARMeshData mesh;
+    TGLARPackedMesh packed;
+
+    TGLAR_EXPECT(makeGrid(&mesh, 128));
+
+    uint32_t triangleCount = mesh.indexCount / 3;
+
+    TGLAR_EXPECT(TGLARPackedMeshBuild(&packed, &mesh));
+    TGLAR_EXPECT(packed.lodCount > 1);
+    TGLAR_EXPECT(packed.lodIndexCount[0] == 3 * triangleCount);
+    TGLAR_EXPECT(packed.lodError[0] == 0.0f);
+
+    for (uint32_t level = 1; level < packed.lodCount; level++) {
+
+        // Every level saves at least a fifth of the triangles
+        //
+        TGLAR_EXPECT(packed.lodIndexCount[level] <= packed.lodIndexCount[level - 1] / 5 * 4);
+        TGLAR_EXPECT(packed.lodError[level] > packed.lodError[level - 1]);
+        TGLAR_EXPECT(packed.lodFirstIndex[level] == packed.lodFirstIndex[level - 1] + packed.lodIndexCount[level - 1]);
+    }
+
+    TGLAR_EXPECT(packed.lodFirstIndex[packed.lodCount - 1] + packed.lodIndexCount[packed.lodCount - 1] == packed.indexCount);
+
+    for (uint32_t idx = 0; idx < packed.indexCount; idx++) TGLAR_EXPECT(packed.indices[idx] < packed.vertexCount);
+
+    TGLARPackedMeshDestroy(&packed);
+    TGLARMeshDataDestroy(&mesh);
+}
+
+static void testQuantizationError(void) {
+
+    TGLARMeshData mesh;
+    TGLARPackedMesh packed;
+
+    TGLAR_EXPECT(makeGrid(&mesh, 50));
+
+    // Place the grid far off the origin at a
+    // scale of 0.1 units to exercise centering
+    //
+    for (uint32_t idx = 0; idx < 3 * mesh.vertexCount; idx++) mesh.positions[idx] = 1000.0f + 0.1f * mesh.positions[idx];
+
+    float *originalPositions = malloc(3 * mesh.vertexCount * sizeof(float));
+
+    memcpy(originalPositions, mesh.positions, 3 * mesh.vertexCount * sizeof(float));
+
+    TGLAR_EXPECT(TGLARPackedMeshBuild(&packed, &mesh));
+    TGLAR_EXPECT(packed.vertexCount == mesh.vertexCount);
+
+    // Vertices are reordered, but not changed
+    //
+    float *reorderedPositions = malloc(3 * mesh.vertexCount * sizeof(float));
+
+    memcpy(reorderedPositions, mesh.positions, 3 * mesh.vertexCount * sizeof(float));
+
+    qsort(originalPositions, mesh.vertexCount, 3 * sizeof(float), compareFloat3);
+    qsort(reorderedPositions, mesh.vertexCount, 3 * sizeof(float), compareFloat3);
+
+    TGLAR_EXPECT(memcmp(originalPositions, reorderedPositions, 3 * mesh.vertexCount * sizeof(float)) == 0);
+
+    // Positions are off by at most half a quantization step,
+    // unit normals by half a step of 1/127 per component and
+    // texture coordinates by the half float precision
+    //
+    float positionError = 0.0f, normalError = 0.0f, texCoordError = 0.0f;
+
+    for (uint32_t vertex = 0; vertex < packed.vertexCount; vertex++) {
+
+        const TGLARMeshVertex *packedVertex = &packed.vertices[vertex];
+
+        for (int axis = 0; axis < 3; axis++) {
+
+            float position = packed.center[axis] + packed.scale * packedVertex->position[axis] / 32767.0f;
+
+            positionError = fmaxf(positionError, fabsf(position - mesh.positions[3 * vertex + axis]));
+            normalError = fmaxf(normalError, fabsf(packedVertex->normal[axis] / 127.0f - mesh.normals[3 * vertex + axis]));
+        }
+
+        for (int axis = 0; axis < 2; axis++) {
+
+            uint16_t half = packedVertex->texCoord[axis];
+            float value = ldexpf((float)((half & 0x3ff) | 0x400), ((half >> 10) & 0x1f) - 25);
+
+            if ((half & 0x7fff) == 0) value = 0.0f;
+
+            texCoordError = fmaxf(texCoordError, fabsf(value - mesh.texCoords[2 * vertex + axis]));
+        }
+
+        TGLAR_EXPECT(packedVertex->position[3] == 0 && packedVertex->normal[3] == 0);
+    }
+
+    // Float positions near 1000 carry their own rounding error
+    //
+    TGLAR_EXPECT(positionError <= 0.5f * packed.scale / 32767.0f + 1.0e-4f);
+    TGLAR_EXPECT(normalError <= 0.5f / 127.0f + 1.0e-6f);
+    TGLAR_EXPECT(texCoordError <= 1.0f / 2048.0f);
+    TGLAR_EXPECT_NEAR(packed.scale, 2.5, 1.0e-3);
+
+    free(reorderedPositions);
+    free(originalPositions);
+
+    TGLARPackedMeshDestroy(&packed);
+    TGLARMeshDataDestroy(&mesh);
+}
+
+static void testHalfFromFloat(void) {
+
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(0.0f) == 0x0000);
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(-0.0f) == 0x8000);
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(1.0f) == 0x3c00);
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(0.5f) == 0x3800);
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(-2.0f) == 0xc000);
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(65504.0f) == 0x7bff);
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(1.0e6f) == 0x7c00);
+    TGLAR_EXPECT(TGLARMeshHalfFromFloat(INFINITY) == 0x7c00);
+}
+
+static void testParseOBJ(void) {
+
+    TGLARMeshData mesh;
+
+    const char *text =
+        "# quad and triangle\n"
+        "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+        "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+        "vn 0 0 1\n"
+        "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+        "f 1/1/1 3/3/1 4/4/1\n";
+
+    TGLARMeshDataInit(&mesh);
+
+    TGLAR_EXPECT(TGLARMeshParseOBJ(&mesh, text));
+    TGLAR_EXPECT(mesh.indexCount == 9);
+    TGLAR_EXPECT(mesh.vertexCount == 4);
+
+    // Texture coordinates flip to a top-left origin
+    //
+    for (uint32_t vertex = 0; vertex < mesh.vertexCount; vertex++) {
+
+        if (mesh.positions[3 * vertex] == 0.0f && mesh.positions[3 * vertex + 1] == 0.0f) TGLAR_EXPECT(mesh.texCoords[2 * vertex + 1] == 1.0f);
+    }
+
+    TGLARMeshDataDestroy(&mesh);
+    TGLARMeshDataInit(&mesh);
+
+    TGLAR_EXPECT(!TGLARMeshParseOBJ(&mesh, "v 0 0 0\nv 1 0 0\n"));
+
+    TGLARMeshDataDestroy(&mesh);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testACMR);
+    TGLAR_RUN(testVertexCacheOrder);
+    TGLAR_RUN(testSimplify);
+    TGLAR_RUN(testPackedLevels);
+    TGLAR_RUN(testQuantizationError);
+    TGLAR_RUN(testHalfFromFloat);
+    TGLAR_RUN(testParseOBJ);
+
+    return TGLAR_RESULT();
+}
@@ -0,0 +1,97 @@
+//
+//  TGLARRadarBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARRadar.h"
+
+#include <stdlib.h>
+
+// Measures a radar update per frame for all overlay
+// target positions, as passed by TGLARView from its
+// position buffer while the camera turns
+//
+static void benchmarkRadar(size_t count, int frames) {
+
+    float *positions = malloc(3 * count * sizeof(float));
+    uint8_t *visible = malloc(count);
+    TGLARRadar radar;
+
+    srand(11);
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        positions[3 * idx + 0] = (float)rand() / (float)RAND_MAX * 10000.0f - 5000.0f;
+        positions[3 * idx + 1] = (float)rand() / (float)RAND_MAX * 10000.0f - 5000.0f;
+        positions[3 * idx + 2] = (float)(rand() % 100);
+        visible[idx] = (uint8_t)(rand() % 8 == 0);
+    }
+
+    TGLARRadarInit(&radar, 32);
+
+    double best = INFINITY;
+    double sum = 0.0;
+    size_t blips = 0;
+
+    for (int frame = 0; frame < frames; frame++) {
+
+        float angle = 0.01f * frame;
+        float c = cosf(angle), s = sinf(angle);
+
+        // Horizontal camera at the origin turning around z
+        //
+        float m[16] = {
+            s, 0.0f, -c, 0.0f,
+            -c, 0.0f, -s, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
+
+        double start = TGLARTestNow();
+
+        blips += TGLARRadarUpdate(&radar, positions, visible, count, m, 5000.0f);
+
+        double time = TGLARTestNow() - start;
+
+        best = fmin(best, time);
+        sum += time;
+    }
+
+    printf("radar %8zu positions: best %8.3f ms, mean %8.3f ms, %6.2f ns per position (%zu blips per frame)\n", count, best * 1.0e3, sum / frames * 1.0e3, best * 1.0e9 / (double)count, blips / (size_t)frames);
+
+    TGLARRadarDestroy(&radar);
+
+    free(positions);
+    free(visible);
+}
+
+int main(void) {
+
+    benchmarkRadar(1000, 200);
+    benchmarkRadar(10000, 100);
+    benchmarkRadar(100000, 60);
+    benchmarkRadar(1000000, 10);
+
+    return 0;
+}
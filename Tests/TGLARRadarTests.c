@@ -0,0 +1,243 @@
+//
+//  TGLARRadarTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARRadar.h"
+
+#include <stdlib.h>
+
+// Builds a rigid view matrix for a camera at a position
+// looking horizontally into a direction, z pointing up
+//
+static void viewMatrixLookingAt(float cameraX, float cameraY, float cameraZ, float forwardX, float forwardY, float m[16]) {
+
+    float length = sqrtf(forwardX * forwardX + forwardY * forwardY);
+
+    forwardX /= length;
+    forwardY /= length;
+
+    float right[3] = { forwardY, -forwardX, 0.0f };
+    float up[3] = { 0.0f, 0.0f, 1.0f };
+    float back[3] = { -forwardX, -forwardY, 0.0f };
+    float camera[3] = { cameraX, cameraY, cameraZ };
+
+    for (int idx = 0; idx < 3; idx++) {
+
+        m[4 * idx + 0] = right[idx];
+        m[4 * idx + 1] = up[idx];
+        m[4 * idx + 2] = back[idx];
+        m[4 * idx + 3] = 0.0f;
+    }
+
+    m[12] = -(right[0] * camera[0] + right[1] * camera[1] + right[2] * camera[2]);
+    m[13] = -(up[0] * camera[0] + up[1] * camera[1] + up[2] * camera[2]);
+    m[14] = -(back[0] * camera[0] + back[1] * camera[1] + back[2] * camera[2]);
+    m[15] = 1.0f;
+}
+
+static void testProjectionIsHeadingUp(void) {
+
+    TGLARRadar radar;
+    float m[16];
+
+    TGLAR_EXPECT(TGLARRadarInit(&radar, 64));
+
+    // Camera at (100, 200) heading east, one position
+    // ahead and one to the right at half the range
+    //
+    float positions[6] = { 110.0f, 200.0f, 5.0f, 100.0f, 190.0f, -3.0f };
+
+    viewMatrixLookingAt(100.0f, 200.0f, 1.5f, 1.0f, 0.0f, m);
+
+    TGLAR_EXPECT(TGLARRadarUpdate(&radar, positions, NULL, 1, m, 20.0f) == 1);
+    TGLAR_EXPECT_NEAR(radar.blips[0].x, 0.0f, 1.0e-5f);
+    TGLAR_EXPECT_NEAR(radar.blips[0].y, 0.5f, 1.0e-5f);
+
+    TGLAR_EXPECT(TGLARRadarUpdate(&radar, positions + 3, NULL, 1, m, 20.0f) == 1);
+    TGLAR_EXPECT_NEAR(radar.blips[0].x, 0.5f, 1.0e-5f);
+    TGLAR_EXPECT_NEAR(radar.blips[0].y, 0.0f, 1.0e-5f);
+
+    // Turning the camera north moves the
+    // position ahead to the right
+    //
+    viewMatrixLookingAt(100.0f, 200.0f, 1.5f, 0.0f, 1.0f, m);
+
+    TGLAR_EXPECT(TGLARRadarUpdate(&radar, positions, NULL, 1, m, 20.0f) == 1);
+    TGLAR_EXPECT_NEAR(radar.blips[0].x, 0.5f, 1.0e-5f);
+    TGLAR_EXPECT_NEAR(radar.blips[0].y, 0.0f, 1.0e-5f);
+
+    TGLARRadarDestroy(&radar);
+}
+
+static void testLookingStraightDown(void) {
+
+    TGLARRadar radar;
+    float positions[3] = { 0.0f, 10.0f, 0.0f };
+
+    TGLAR_EXPECT(TGLARRadarInit(&radar, 32));
+
+    // Looking down with the top of the screen facing
+    // north, so the heading comes from the up axis
+    //
+    float m[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, -50.0f, 1.0f
+    };
+
+    TGLAR_EXPECT(TGLARRadarUpdate(&radar, positions, NULL, 1, m, 20.0f) == 1);
+    TGLAR_EXPECT_NEAR(radar.blips[0].x, 0.0f, 1.0e-5f);
+    TGLAR_EXPECT_NEAR(radar.blips[0].y, 0.5f, 1.0e-5f);
+
+    TGLARRadarDestroy(&radar);
+}
+
+static void testRangeAndDegenerateInput(void) {
+
+    TGLARRadar radar;
+    float m[16];
+    float positions[6] = { 0.0f, 19.9f, 0.0f, 0.0f, 20.1f, 0.0f };
+
+    TGLAR_EXPECT(TGLARRadarInit(&radar, 32));
+
+    viewMatrixLookingAt(0.0f, 0.0f, 0.0f, 0.0f, 1.0f, m);
+
+    TGLAR_EXPECT(TGLARRadarUpdate(&radar, positions, NULL, 2, m, 20.0f) == 1);
+    TGLAR_EXPECT(radar.blips[0].count == 1);
+
+    TGLAR_EXPECT(TGLARRadarUpdate(&radar, positions, NULL, 2, m, 0.0f) == 0);
+    TGLAR_EXPECT(TGLARRadarUpdate(&radar, NULL, NULL, 0, m, 20.0f) == 0);
+
+    TGLARRadarDestroy(&radar);
+}
+
+static void testBinningMatchesBruteForce(void) {
+
+    const size_t count = 20000;
+    const uint32_t resolution = 16;
+    const float range = 500.0f;
+
+    float *positions = malloc(3 * count * sizeof(float));
+    uint8_t *visible = malloc(count);
+    uint32_t *expectedCounts = calloc(resolution * resolution, sizeof(uint32_t));
+    uint32_t *expectedVisible = calloc(resolution * resolution, sizeof(uint32_t));
+    double *expectedX = calloc(resolution * resolution, sizeof(double));
+    double *expectedY = calloc(resolution * resolution, sizeof(double));
+
+    TGLARRadar radar;
+    float m[16];
+
+    TGLAR_EXPECT(TGLARRadarInit(&radar, resolution));
+
+    srand(31);
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        positions[3 * idx + 0] = 1000.0f + (float)rand() / (float)RAND_MAX * 1200.0f - 600.0f;
+        positions[3 * idx + 1] = -300.0f + (float)rand() / (float)RAND_MAX * 1200.0f - 600.0f;
+        positions[3 * idx + 2] = (float)(rand() % 50);
+        visible[idx] = (uint8_t)(rand() % 4 == 0);
+    }
+
+    viewMatrixLookingAt(1000.0f, -300.0f, 2.0f, 0.6f, 0.8f, m);
+
+    // Project each position on its own with the same
+    // heading to find the bins and centroids expected
+    //
+    size_t inRange = 0;
+
+    for (size_t idx = 0; idx < count; idx++) {
+
+        float single[3] = { positions[3 * idx], positions[3 * idx + 1], positions[3 * idx + 2] };
+        TGLARRadar one;
+
+        TGLARRadarInit(&one, resolution);
+
+        if (TGLARRadarUpdate(&one, single, NULL, 1, m, range) == 1) {
+
+            uint32_t bin = one.blips[0].bin;
+
+            expectedCounts[bin]++;
+            expectedVisible[bin] += visible[idx];
+            expectedX[bin] += one.blips[0].x;
+            expectedY[bin] += one.blips[0].y;
+            inRange++;
+        }
+
+        TGLARRadarDestroy(&one);
+    }
+
+    // Run twice, so stale bins of the
+    // first update would show up
+    //
+    TGLARRadarUpdate(&radar, positions, NULL, count / 2, m, range);
+
+    size_t blipCount = TGLARRadarUpdate(&radar, positions, visible, count, m, range);
+    size_t total = 0;
+
+    TGLAR_EXPECT(blipCount <= resolution * resolution);
+
+    for (size_t idx = 0; idx < blipCount; idx++) {
+
+        const TGLARRadarBlip *blip = &radar.blips[idx];
+
+        TGLAR_EXPECT(blip->count == expectedCounts[blip->bin]);
+        TGLAR_EXPECT(blip->visibleCount == expectedVisible[blip->bin]);
+        TGLAR_EXPECT_NEAR(blip->x, expectedX[blip->bin] / blip->count, 1.0e-4);
+        TGLAR_EXPECT_NEAR(blip->y, expectedY[blip->bin] / blip->count, 1.0e-4);
+        TGLAR_EXPECT(blip->x * blip->x + blip->y * blip->y <= 1.0f + 1.0e-5f);
+
+        // Every blip lies within its own bin
+        //
+        float binSize = 2.0f / resolution;
+
+        TGLAR_EXPECT(blip->x >= -1.0f + (blip->bin % resolution) * binSize - 1.0e-5f && blip->x <= -1.0f + (blip->bin % resolution + 1) * binSize + 1.0e-5f);
+        TGLAR_EXPECT(blip->y >= -1.0f + (blip->bin / resolution) * binSize - 1.0e-5f && blip->y <= -1.0f + (blip->bin / resolution + 1) * binSize + 1.0e-5f);
+
+        total += blip->count;
+    }
+
+    TGLAR_EXPECT(total == inRange);
+
+    TGLARRadarDestroy(&radar);
+
+    free(positions);
+    free(visible);
+    free(expectedCounts);
+    free(expectedVisible);
+    free(expectedX);
+    free(expectedY);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testProjectionIsHeadingUp);
+    TGLAR_RUN(testLookingStraightDown);
+    TGLAR_RUN(testRangeAndDegenerateInput);
+    TGLAR_RUN(testBinningMatchesBruteForce);
+
+    return TGLAR_RESULT();
+}
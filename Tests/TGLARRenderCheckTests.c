@@ -0,0 +1,138 @@
+//
+//  TGLARRenderCheckTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARRenderCheck.h"
+
+#include <string.h>
+
+static void testFlipRows(void) {
+
+    // Three rows of two pixels, the middle
+    // row of an odd height stays in place
+    //
+    uint8_t pixels[24];
+
+    for (int idx = 0; idx < 24; idx++) pixels[idx] = (uint8_t)(idx / 8);
+
+    TGLARRenderCheckFlipRows(pixels, 2, 3);
+
+    for (int idx = 0; idx < 24; idx++) TGLAR_EXPECT(pixels[idx] == (uint8_t)(2 - idx / 8));
+
+    TGLARRenderCheckFlipRows(pixels, 2, 3);
+
+    for (int idx = 0; idx < 24; idx++) TGLAR_EXPECT(pixels[idx] == (uint8_t)(idx / 8));
+}
+
+static void testCompareIdentical(void) {
+
+    uint8_t pixels[64];
+    TGLARImageDifference difference;
+
+    for (int idx = 0; idx < 64; idx++) pixels[idx] = (uint8_t)(idx * 3);
+
+    TGLARRenderCheckCompare(pixels, pixels, 4, 4, 0, &difference);
+
+    TGLAR_EXPECT(difference.mismatchedPixels == 0);
+    TGLAR_EXPECT(difference.maxDifference == 0);
+    TGLAR_EXPECT(difference.meanDifference == 0.0);
+}
+
+static void testCompareTolerance(void) {
+
+    uint8_t pixels[64];
+    uint8_t reference[64];
+    TGLARImageDifference difference;
+
+    memset(pixels, 100, sizeof(pixels));
+    memset(reference, 100, sizeof(reference));
+
+    // One pixel is off by 2 in red, another
+    // one by 10 in alpha, in both directions
+    //
+    pixels[0] = 102;
+    pixels[4 * 5 + 3] = 90;
+
+    TGLARRenderCheckCompare(pixels, reference, 4, 4, 2, &difference);
+
+    TGLAR_EXPECT(difference.mismatchedPixels == 1);
+    TGLAR_EXPECT(difference.maxDifference == 10);
+    TGLAR_EXPECT_NEAR(difference.meanDifference, 12.0 / 64.0, 1.0e-12);
+
+    TGLARRenderCheckCompare(pixels, reference, 4, 4, 1, &difference);
+
+    TGLAR_EXPECT(difference.mismatchedPixels == 2);
+
+    TGLARRenderCheckCompare(pixels, reference, 4, 4, 10, &difference);
+
+    TGLAR_EXPECT(difference.mismatchedPixels == 0);
+}
+
+static void testSummarizeTimings(void) {
+
+    double samples[100];
+    TGLARTimingSummary summary;
+
+    // Shuffled 1 ... 100 ms
+    //
+    for (int idx = 0; idx < 100; idx++) samples[idx] = (double)((idx * 37) % 100 + 1) * 1.0e-3;
+
+    TGLARRenderCheckSummarizeTimings(samples, 100, &summary);
+
+    TGLAR_EXPECT(summary.count == 100);
+    TGLAR_EXPECT_NEAR(summary.min, 1.0e-3, 1.0e-12);
+    TGLAR_EXPECT_NEAR(summary.max, 100.0e-3, 1.0e-12);
+    TGLAR_EXPECT_NEAR(summary.mean, 50.5e-3, 1.0e-12);
+    TGLAR_EXPECT_NEAR(summary.median, 51.0e-3, 1.0e-12);
+    TGLAR_EXPECT_NEAR(summary.p95, 95.0e-3, 1.0e-12);
+
+    for (int idx = 1; idx < 100; idx++) TGLAR_EXPECT(samples[idx - 1] <= samples[idx]);
+}
+
+static void testSummarizeFewTimings(void) {
+
+    double single = 4.0e-3;
+    TGLARTimingSummary summary;
+
+    TGLARRenderCheckSummarizeTimings(&single, 1, &summary);
+
+    TGLAR_EXPECT(summary.count == 1);
+    TGLAR_EXPECT(summary.min == single && summary.max == single && summary.median == single && summary.p95 == single);
+
+    TGLARRenderCheckSummarizeTimings(NULL, 0, &summary);
+
+    TGLAR_EXPECT(summary.count == 0 && summary.mean == 0.0 && summary.p95 == 0.0);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testFlipRows);
+    TGLAR_RUN(testCompareIdentical);
+    TGLAR_RUN(testCompareTolerance);
+    TGLAR_RUN(testSummarizeTimings);
+    TGLAR_RUN(testSummarizeFewTimings);
+
+    return TGLAR_RESULT();
+}
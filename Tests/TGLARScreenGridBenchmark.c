@@ -0,0 +1,123 @@
+//
+//  TGLARScreenGridBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARScreenGrid.h"
+
+#include <stdlib.h>
+
+// Measures grid rebuilds and queries for dense scenes,
+// compared against the linear scan over all overlay
+// frames that hit testing used before
+//
+static void benchmarkScene(uint32_t count, int queries) {
+
+    TGLARScreenRect *rects = malloc(count * sizeof(TGLARScreenRect));
+    uint32_t *results = malloc(count * sizeof(uint32_t));
+    float *points = malloc(2 * queries * sizeof(float));
+    TGLARScreenGrid grid;
+
+    srand(7);
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        rects[idx].x = (float)(rand() % 800) - 50.0f;
+        rects[idx].y = (float)(rand() % 420) - 20.0f;
+        rects[idx].width = 140.0f;
+        rects[idx].height = 44.0f;
+    }
+
+    for (int idx = 0; idx < 2 * queries; idx += 2) {
+
+        points[idx] = (float)(rand() % 750);
+        points[idx + 1] = (float)(rand() % 400);
+    }
+
+    TGLARScreenGridInit(&grid, 64.0f);
+    TGLARScreenGridBuild(&grid, 750.0f, 400.0f, rects, count);
+
+    double build = INFINITY;
+
+    for (int repeat = 0; repeat < 20; repeat++) {
+
+        double start = TGLARTestNow();
+
+        TGLARScreenGridBuild(&grid, 750.0f, 400.0f, rects, count);
+
+        build = fmin(build, TGLARTestNow() - start);
+    }
+
+    size_t found = 0;
+    double start = TGLARTestNow();
+
+    for (int idx = 0; idx < 2 * queries; idx += 2) {
+
+        size_t population = TGLARScreenGridCellPopulation(&grid, points[idx], points[idx + 1]);
+
+        found += TGLARScreenGridQueryPoint(&grid, points[idx], points[idx + 1], results, population);
+    }
+
+    double point = (TGLARTestNow() - start) / queries;
+
+    start = TGLARTestNow();
+
+    for (int idx = 0; idx < 2 * queries; idx += 2) found += TGLARScreenGridQueryRadius(&grid, points[idx], points[idx + 1], 44.0f, results, 8);
+
+    double radius = (TGLARTestNow() - start) / queries;
+
+    size_t scanned = 0;
+
+    start = TGLARTestNow();
+
+    for (int idx = 0; idx < 2 * queries; idx += 2) {
+
+        for (uint32_t item = count; item-- > 0; ) {
+
+            const TGLARScreenRect *r = &rects[item];
+
+            if (points[idx] >= r->x && points[idx] < r->x + r->width && points[idx + 1] >= r->y && points[idx + 1] < r->y + r->height) scanned++;
+        }
+    }
+
+    double linear = (TGLARTestNow() - start) / queries;
+
+    printf("grid %7u rects: build %8.3f ms, point %8.2f us, radius %8.2f us, linear scan %8.2f us (found %zu, scanned %zu)\n", count, build * 1.0e3, point * 1.0e6, radius * 1.0e6, linear * 1.0e6, found, scanned);
+
+    TGLARScreenGridDestroy(&grid);
+
+    free(rects);
+    free(results);
+    free(points);
+}
+
+int main(void) {
+
+    benchmarkScene(100, 10000);
+    benchmarkScene(1000, 10000);
+    benchmarkScene(10000, 2000);
+    benchmarkScene(50000, 500);
+
+    return 0;
+}
@@ -0,0 +1,223 @@
+//
+//  TGLARScreenGridTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARScreenGrid.h"
+
+#include <stdlib.h>
+
+static float randomFloat(float min, float max) {
+
+    return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+static void randomRects(TGLARScreenRect *rects, uint32_t count, float width, float height) {
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        rects[idx].width = randomFloat(20.0f, 200.0f);
+        rects[idx].height = randomFloat(20.0f, 60.0f);
+        // Partly off screen, but never outside the
+        // indexed area which would drop them
+        //
+        rects[idx].x = randomFloat(-15.0f, width - 1.0f);
+        rects[idx].y = randomFloat(-15.0f, height - 1.0f);
+    }
+}
+
+static int containsPoint(const TGLARScreenRect *r, float x, float y) {
+
+    return x >= r->x && x < r->x + r->width && y >= r->y && y < r->y + r->height;
+}
+
+static float distanceToRect(const TGLARScreenRect *r, float x, float y) {
+
+    float dx = fmaxf(fmaxf(r->x - x, 0.0f), x - (r->x + r->width));
+    float dy = fmaxf(fmaxf(r->y - y, 0.0f), y - (r->y + r->height));
+
+    return sqrtf(dx * dx + dy * dy);
+}
+
+static void testPointQueryMatchesBruteForce(void) {
+
+    const uint32_t count = 500;
+    TGLARScreenRect *rects = malloc(count * sizeof(TGLARScreenRect));
+    uint32_t *results = malloc(count * sizeof(uint32_t));
+    TGLARScreenGrid grid;
+
+    srand(29);
+    randomRects(rects, count, 750.0f, 400.0f);
+
+    TGLARScreenGridInit(&grid, 64.0f);
+    TGLAR_EXPECT(TGLARScreenGridBuild(&grid, 750.0f, 400.0f, rects, count));
+
+    for (int query = 0; query < 2000; query++) {
+
+        float x = randomFloat(0.0f, 749.0f);
+        float y = randomFloat(0.0f, 399.0f);
+
+        size_t population = TGLARScreenGridCellPopulation(&grid, x, y);
+        size_t found = TGLARScreenGridQueryPoint(&grid, x, y, results, count);
+
+        TGLAR_EXPECT(found <= population);
+
+        // All containing rectangles are found,
+        // ordered from front to back
+        //
+        size_t expected = 0;
+
+        for (uint32_t idx = count; idx-- > 0; ) {
+
+            if (!containsPoint(&rects[idx], x, y)) continue;
+
+            TGLAR_EXPECT(expected < found && results[expected] == idx);
+
+            expected++;
+        }
+
+        TGLAR_EXPECT(expected == found);
+    }
+
+    TGLARScreenGridDestroy(&grid);
+
+    free(rects);
+    free(results);
+}
+
+static void testPointQueryInStackedCell(void) {
+
+    // More rectangles than the container keeps on the
+    // stack overlap a single point, which must all be
+    // reported when sized by the cell population
+    //
+    const uint32_t count = 200;
+    TGLARScreenRect rects[200];
+    uint32_t results[200];
+    TGLARScreenGrid grid;
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        rects[idx].x = 100.0f + (float)(idx % 5);
+        rects[idx].y = 100.0f;
+        rects[idx].width = 40.0f;
+        rects[idx].height = 20.0f;
+    }
+
+    TGLARScreenGridInit(&grid, 64.0f);
+    TGLAR_EXPECT(TGLARScreenGridBuild(&grid, 320.0f, 480.0f, rects, count));
+
+    size_t population = TGLARScreenGridCellPopulation(&grid, 110.0f, 105.0f);
+
+    TGLAR_EXPECT(population >= count);
+    TGLAR_EXPECT(TGLARScreenGridQueryPoint(&grid, 110.0f, 105.0f, results, population) == count);
+    TGLAR_EXPECT(results[0] == count - 1 && results[count - 1] == 0);
+
+    TGLAR_EXPECT(TGLARScreenGridCellPopulation(&grid, -1.0f, 105.0f) == 0);
+    TGLAR_EXPECT(TGLARScreenGridCellPopulation(&grid, 300.0f, 400.0f) == 0);
+
+    TGLARScreenGridDestroy(&grid);
+}
+
+static void testRadiusQueryMatchesBruteForce(void) {
+
+    const uint32_t count = 500;
+    const size_t maxResults = 8;
+    TGLARScreenRect *rects = malloc(count * sizeof(TGLARScreenRect));
+    uint32_t results[8];
+    TGLARScreenGrid grid;
+
+    srand(31);
+    randomRects(rects, count, 750.0f, 400.0f);
+
+    TGLARScreenGridInit(&grid, 64.0f);
+    TGLAR_EXPECT(TGLARScreenGridBuild(&grid, 750.0f, 400.0f, rects, count));
+
+    for (int query = 0; query < 2000; query++) {
+
+        float x = randomFloat(0.0f, 749.0f);
+        float y = randomFloat(0.0f, 399.0f);
+        float radius = randomFloat(0.0f, 80.0f);
+
+        size_t found = TGLARScreenGridQueryRadius(&grid, x, y, radius, results, maxResults);
+
+        // The k-th nearest distance matches a full scan
+        // of the rectangles, so no closer one was missed
+        //
+        size_t within = 0;
+
+        for (uint32_t idx = 0; idx < count; idx++) {
+
+            if (distanceToRect(&rects[idx], x, y) <= radius) within++;
+        }
+
+        TGLAR_EXPECT(found == (within < maxResults ? within : maxResults));
+
+        for (size_t idx = 1; idx < found; idx++) {
+
+            TGLAR_EXPECT(distanceToRect(&rects[results[idx - 1]], x, y) <= distanceToRect(&rects[results[idx]], x, y));
+        }
+
+        if (found == 0) continue;
+
+        float farthest = distanceToRect(&rects[results[found - 1]], x, y);
+        size_t closer = 0;
+
+        for (uint32_t idx = 0; idx < count; idx++) {
+
+            if (distanceToRect(&rects[idx], x, y) < farthest) closer++;
+        }
+
+        TGLAR_EXPECT(closer < found);
+    }
+
+    TGLARScreenGridDestroy(&grid);
+
+    free(rects);
+}
+
+static void testEmptyGrid(void) {
+
+    TGLARScreenGrid grid;
+    uint32_t results[4];
+
+    TGLARScreenGridInit(&grid, 64.0f);
+
+    TGLAR_EXPECT(TGLARScreenGridQueryPoint(&grid, 10.0f, 10.0f, results, 4) == 0);
+    TGLAR_EXPECT(TGLARScreenGridQueryRadius(&grid, 10.0f, 10.0f, 50.0f, results, 4) == 0);
+    TGLAR_EXPECT(TGLARScreenGridBuild(&grid, 320.0f, 480.0f, NULL, 0));
+    TGLAR_EXPECT(TGLARScreenGridQueryPoint(&grid, 10.0f, 10.0f, results, 4) == 0);
+
+    TGLARScreenGridDestroy(&grid);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testPointQueryMatchesBruteForce);
+    TGLAR_RUN(testPointQueryInStackedCell);
+    TGLAR_RUN(testRadiusQueryMatchesBruteForce);
+    TGLAR_RUN(testEmptyGrid);
+
+    return TGLAR_RESULT();
+}
@@ -0,0 +1,443 @@
+//
+//  TGLARShapeRendererTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARBillboard.h"
+#include "TGLARMeshProcessing.h"
+#include "TGLARRenderBackendEGL.h"
+#include "TGLARRenderCheck.h"
+#include "TGLARShapeRenderer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Renders a fixed scene of image and mesh shapes with the
+// same program as the iOS views for a set of camera poses,
+// and compares each image to a stored golden one. Missing
+// goldens are written if TGLAR_RECORD_GOLDENS is set
+//
+#define RENDER_WIDTH 96
+#define RENDER_HEIGHT 64
+#define POSE_COUNT 4
+
+// Exit status telling ctest the test was skipped
+//
+#define SKIPPED 77
+
+static const float poseAngles[POSE_COUNT][2] = {
+
+    { 0.0f, 0.0f }, { 15.0f, 0.0f }, { -20.0f, 5.0f }, { 5.0f, 20.0f }
+};
+
+static const char *cubeOBJ =
+    "v -1 -1 -1\nv 1 -1 -1\nv 1 1 -1\nv -1 1 -1\n"
+    "v -1 -1 1\nv 1 -1 1\nv 1 1 1\nv -1 1 1\n"
+    "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+    "f 1/1 4/4 3/3 2/2\nf 5/1 6/2 7/3 8/4\n"
+    "f 1/1 2/2 6/3 5/4\nf 2/1 3/2 7/3 6/4\n"
+    "f 3/1 4/2 8/3 7/4\nf 4/1 1/2 5/3 8/4\n";
+
+typedef struct {
+
+    TGLARShapeRenderer renderer;
+
+    TGLARShapeGeometry quad;
+    TGLARShapeGeometry cube;
+    float cubeDecode[16];
+
+    GLuint texture;
+
+} Scene;
+
+static void multiply(const float a[16], const float b[16], float result[16]) {
+
+    float m[16];
+
+    for (int col = 0; col < 4; col++) {
+
+        for (int row = 0; row < 4; row++) {
+
+            m[4 * col + row] = a[row] * b[4 * col] + a[4 + row] * b[4 * col + 1] + a[8 + row] * b[4 * col + 2] + a[12 + row] * b[4 * col + 3];
+        }
+    }
+
+    memcpy(result, m, sizeof(m));
+}
+
+static void translation(float x, float y, float z, float m[16]) {
+
+    memset(m, 0, 16 * sizeof(float));
+
+    m[0] = m[5] = m[10] = m[15] = 1.0f;
+    m[12] = x; m[13] = y; m[14] = z;
+}
+
+static void rotationZ(float degrees, float m[16]) {
+
+    float c = cosf(degrees * (float)M_PI / 180.0f);
+    float s = sinf(degrees * (float)M_PI / 180.0f);
+
+    translation(0.0f, 0.0f, 0.0f, m);
+
+    m[0] = c; m[1] = s;
+    m[4] = -s; m[5] = c;
+}
+
+static void perspective(float fovy, float aspect, float near, float far, float m[16]) {
+
+    float f = 1.0f / tanf(0.5f * fovy * (float)M_PI / 180.0f);
+
+    memset(m, 0, 16 * sizeof(float));
+
+    m[0] = f / aspect;
+    m[5] = f;
+    m[10] = (far + near) / (near - far);
+    m[11] = -1.0f;
+    m[14] = 2.0f * far * near / (near - far);
+}
+
+// A camera at the origin looking along the x axis turned
+// by yaw about z and pitched up, with z pointing up
+//
+static void viewMatrix(float yaw, float pitch, float m[16]) {
+
+    float cy = cosf(yaw * (float)M_PI / 180.0f), sy = sinf(yaw * (float)M_PI / 180.0f);
+    float cp = cosf(pitch * (float)M_PI / 180.0f), sp = sinf(pitch * (float)M_PI / 180.0f);
+
+    float forward[3] = { cy * cp, sy * cp, sp };
+    float right[3] = { sy, -cy, 0.0f };
+    float up[3] = { -cy * sp, -sy * sp, cp };
+
+    translation(0.0f, 0.0f, 0.0f, m);
+
+    for (int axis = 0; axis < 3; axis++) {
+
+        m[4 * axis + 0] = right[axis];
+        m[4 * axis + 1] = up[axis];
+        m[4 * axis + 2] = -forward[axis];
+    }
+}
+
+static int sceneInit(Scene *scene) {
+
+    memset(scene, 0, sizeof(*scene));
+
+    if (!TGLARShapeRendererInit(&scene->renderer)) return 0;
+    if (!TGLARShapeGeometryInitQuad(&scene->quad, 4.0f, 3.0f)) return 0;
+
+    TGLARMeshData mesh;
+    TGLARPackedMesh packed;
+
+    TGLARMeshDataInit(&mesh);
+
+    int success = TGLARMeshParseOBJ(&mesh, cubeOBJ) && TGLARPackedMeshBuild(&packed, &mesh);
+
+    TGLARMeshDataDestroy(&mesh);
+
+    if (!success) return 0;
+
+    success = TGLARShapeGeometryInitPackedMesh(&scene->cube, &packed);
+
+    translation(packed.center[0], packed.center[1], packed.center[2], scene->cubeDecode);
+
+    for (int idx = 0; idx < 11; idx += 5) scene->cubeDecode[idx] = packed.scale;
+
+    TGLARPackedMeshDestroy(&packed);
+
+    // A checker board texture without mipmaps
+    //
+    uint8_t texels[8 * 8 * 4];
+
+    for (int idx = 0; idx < 8 * 8; idx++) {
+
+        int dark = ((idx % 8) + (idx / 8)) % 2;
+
+        texels[4 * idx + 0] = dark ? 40 : 250;
+        texels[4 * idx + 1] = dark ? 90 : 200;
+        texels[4 * idx + 2] = dark ? 160 : 60;
+        texels[4 * idx + 3] = 255;
+    }
+
+    glGenTextures(1, &scene->texture);
+    glBindTexture(GL_TEXTURE_2D, scene->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 8, 8, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return success && scene->texture != 0;
+}
+
+static void sceneDestroy(Scene *scene) {
+
+    if (scene->texture) glDeleteTextures(1, &scene->texture);
+
+    TGLARShapeGeometryDestroy(&scene->cube);
+    TGLARShapeGeometryDestroy(&scene->quad);
+    TGLARShapeRendererDestroy(&scene->renderer);
+}
+
+static void sceneDraw(Scene *scene, float yaw, float pitch) {
+
+    float view[16], model[16], rotation[16];
+    TGLARShapeMaterial material;
+
+    TGLARShapeMaterialInit(&material);
+
+    viewMatrix(yaw, pitch, view);
+    perspective(50.0f, (float)RENDER_WIDTH / RENDER_HEIGHT, 1.0f, 100.0f, material.projectionMatrix);
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // A billboard image, as drawn by image shapes
+    //
+    const float imagePosition[3] = { 12.0f, -3.0f, 0.5f };
+    const float cameraPosition[3] = { 0.0f, 0.0f, 0.0f };
+
+    TGLARBillboardMatrix(imagePosition, cameraPosition, rotation);
+    translation(imagePosition[0], imagePosition[1], imagePosition[2], model);
+    multiply(model, rotation, model);
+    multiply(view, model, material.modelviewMatrix);
+
+    material.texture = scene->texture;
+    material.textureMode = TGLARShapeTextureModeReplace;
+
+    TGLARShapeRendererPrepare(&scene->renderer, &material);
+    TGLARShapeGeometryDraw(&scene->quad, 0, scene->quad.indexCount);
+
+    // A lit mesh, as drawn by mesh shapes, with
+    // the light set relative to the world
+    //
+    const float light[3] = { 0.3f, 0.2f, 1.0f };
+    float lightLength = sqrtf(light[0] * light[0] + light[1] * light[1] + light[2] * light[2]);
+
+    for (int axis = 0; axis < 3; axis++) {
+
+        material.lightDirection[axis] = (view[axis] * light[0] + view[4 + axis] * light[1] + view[8 + axis] * light[2]) / lightLength;
+    }
+
+    material.lighting = 1;
+    material.ambientIntensity = 0.4f;
+    material.diffuseIntensity = 0.8f;
+    material.color[0] = 0.3f;
+    material.color[1] = 0.7f;
+    material.color[2] = 1.0f;
+    material.textureMode = TGLARShapeTextureModeNone;
+
+    translation(10.0f, 3.0f, -0.5f, model);
+    rotationZ(30.0f, rotation);
+    multiply(model, rotation, model);
+    multiply(model, scene->cubeDecode, model);
+    multiply(view, model, material.modelviewMatrix);
+
+    TGLARShapeRendererPrepare(&scene->renderer, &material);
+    TGLARShapeGeometryDraw(&scene->cube, 0, scene->cube.indexCount);
+
+    // The same mesh textured and lit
+    //
+    material.textureMode = TGLARShapeTextureModeModulate;
+    material.color[0] = material.color[1] = material.color[2] = 1.0f;
+
+    translation(14.0f, 0.5f, 3.0f, model);
+    rotationZ(-50.0f, rotation);
+    multiply(model, rotation, model);
+    multiply(model, scene->cubeDecode, model);
+    multiply(view, model, material.modelviewMatrix);
+
+    TGLARShapeRendererPrepare(&scene->renderer, &material);
+    TGLARShapeGeometryDraw(&scene->cube, 0, scene->cube.indexCount);
+}
+
+// Goldens are binary PAM files, which most
+// image viewers and converters can open
+//
+static int writeGolden(const char *path, const uint8_t *pixels) {
+
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL) return 0;
+
+    fprintf(file, "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", RENDER_WIDTH, RENDER_HEIGHT);
+
+    int success = fwrite(pixels, 4, RENDER_WIDTH * RENDER_HEIGHT, file) == RENDER_WIDTH * RENDER_HEIGHT;
+
+    return (fclose(file) == 0) && success;
+}
+
+static int readGolden(const char *path, uint8_t *pixels) {
+
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL) return 0;
+
+    int width = 0, height = 0, depth = 0, maxValue = 0;
+
+    int success = fscanf(file, "P7 WIDTH %d HEIGHT %d DEPTH %d MAXVAL %d TUPLTYPE RGB_ALPHA ENDHDR", &width, &height, &depth, &maxValue) == 4 && fgetc(file) == '\n';
+
+    success = success && width == RENDER_WIDTH && height == RENDER_HEIGHT && depth == 4 && maxValue == 255;
+    success = success && fread(pixels, 4, RENDER_WIDTH * RENDER_HEIGHT, file) == RENDER_WIDTH * RENDER_HEIGHT;
+
+    fclose(file);
+
+    return success;
+}
+
+static TGLARRenderBackend backend;
+static Scene scene;
+
+static void testPosesMatchGoldens(void) {
+
+    static uint8_t pixels[RENDER_WIDTH * RENDER_HEIGHT * 4];
+    static uint8_t golden[RENDER_WIDTH * RENDER_HEIGHT * 4];
+
+    int recording = getenv("TGLAR_RECORD_GOLDENS") != NULL;
+
+    for (uint32_t pose = 0; pose < POSE_COUNT; pose++) {
+
+        char path[1024];
+
+        snprintf(path, sizeof(path), "%s/TGLARShapeRenderer-pose-%03u.pam", TGLAR_GOLDEN_DIRECTORY, pose);
+
+        TGLAR_EXPECT(TGLARRenderBackendBegin(&backend, RENDER_WIDTH, RENDER_HEIGHT));
+
+        sceneDraw(&scene, poseAngles[pose][0], poseAngles[pose][1]);
+
+        TGLARRenderBackendReadPixels(&backend, RENDER_WIDTH, RENDER_HEIGHT, pixels);
+
+        TGLAR_EXPECT(glGetError() == GL_NO_ERROR);
+
+        // Every pose shows some of the scene
+        //
+        uint32_t covered = 0;
+
+        for (uint32_t idx = 0; idx < RENDER_WIDTH * RENDER_HEIGHT; idx++) covered += (pixels[4 * idx + 3] != 0);
+
+        TGLAR_EXPECT(covered > RENDER_WIDTH * RENDER_HEIGHT / 50);
+
+        if (!readGolden(path, golden)) {
+
+            if (recording) {
+
+                TGLAR_EXPECT(writeGolden(path, pixels));
+
+            } else {
+
+                fprintf(stderr, "Missing golden image %s, set TGLAR_RECORD_GOLDENS to record it\n", path);
+                TGLAR_EXPECT(0);
+            }
+
+            continue;
+        }
+
+        // Rasterizers may differ slightly along edges
+        //
+        TGLARImageDifference difference;
+
+        TGLARRenderCheckCompare(pixels, golden, RENDER_WIDTH, RENDER_HEIGHT, 2, &difference);
+
+        if (difference.mismatchedPixels > RENDER_WIDTH * RENDER_HEIGHT / 200) {
+
+            fprintf(stderr, "Pose %u: %u pixels differ, up to %u\n", pose, difference.mismatchedPixels, difference.maxDifference);
+        }
+
+        TGLAR_EXPECT(difference.mismatchedPixels <= RENDER_WIDTH * RENDER_HEIGHT / 200);
+    }
+}
+
+static void testPickingColors(void) {
+
+    static uint8_t pixels[RENDER_WIDTH * RENDER_HEIGHT * 4];
+
+    // Constant colors, as used for picking, are
+    // drawn exactly, without lighting or texture
+    //
+    TGLAR_EXPECT(TGLARRenderBackendBegin(&backend, RENDER_WIDTH, RENDER_HEIGHT));
+
+    glEnable(GL_DEPTH_TEST);
+    glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    TGLARShapeMaterial material;
+    float view[16], model[16];
+
+    TGLARShapeMaterialInit(&material);
+
+    viewMatrix(0.0f, 0.0f, view);
+    perspective(50.0f, (float)RENDER_WIDTH / RENDER_HEIGHT, 1.0f, 100.0f, material.projectionMatrix);
+    translation(10.0f, 0.0f, 0.0f, model);
+    multiply(model, scene.cubeDecode, model);
+    multiply(view, model, material.modelviewMatrix);
+
+    material.color[0] = 7.0f / 255.0f;
+    material.color[1] = 0.0f;
+    material.color[2] = 0.0f;
+    material.color[3] = 0.0f;
+    material.texture = scene.texture;
+
+    TGLARShapeRendererPrepare(&scene.renderer, &material);
+    TGLARShapeGeometryDraw(&scene.cube, 0, scene.cube.indexCount);
+
+    TGLARRenderBackendReadPixels(&backend, RENDER_WIDTH, RENDER_HEIGHT, pixels);
+
+    const uint8_t *center = pixels + 4 * (RENDER_HEIGHT / 2 * RENDER_WIDTH + RENDER_WIDTH / 2);
+    const uint8_t *corner = pixels;
+
+    TGLAR_EXPECT(center[0] == 7 && center[1] == 0 && center[2] == 0);
+    TGLAR_EXPECT(corner[0] == 255 && corner[1] == 255 && corner[2] == 255);
+}
+
+int main(void) {
+
+    TGLARRenderBackendEGL egl;
+
+    if (!TGLARRenderBackendEGLInit(&egl, &backend)) {
+
+        printf("SKIP no EGL context available\n");
+        return SKIPPED;
+    }
+
+    if (!sceneInit(&scene)) {
+
+        fprintf(stderr, "Scene could not be created\n");
+
+        TGLARRenderBackendEGLDestroy(&egl);
+        return 1;
+    }
+
+    TGLAR_RUN(testPosesMatchGoldens);
+    TGLAR_RUN(testPickingColors);
+
+    sceneDestroy(&scene);
+
+    TGLARRenderBackendEGLDestroy(&egl);
+
+    return TGLAR_RESULT();
+}
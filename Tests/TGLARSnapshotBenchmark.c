@@ -0,0 +1,223 @@
+//
+//  TGLARSnapshotBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARSnapshot.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define EARTH_RADIUS 6378137.0
+
+typedef struct {
+
+    char identifier[32];
+    double latitude;
+    double longitude;
+
+} Place;
+
+static double degreesToRadians(double degrees) {
+
+    return degrees * M_PI / 180.0;
+}
+
+// Great circle distance, as MapKit measures
+// between map points
+//
+static double distance(double latitude1, double longitude1, double latitude2, double longitude2) {
+
+    double dlat = degreesToRadians(latitude2 - latitude1);
+    double dlon = degreesToRadians(longitude2 - longitude1);
+    double a = sin(dlat / 2.0) * sin(dlat / 2.0) + cos(degreesToRadians(latitude1)) * cos(degreesToRadians(latitude2)) * sin(dlon / 2.0) * sin(dlon / 2.0);
+
+    return 2.0 * EARTH_RADIUS * atan2(sqrt(a), sqrt(1.0 - a));
+}
+
+// Derives a world position the way the example app
+// does without a snapshot: east and north distances
+// between Mercator points of place and reference
+//
+static void worldPosition(const Place *place, TGLARSnapshotReference reference, double position[3]) {
+
+    double east = distance(reference.latitude, reference.longitude, reference.latitude, place->longitude);
+    double north = distance(reference.latitude, reference.longitude, place->latitude, reference.longitude);
+
+    position[0] = (place->longitude < reference.longitude) ? -east : east;
+    position[1] = (place->latitude < reference.latitude) ? -north : north;
+    position[2] = 0.0;
+}
+
+static uint64_t placeKey(const Place *place) {
+
+    return TGLARSnapshotHash(place->identifier, strlen(place->identifier), TGLAR_SNAPSHOT_HASH_SEED);
+}
+
+static void writeFile(const char *path, const void *bytes, size_t length) {
+
+    char temporaryPath[256];
+
+    snprintf(temporaryPath, sizeof(temporaryPath), "%s.tmp", path);
+
+    FILE *file = fopen(temporaryPath, "wb");
+
+    fwrite(bytes, 1, length, file);
+    fclose(file);
+
+    rename(temporaryPath, path);
+}
+
+static void *mapFile(const char *path, size_t length, int writable) {
+
+    int fd = open(path, writable ? O_RDWR : O_RDONLY);
+    void *bytes = mmap(NULL, length, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    return bytes;
+}
+
+static void benchmarkStartup(uint32_t count, int runs) {
+
+    Place *places = malloc(count * sizeof(Place));
+    TGLARSnapshotEntry *entries = malloc(count * sizeof(TGLARSnapshotEntry));
+    double *positions = malloc(3 * count * sizeof(double));
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(52.52, 13.405, 0.0);
+    char path[] = "/tmp/TGLARSnapshotBenchmark.XXXXXX";
+
+    close(mkstemp(path));
+    srand(5);
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        snprintf(places[idx].identifier, sizeof(places[idx].identifier), "place-%u", idx);
+
+        places[idx].latitude = reference.latitude + (double)rand() / RAND_MAX - 0.5;
+        places[idx].longitude = reference.longitude + (double)rand() / RAND_MAX - 0.5;
+    }
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        memset(&entries[idx], 0, sizeof(TGLARSnapshotEntry));
+
+        entries[idx].key = placeKey(&places[idx]);
+        entries[idx].calloutLength = 40.0f;
+        entries[idx].flags = TGLARSnapshotEntryHasPosition | TGLARSnapshotEntryHasCallout;
+
+        worldPosition(&places[idx], reference, entries[idx].position);
+    }
+
+    TGLARSnapshotSortEntries(entries, count);
+
+    size_t length = TGLARSnapshotSize(count);
+    uint64_t *buffer = malloc(length);
+
+    TGLARSnapshotWrite(buffer, length, entries, count, reference);
+    writeFile(path, buffer, length);
+
+    double cold = INFINITY, warm = INFINITY, fullWrite = INFINITY, refresh = INFINITY;
+    size_t found = 0;
+
+    for (int run = 0; run < runs; run++) {
+
+        // Without a snapshot every position is derived
+        //
+        double start = TGLARTestNow();
+
+        for (uint32_t idx = 0; idx < count; idx++) worldPosition(&places[idx], reference, &positions[3 * idx]);
+
+        cold = fmin(cold, TGLARTestNow() - start);
+
+        // With a snapshot the file is mapped, validated
+        // and positions are looked up by identifier
+        //
+        start = TGLARTestNow();
+
+        void *bytes = mapFile(path, length, 0);
+        TGLARSnapshot snapshot;
+
+        if (TGLARSnapshotOpen(&snapshot, bytes, length, &reference) == TGLARSnapshotStatusValid) {
+
+            for (uint32_t idx = 0; idx < count; idx++) {
+
+                const TGLARSnapshotEntry *entry = TGLARSnapshotFind(&snapshot, placeKey(&places[idx]));
+
+                if (entry) memcpy(&positions[3 * idx], entry->position, sizeof(entry->position));
+
+                found += (entry != NULL);
+            }
+        }
+
+        warm = fmin(warm, TGLARTestNow() - start);
+
+        munmap(bytes, length);
+
+        // Saving after a few callouts changed: writing the
+        // whole file atomically or refreshing it in place
+        //
+        for (uint32_t idx = 0; idx < count; idx += 100) entries[idx].calloutLength += 1.0f;
+
+        start = TGLARTestNow();
+
+        TGLARSnapshotWrite(buffer, length, entries, count, reference);
+        writeFile(path, buffer, length);
+
+        fullWrite = fmin(fullWrite, TGLARTestNow() - start);
+
+        for (uint32_t idx = 0; idx < count; idx += 100) entries[idx].calloutLength += 1.0f;
+
+        start = TGLARTestNow();
+
+        bytes = mapFile(path, length, 1);
+
+        for (uint32_t idx = 0; idx < count; idx += 100) TGLARSnapshotReplaceEntry(bytes, length, idx, &entries[idx]);
+
+        msync(bytes, length, MS_ASYNC);
+        munmap(bytes, length);
+
+        refresh = fmin(refresh, TGLARTestNow() - start);
+    }
+
+    printf("snapshot %8u places: derived %8.3f ms, mapped %8.3f ms (%zu found), full write %8.3f ms, in-place refresh %8.3f ms\n", count, cold * 1.0e3, warm * 1.0e3, found / (size_t)runs, fullWrite * 1.0e3, refresh * 1.0e3);
+
+    unlink(path);
+
+    free(buffer);
+    free(positions);
+    free(entries);
+    free(places);
+}
+
+int main(void) {
+
+    benchmarkStartup(1000, 50);
+    benchmarkStartup(10000, 20);
+    benchmarkStartup(100000, 5);
+
+    return 0;
+}
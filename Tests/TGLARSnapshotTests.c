@@ -0,0 +1,307 @@
+//
+//  TGLARSnapshotTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARSnapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define ENTRY_COUNT 500
+
+static void makeEntries(TGLARSnapshotEntry *entries, uint32_t count) {
+
+    for (uint32_t idx = 0; idx < count; idx++) {
+
+        memset(&entries[idx], 0, sizeof(TGLARSnapshotEntry));
+
+        entries[idx].key = TGLARSnapshotHash(&idx, sizeof(idx), TGLAR_SNAPSHOT_HASH_SEED);
+        entries[idx].position[0] = 10.0 * idx;
+        entries[idx].position[1] = -5.0 * idx;
+        entries[idx].position[2] = 0.5 * idx;
+        entries[idx].calloutLength = (float)(idx % 40);
+        entries[idx].flags = TGLARSnapshotEntryHasPosition | ((idx % 2) ? TGLARSnapshotEntryHasCallout : 0);
+    }
+
+    TGLARSnapshotSortEntries(entries, count);
+}
+
+// Writes a snapshot to an 8 byte aligned buffer
+//
+static uint64_t *writeSnapshot(const TGLARSnapshotEntry *entries, uint32_t count, TGLARSnapshotReference reference, size_t *length) {
+
+    *length = TGLARSnapshotSize(count);
+
+    uint64_t *buffer = malloc(*length);
+
+    TGLAR_EXPECT(TGLARSnapshotWrite(buffer, *length, entries, count, reference) == *length);
+
+    return buffer;
+}
+
+static void testRoundTrip(void) {
+
+    TGLARSnapshotEntry entries[ENTRY_COUNT];
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(52.52, 13.405, 34.0);
+    TGLARSnapshot snapshot;
+    size_t length;
+
+    makeEntries(entries, ENTRY_COUNT);
+
+    uint64_t *buffer = writeSnapshot(entries, ENTRY_COUNT, reference, &length);
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, &reference) == TGLARSnapshotStatusValid);
+    TGLAR_EXPECT(snapshot.count == ENTRY_COUNT);
+    TGLAR_EXPECT(snapshot.reference.latitude == 52.52 && snapshot.reference.longitude == 13.405 && snapshot.reference.altitude == 34.0);
+    TGLAR_EXPECT(memcmp(snapshot.entries, entries, sizeof(entries)) == 0);
+
+    for (uint32_t idx = 0; idx < ENTRY_COUNT; idx++) {
+
+        TGLAR_EXPECT(TGLARSnapshotFind(&snapshot, entries[idx].key) == &snapshot.entries[idx]);
+    }
+
+    // Keys between and beyond the stored ones
+    //
+    TGLAR_EXPECT(TGLARSnapshotFind(&snapshot, entries[0].key - 1) == NULL || entries[0].key == 0);
+    TGLAR_EXPECT(TGLARSnapshotFind(&snapshot, entries[ENTRY_COUNT - 1].key + 1) == NULL || entries[ENTRY_COUNT - 1].key == UINT64_MAX);
+
+    free(buffer);
+}
+
+static void testEmptySnapshot(void) {
+
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(0.0, 0.0, 0.0);
+    TGLARSnapshot snapshot;
+    size_t length;
+
+    uint64_t *buffer = writeSnapshot(NULL, 0, reference, &length);
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, NULL) == TGLARSnapshotStatusValid);
+    TGLAR_EXPECT(snapshot.count == 0);
+    TGLAR_EXPECT(TGLARSnapshotFind(&snapshot, 42) == NULL);
+
+    free(buffer);
+}
+
+static void testWriteRejectsSmallBuffer(void) {
+
+    TGLARSnapshotEntry entries[4];
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(1.0, 2.0, 3.0);
+    size_t length = TGLARSnapshotSize(4);
+    uint64_t *buffer = malloc(length + sizeof(uint64_t));
+
+    makeEntries(entries, 4);
+
+    TGLAR_EXPECT(TGLARSnapshotWrite(buffer, length - 1, entries, 4, reference) == 0);
+    TGLAR_EXPECT(TGLARSnapshotWrite((uint8_t *)buffer + 4, length, entries, 4, reference) == 0);
+
+    free(buffer);
+}
+
+static void testReferenceChanged(void) {
+
+    TGLARSnapshotEntry entries[8];
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(48.137, 11.575, 0.0);
+    TGLARSnapshotReference moved = TGLARSnapshotReferenceMake(48.137, 11.576, 0.0);
+    TGLARSnapshot snapshot;
+    size_t length;
+
+    makeEntries(entries, 8);
+
+    uint64_t *buffer = writeSnapshot(entries, 8, reference, &length);
+
+    // Entries stay accessible, callout state
+    // doesn't depend on the reference
+    //
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, &moved) == TGLARSnapshotStatusReferenceChanged);
+    TGLAR_EXPECT(snapshot.count == 8);
+    TGLAR_EXPECT(TGLARSnapshotFind(&snapshot, entries[3].key) != NULL);
+    TGLAR_EXPECT(snapshot.reference.longitude == 11.575);
+
+    free(buffer);
+}
+
+static void testVersionMismatch(void) {
+
+    TGLARSnapshotEntry entries[8];
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(1.0, 2.0, 3.0);
+    TGLARSnapshot snapshot;
+    size_t length;
+
+    makeEntries(entries, 8);
+
+    uint64_t *buffer = writeSnapshot(entries, 8, reference, &length);
+    uint32_t *words = (uint32_t *)buffer;
+
+    // Header words are magic, version, entry size and count
+    //
+    words[1] = TGLAR_SNAPSHOT_VERSION - 1;
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, NULL) == TGLARSnapshotStatusVersionMismatch);
+    TGLAR_EXPECT(snapshot.entries == NULL && snapshot.count == 0);
+
+    words[1] = TGLAR_SNAPSHOT_VERSION + 1;
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, NULL) == TGLARSnapshotStatusVersionMismatch);
+
+    words[1] = TGLAR_SNAPSHOT_VERSION;
+    words[2] = sizeof(TGLARSnapshotEntry) + 8;
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, NULL) == TGLARSnapshotStatusVersionMismatch);
+
+    words[2] = sizeof(TGLARSnapshotEntry);
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, NULL) == TGLARSnapshotStatusValid);
+
+    free(buffer);
+}
+
+static void testCorruption(void) {
+
+    TGLARSnapshotEntry entries[ENTRY_COUNT];
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(35.68, 139.76, 40.0);
+    TGLARSnapshot snapshot;
+    size_t length;
+
+    makeEntries(entries, ENTRY_COUNT);
+
+    uint64_t *buffer = writeSnapshot(entries, ENTRY_COUNT, reference, &length);
+    uint8_t *bytes = (uint8_t *)buffer;
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, NULL, 0, NULL) == TGLARSnapshotStatusCorrupt);
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, TGLARSnapshotSize(0) - 1, NULL) == TGLARSnapshotStatusCorrupt);
+
+    // Truncated and extended files
+    //
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length - sizeof(TGLARSnapshotEntry), NULL) == TGLARSnapshotStatusCorrupt);
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length - 1, NULL) == TGLARSnapshotStatusCorrupt);
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, TGLARSnapshotSize(0), NULL) == TGLARSnapshotStatusCorrupt);
+
+    // Single bit flips anywhere but in the version
+    // and entry size words are detected as corruption
+    //
+    srand(3);
+
+    for (int trial = 0; trial < 2000; trial++) {
+
+        size_t offset = (size_t)rand() % length;
+        uint8_t bit = (uint8_t)(1u << (rand() % 8));
+
+        if (offset >= 4 && offset < 12) continue;
+
+        bytes[offset] ^= bit;
+
+        TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, NULL) == TGLARSnapshotStatusCorrupt);
+
+        bytes[offset] ^= bit;
+    }
+
+    // Swapped entries keep the sum of per-entry
+    // words, but not the checksum
+    //
+    TGLARSnapshotEntry *stored = (TGLARSnapshotEntry *)(bytes + TGLARSnapshotSize(0));
+    TGLARSnapshotEntry swap = stored[10];
+
+    stored[10] = stored[11];
+    stored[11] = swap;
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, NULL) == TGLARSnapshotStatusCorrupt);
+
+    stored[11] = stored[10];
+    stored[10] = swap;
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, &reference) == TGLARSnapshotStatusValid);
+
+    // Misaligned mappings are rejected rather than read
+    //
+    uint64_t *shifted = malloc(length + sizeof(uint64_t));
+
+    memcpy((uint8_t *)shifted + 4, buffer, length);
+
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, (uint8_t *)shifted + 4, length, NULL) == TGLARSnapshotStatusCorrupt);
+
+    free(shifted);
+    free(buffer);
+}
+
+static void testReplaceEntry(void) {
+
+    TGLARSnapshotEntry entries[ENTRY_COUNT];
+    TGLARSnapshotReference reference = TGLARSnapshotReferenceMake(-33.86, 151.21, 5.0);
+    TGLARSnapshot snapshot;
+    size_t length;
+
+    makeEntries(entries, ENTRY_COUNT);
+
+    uint64_t *buffer = writeSnapshot(entries, ENTRY_COUNT, reference, &length);
+
+    // Replacing entries in place must produce the
+    // same bytes as writing the snapshot again
+    //
+    for (uint32_t idx = 0; idx < ENTRY_COUNT; idx += 7) {
+
+        entries[idx].position[0] += 1.5;
+        entries[idx].calloutLength = 99.0f;
+        entries[idx].flags |= TGLARSnapshotEntryHasCallout | TGLARSnapshotEntryRightAligned;
+
+        TGLAR_EXPECT(TGLARSnapshotReplaceEntry(buffer, length, idx, &entries[idx]));
+    }
+
+    size_t expectedLength;
+    uint64_t *expected = writeSnapshot(entries, ENTRY_COUNT, reference, &expectedLength);
+
+    TGLAR_EXPECT(expectedLength == length && memcmp(buffer, expected, length) == 0);
+    TGLAR_EXPECT(TGLARSnapshotOpen(&snapshot, buffer, length, &reference) == TGLARSnapshotStatusValid);
+    TGLAR_EXPECT(TGLARSnapshotFind(&snapshot, entries[14].key)->calloutLength == 99.0f);
+
+    // Changing keys would break the sort order,
+    // invalid indexes and lengths are rejected
+    //
+    TGLARSnapshotEntry entry = entries[3];
+
+    entry.key = entries[4].key;
+
+    TGLAR_EXPECT(!TGLARSnapshotReplaceEntry(buffer, length, 3, &entry));
+    TGLAR_EXPECT(!TGLARSnapshotReplaceEntry(buffer, length, ENTRY_COUNT, &entries[0]));
+    TGLAR_EXPECT(!TGLARSnapshotReplaceEntry(buffer, length - 1, 0, &entries[0]));
+    TGLAR_EXPECT(!TGLARSnapshotReplaceEntry(NULL, 0, 0, &entries[0]));
+    TGLAR_EXPECT(memcmp(buffer, expected, length) == 0);
+
+    free(expected);
+    free(buffer);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testRoundTrip);
+    TGLAR_RUN(testEmptySnapshot);
+    TGLAR_RUN(testWriteRejectsSmallBuffer);
+    TGLAR_RUN(testReferenceChanged);
+    TGLAR_RUN(testVersionMismatch);
+    TGLAR_RUN(testCorruption);
+    TGLAR_RUN(testReplaceEntry);
+
+    return TGLAR_RESULT();
+}
@@ -0,0 +1,75 @@
+//
+//  TGLARTest.h
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#ifndef TGLARTest_h
+#define TGLARTest_h
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+// Minimal test support, so the C cores
+// build without any test framework
+//
+static int TGLARTestFailureCount __attribute__((unused)) = 0;
+
+/// Records a failure if @p condition is false.
+#define TGLAR_EXPECT(condition) do { \
+    if (!(condition)) { \
+        fprintf(stderr, "%s:%d: expected %s\n", __FILE__, __LINE__, #condition); \
+        TGLARTestFailureCount++; \
+    } \
+} while (0)
+
+/// Records a failure if @p a and @p b differ by more than @p tolerance.
+#define TGLAR_EXPECT_NEAR(a, b, tolerance) do { \
+    double tglarA = (double)(a), tglarB = (double)(b); \
+    if (!(fabs(tglarA - tglarB) <= (tolerance))) { \
+        fprintf(stderr, "%s:%d: expected %s (%g) near %s (%g)\n", __FILE__, __LINE__, #a, tglarA, #b, tglarB); \
+        TGLARTestFailureCount++; \
+    } \
+} while (0)
+
+/// Runs a test function and prints its result.
+#define TGLAR_RUN(test) do { \
+    int tglarFailures = TGLARTestFailureCount; \
+    test(); \
+    printf("%s %s\n", (TGLARTestFailureCount == tglarFailures) ? "PASS" : "FAIL", #test); \
+} while (0)
+
+/// The exit status of a test executable.
+#define TGLAR_RESULT() ((TGLARTestFailureCount == 0) ? 0 : 1)
+
+/// Returns a monotonic time in seconds for benchmarks.
+static inline double TGLARTestNow(void) {
+
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double)time.tv_sec + (double)time.tv_nsec * 1.0e-9;
+}
+
+#endif /* TGLARTest_h */
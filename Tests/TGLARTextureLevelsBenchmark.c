@@ -0,0 +1,126 @@
+//
+//  TGLARTextureLevelsBenchmark.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARTextureLevels.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Measures generating a complete mipmap chain, as done
+// after decoding a texture on the background queue
+//
+static void benchmarkLevels(uint32_t size, int runs) {
+
+    uint32_t levelCount = TGLARTextureLevelCount(size, size);
+    uint8_t *chain = malloc(TGLARTextureChainBytes(size, size, 0));
+
+    for (size_t idx = 0; idx < TGLARTextureLevelBytes(size, size, 0); idx++) chain[idx] = (uint8_t)(idx * 31);
+
+    double best = INFINITY;
+
+    for (int run = 0; run < runs; run++) {
+
+        double start = TGLARTestNow();
+
+        uint8_t *level = chain;
+
+        for (uint32_t idx = 1; idx < levelCount; idx++) {
+
+            uint8_t *next = level + TGLARTextureLevelBytes(size, size, idx - 1);
+
+            TGLARTextureDownsampleRGBA8(level, size >> (idx - 1), size >> (idx - 1), next);
+
+            level = next;
+        }
+
+        best = fmin(best, TGLARTestNow() - start);
+    }
+
+    printf("levels     %5ux%-5u: best %8.3f ms, %6.2f ns per base pixel\n", size, size, best * 1.0e3, best * 1.0e9 / ((double)size * size));
+
+    free(chain);
+}
+
+// Measures the per-frame residency update of the texture
+// streamer for shapes of changing sizes on screen
+//
+static void benchmarkResidency(size_t count, int frames) {
+
+    TGLARTextureResidency *entries = malloc(count * sizeof(TGLARTextureResidency));
+    float *sizes = malloc(count * sizeof(float));
+
+    srand(7);
+
+    for (size_t idx = 0; idx < count; idx++) sizes[idx] = (float)(rand() % 1200);
+
+    double best = INFINITY;
+    double sum = 0.0;
+    size_t residentBytes = 0;
+
+    for (int frame = 0; frame < frames; frame++) {
+
+        double start = TGLARTestNow();
+
+        for (size_t idx = 0; idx < count; idx++) {
+
+            TGLARTextureResidency *entry = &entries[idx];
+            uint32_t size = (idx % 4 == 0) ? 1024 : 512;
+
+            entry->width = size;
+            entry->height = size;
+            entry->levelCount = TGLARTextureLevelCount(size, size);
+            entry->projectedSize = sizes[idx] * (1.0f + 0.5f * sinf(0.05f * frame + (float)idx));
+            entry->desiredLevel = TGLARTextureLevelForProjectedSize(size, size, entry->levelCount, entry->projectedSize);
+            entry->residentLevel = entry->desiredLevel;
+            entry->owner = NULL;
+        }
+
+        residentBytes = TGLARTextureResolveResidency(entries, count, 32 * 1024 * 1024);
+
+        double time = TGLARTestNow() - start;
+
+        best = fmin(best, time);
+        sum += time;
+    }
+
+    printf("residency %6zu textures: best %8.3f ms, mean %8.3f ms, %6.1f ns per texture (%zu MB resident)\n", count, best * 1.0e3, sum / frames * 1.0e3, best * 1.0e9 / (double)count, residentBytes >> 20);
+
+    free(sizes);
+    free(entries);
+}
+
+int main(void) {
+
+    benchmarkLevels(256, 50);
+    benchmarkLevels(1024, 20);
+    benchmarkLevels(2048, 5);
+
+    benchmarkResidency(100, 200);
+    benchmarkResidency(1000, 200);
+    benchmarkResidency(10000, 50);
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+//
+//  TGLARTextureLevelsTests.c
+//  TGLAugmentedRealityView
+//
+//  Created by Tim Gleue on 19.10.26.
+//  Copyright (c) 2026 Tim Gleue ( http://gleue-interactive.com )
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+#include "TGLARTest.h"
+#include "TGLARTextureLevels.h"
+
+#include <string.h>
+
+static void testLevelSizes(void) {
+
+    TGLAR_EXPECT(TGLARTexturePowerOfTwo(100, 1024) == 128);
+    TGLAR_EXPECT(TGLARTexturePowerOfTwo(3000, 1024) == 1024);
+    TGLAR_EXPECT(TGLARTexturePowerOfTwo(0, 1024) == 1);
+
+    TGLAR_EXPECT(TGLARTextureLevelCount(256, 64) == 9);
+    TGLAR_EXPECT(TGLARTextureLevelCount(1, 1) == 1);
+
+    TGLAR_EXPECT(TGLARTextureLevelBytes(256, 64, 0) == 256 * 64 * 4);
+    TGLAR_EXPECT(TGLARTextureLevelBytes(256, 64, 7) == 2 * 1 * 4);
+    TGLAR_EXPECT(TGLARTextureLevelBytes(256, 64, 8) == 1 * 1 * 4);
+
+    size_t chain = 0;
+
+    for (uint32_t level = 2; level < 9; level++) chain += TGLARTextureLevelBytes(256, 64, level);
+
+    TGLAR_EXPECT(TGLARTextureChainBytes(256, 64, 2) == chain);
+}
+
+static void testLevelForProjectedSize(void) {
+
+    TGLAR_EXPECT(TGLARTextureLevelForProjectedSize(512, 512, 10, 1000.0f) == 0);
+    TGLAR_EXPECT(TGLARTextureLevelForProjectedSize(512, 512, 10, 512.0f) == 0);
+    TGLAR_EXPECT(TGLARTextureLevelForProjectedSize(512, 512, 10, 200.0f) == 1);
+    TGLAR_EXPECT(TGLARTextureLevelForProjectedSize(512, 512, 10, 64.0f) == 3);
+    TGLAR_EXPECT(TGLARTextureLevelForProjectedSize(512, 512, 10, 0.0f) == 9);
+    TGLAR_EXPECT(TGLARTextureLevelForProjectedSize(512, 512, 10, 0.1f) == 9);
+
+    // The selected level is never smaller than the
+    // projected size, so it is never magnified
+    //
+    for (float size = 1.0f; size <= 512.0f; size += 7.0f) {
+
+        uint32_t level = TGLARTextureLevelForProjectedSize(512, 512, 10, size);
+
+        TGLAR_EXPECT((float)(512 >> level) >= size);
+    }
+}
+
+static void testDownsample(void) {
+
+    uint8_t src[4 * 2 * 4];
+    uint8_t dst[2 * 1 * 4];
+
+    for (int idx = 0; idx < (int)sizeof(src); idx++) src[idx] = (uint8_t)(idx * 4);
+
+    TGLARTextureDownsampleRGBA8(src, 4, 2, dst);
+
+    // Each output pixel averages a 2x2 block
+    //
+    for (int c = 0; c < 4; c++) {
+
+        TGLAR_EXPECT(dst[c] == (src[c] + src[4 + c] + src[16 + c] + src[20 + c] + 2) / 4);
+        TGLAR_EXPECT(dst[4 + c] == (src[8 + c] + src[12 + c] + src[24 + c] + src[28 + c] + 2) / 4);
+    }
+
+    // A single row or column collapses along one axis only
+    //
+    uint8_t column[1 * 2 * 4] = { 10, 20, 30, 40, 30, 40, 50, 60 };
+    uint8_t pixel[4];
+
+    TGLARTextureDownsampleRGBA8(column, 1, 2, pixel);
+
+    TGLAR_EXPECT(pixel[0] == 20 && pixel[1] == 30 && pixel[2] == 40 && pixel[3] == 50);
+}
+
+static void fillEntry(TGLARTextureResidency *entry, uint32_t size, float projectedSize, void *owner) {
+
+    memset(entry, 0, sizeof(TGLARTextureResidency));
+
+    entry->width = size;
+    entry->height = size;
+    entry->levelCount = TGLARTextureLevelCount(size, size);
+    entry->desiredLevel = TGLARTextureLevelForProjectedSize(size, size, entry->levelCount, projectedSize);
+    entry->projectedSize = projectedSize;
+    entry->owner = owner;
+}
+
+static void testResidencyWithinBudget(void) {
+
+    TGLARTextureResidency entries[2];
+
+    fillEntry(&entries[0], 256, 300.0f, NULL);
+    fillEntry(&entries[1], 256, 64.0f, NULL);
+
+    size_t total = TGLARTextureResolveResidency(entries, 2, 64 * 1024 * 1024);
+
+    TGLAR_EXPECT(entries[0].residentLevel == 0);
+    TGLAR_EXPECT(entries[1].residentLevel == 2);
+    TGLAR_EXPECT(total == TGLARTextureChainBytes(256, 256, 0) + TGLARTextureChainBytes(256, 256, 2));
+}
+
+static void testResidencyEvictsSmallestFirst(void) {
+
+    int owners[3];
+    TGLARTextureResidency entries[3];
+
+    fillEntry(&entries[0], 512, 100.0f, &owners[0]);
+    fillEntry(&entries[1], 512, 600.0f, &owners[1]);
+    fillEntry(&entries[2], 512, 300.0f, &owners[2]);
+
+    // Room for all textures at full size except for
+    // about one level of the smallest one on screen
+    //
+    size_t full = TGLARTextureChainBytes(512, 512, 0);
+    size_t budget = 3 * full - TGLARTextureLevelBytes(512, 512, 0) / 2;
+
+    for (int idx = 0; idx < 3; idx++) entries[idx].desiredLevel = 0;
+
+    size_t total = TGLARTextureResolveResidency(entries, 3, budget);
+
+    TGLAR_EXPECT(total <= budget);
+
+    // Reordered by descending projected size
+    //
+    TGLAR_EXPECT(entries[0].owner == &owners[1]);
+    TGLAR_EXPECT(entries[1].owner == &owners[2]);
+    TGLAR_EXPECT(entries[2].owner == &owners[0]);
+
+    TGLAR_EXPECT(entries[0].residentLevel == 0);
+    TGLAR_EXPECT(entries[1].residentLevel == 0);
+    TGLAR_EXPECT(entries[2].residentLevel == 1);
+}
+
+static void testResidencyKeepsCoarsestLevel(void) {
+
+    TGLARTextureResidency entries[64];
+
+    for (int idx = 0; idx < 64; idx++) fillEntry(&entries[idx], 1024, 1024.0f - idx, NULL);
+
+    size_t total = TGLARTextureResolveResidency(entries, 64, 0);
+
+    // Nothing fits, so every texture is left with its 1x1 level
+    //
+    TGLAR_EXPECT(total == 64 * 4);
+
+    for (int idx = 0; idx < 64; idx++) TGLAR_EXPECT(entries[idx].residentLevel == entries[idx].levelCount - 1);
+}
+
+static void testResidencyMeetsBudget(void) {
+
+    TGLARTextureResidency entries[200];
+
+    for (int idx = 0; idx < 200; idx++) fillEntry(&entries[idx], 512, (float)(idx * 37 % 700), NULL);
+
+    size_t budget = 8 * 1024 * 1024;
+    size_t total = TGLARTextureResolveResidency(entries, 200, budget);
+
+    size_t sum = 0;
+
+    for (int idx = 0; idx < 200; idx++) {
+
+        TGLAR_EXPECT(entries[idx].residentLevel >= entries[idx].desiredLevel);
+
+        sum += TGLARTextureChainBytes(entries[idx].width, entries[idx].height, entries[idx].residentLevel);
+
+        // Larger textures on screen are never coarser than smaller ones
+        //
+        if (idx > 0 && entries[idx].desiredLevel == entries[idx - 1].desiredLevel) {
+
+            TGLAR_EXPECT(entries[idx].residentLevel >= entries[idx - 1].residentLevel);
+        }
+    }
+
+    TGLAR_EXPECT(total == sum);
+    TGLAR_EXPECT(total <= budget);
+}
+
+int main(void) {
+
+    TGLAR_RUN(testLevelSizes);
+    TGLAR_RUN(testLevelForProjectedSize);
+    TGLAR_RUN(testDownsample);
+    TGLAR_RUN(testResidencyWithinBudget);
+    TGLAR_RUN(testResidencyEvictsSmallestFirst);
+    TGLAR_RUN(testResidencyKeepsCoarsestLevel);
+    TGLAR_RUN(testResidencyMeetsBudget);
+
+    return TGLAR_RESULT();
+}